@@ -68,6 +68,7 @@ LOCAL_SRC_FILES += $(SRC_DIR)/layers/sync_vuid_maps.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/core_error_location.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/generated/synchronization_validation_types.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/synchronization_validation.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/worker_pool.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/convert_to_renderpass2.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/generated/layer_chassis_dispatch.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/generated/chassis.cpp
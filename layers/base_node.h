@@ -98,6 +98,11 @@ class BASE_NODE : public std::enable_shared_from_this<BASE_NODE> {
     // Helper to let objects examine their immediate parents without holding the tree lock.
     NodeMap ObjectBindings() const;
 
+    // Descriptors of UPDATE_AFTER_BIND or PARTIALLY_BOUND bindings don't become parents of the objects they reference, so
+    // objects remember having been written to one instead.
+    void SetBindlessReferenced() const { bindless_referenced_.store(true, std::memory_order_relaxed); }
+    bool BindlessReferenced() const { return bindless_referenced_.load(std::memory_order_relaxed); }
+
   protected:
     template <typename Derived, typename Shared = std::shared_ptr<Derived>>
     static Shared SharedFromThisImpl(Derived *derived) {
@@ -119,6 +124,8 @@ class BASE_NODE : public std::enable_shared_from_this<BASE_NODE> {
     // hang around until its shared_ptr refcount goes to zero.
     std::atomic<bool> destroyed_;
 
+    mutable std::atomic<bool> bindless_referenced_{false};
+
   private:
     ReadLockGuard ReadLockTree() const { return ReadLockGuard(tree_lock_); }
     WriteLockGuard WriteLockTree() { return WriteLockGuard(tree_lock_); }
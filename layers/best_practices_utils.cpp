@@ -2644,15 +2644,16 @@ bool BestPractices::ValidateCmdBeginRendering(VkCommandBuffer commandBuffer, con
     return skip;
 }
 
-void BestPractices::QueueValidateImageView(QueueCallbacks &funcs, const char* function_name,
+void BestPractices::QueueValidateImageView(DeferredCheckStream& checks, const char* function_name,
                                            IMAGE_VIEW_STATE* view, IMAGE_SUBRESOURCE_USAGE_BP usage) {
     if (view) {
         auto image_state = std::static_pointer_cast<bp_state::Image>(view->image_state);
-        QueueValidateImage(funcs, function_name, image_state, usage, view->normalized_subresource_range);
+        QueueValidateImage(checks, function_name, image_state, usage, view->normalized_subresource_range);
     }
 }
 
-void BestPractices::QueueValidateImage(QueueCallbacks& funcs, const char* function_name, std::shared_ptr<bp_state::Image>& state,
+void BestPractices::QueueValidateImage(DeferredCheckStream& checks, const char* function_name,
+                                       std::shared_ptr<bp_state::Image>& state,
                                        IMAGE_SUBRESOURCE_USAGE_BP usage, const VkImageSubresourceRange& subresource_range) {
     // If we're viewing a 3D slice, ignore base array layer.
     // The entire 3D subresource is accessed as one atomic unit.
@@ -2665,29 +2666,28 @@ void BestPractices::QueueValidateImage(QueueCallbacks& funcs, const char* functi
 
     for (uint32_t layer = 0; layer < array_layers; layer++) {
         for (uint32_t level = 0; level < mip_levels; level++) {
-            QueueValidateImage(funcs, function_name, state, usage, layer + base_array_layer,
+            QueueValidateImage(checks, function_name, state, usage, layer + base_array_layer,
                                level + subresource_range.baseMipLevel);
         }
     }
 }
 
-void BestPractices::QueueValidateImage(QueueCallbacks& funcs, const char* function_name, std::shared_ptr<bp_state::Image>& state,
+void BestPractices::QueueValidateImage(DeferredCheckStream& checks, const char* function_name,
+                                       std::shared_ptr<bp_state::Image>& state,
                                        IMAGE_SUBRESOURCE_USAGE_BP usage, const VkImageSubresourceLayers& subresource_layers) {
     const uint32_t max_layers = state->createInfo.arrayLayers - subresource_layers.baseArrayLayer;
     const uint32_t array_layers = std::min(subresource_layers.layerCount, max_layers);
 
     for (uint32_t layer = 0; layer < array_layers; layer++) {
-        QueueValidateImage(funcs, function_name, state, usage, layer + subresource_layers.baseArrayLayer, subresource_layers.mipLevel);
+        QueueValidateImage(checks, function_name, state, usage, layer + subresource_layers.baseArrayLayer, subresource_layers.mipLevel);
     }
 }
 
-void BestPractices::QueueValidateImage(QueueCallbacks& funcs, const char* function_name, std::shared_ptr<bp_state::Image>& state,
+void BestPractices::QueueValidateImage(DeferredCheckStream& checks, const char* function_name,
+                                       std::shared_ptr<bp_state::Image>& state,
                                        IMAGE_SUBRESOURCE_USAGE_BP usage, uint32_t array_layer, uint32_t mip_level) {
-    funcs.push_back([this, function_name, state, usage, array_layer, mip_level](
-                        const ValidationStateTracker& vst, const QUEUE_STATE& qs, const CMD_BUFFER_STATE& cbs) -> bool {
-        ValidateImageInQueue(qs, cbs, function_name, *state, usage, array_layer, mip_level);
-        return false;
-    });
+    checks.Append(DeferredCheckOp::kValidateImageInQueue,
+                  bp_state::CommandBuffer::ImageUsageCheck{state->image(), function_name, usage, array_layer, mip_level});
 }
 
 void BestPractices::ValidateImageInQueueArmImg(const char* function_name, const bp_state::Image& image,
@@ -2806,9 +2806,8 @@ void BestPractices::ValidateImageInQueue(const QUEUE_STATE& qs, const CMD_BUFFER
 }
 
 void BestPractices::AddDeferredQueueOperations(bp_state::CommandBuffer& cb) {
-    cb.queue_submit_functions.insert(cb.queue_submit_functions.end(), cb.queue_submit_functions_after_render_pass.begin(),
-                                     cb.queue_submit_functions_after_render_pass.end());
-    cb.queue_submit_functions_after_render_pass.clear();
+    cb.queue_submit_checks.Append(cb.queue_submit_checks_after_render_pass);
+    cb.queue_submit_checks_after_render_pass.clear();
 }
 
 void BestPractices::PreCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer) {
@@ -2963,7 +2962,7 @@ void BestPractices::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, cons
                 image_view = Get<IMAGE_VIEW_STATE>(framebuffer->createInfo.pAttachments[att]);
             }
 
-            QueueValidateImageView(cb->queue_submit_functions, "vkCmdBeginRenderPass()", image_view.get(), usage);
+            QueueValidateImageView(cb->queue_submit_checks, "vkCmdBeginRenderPass()", image_view.get(), usage);
         }
 
         // Check store ops
@@ -2999,7 +2998,7 @@ void BestPractices::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, cons
                 image_view = Get<IMAGE_VIEW_STATE>(framebuffer->createInfo.pAttachments[att]);
             }
 
-            QueueValidateImageView(cb->queue_submit_functions_after_render_pass, "vkCmdEndRenderPass()", image_view.get(), usage);
+            QueueValidateImageView(cb->queue_submit_checks_after_render_pass, "vkCmdEndRenderPass()", image_view.get(), usage);
         }
     }
 }
@@ -3921,7 +3920,7 @@ void BestPractices::ValidateBoundDescriptorSets(bp_state::CommandBuffer& cb_stat
 
                 if (image_view) {
                     auto image_view_state = Get<IMAGE_VIEW_STATE>(image_view);
-                    QueueValidateImageView(cb_state.queue_submit_functions, function_name, image_view_state.get(),
+                    QueueValidateImageView(cb_state.queue_submit_checks, function_name, image_view_state.get(),
                                            IMAGE_SUBRESOURCE_USAGE_BP::DESCRIPTOR_ACCESS);
                 }
             }
@@ -4681,42 +4680,42 @@ void BestPractices::PreCallRecordCmdResolveImage(VkCommandBuffer commandBuffer,
                                                  VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                                  const VkImageResolve* pRegions) {
     auto cb = GetWrite<bp_state::CommandBuffer>(commandBuffer);
-    auto &funcs = cb->queue_submit_functions;
+    auto &checks = cb->queue_submit_checks;
     auto src = Get<bp_state::Image>(srcImage);
     auto dst = Get<bp_state::Image>(dstImage);
 
     for (uint32_t i = 0; i < regionCount; i++) {
-        QueueValidateImage(funcs, "vkCmdResolveImage()", src, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_READ, pRegions[i].srcSubresource);
-        QueueValidateImage(funcs, "vkCmdResolveImage()", dst, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_WRITE, pRegions[i].dstSubresource);
+        QueueValidateImage(checks, "vkCmdResolveImage()", src, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_READ, pRegions[i].srcSubresource);
+        QueueValidateImage(checks, "vkCmdResolveImage()", dst, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_WRITE, pRegions[i].dstSubresource);
     }
 }
 
 void BestPractices::PreCallRecordCmdResolveImage2KHR(VkCommandBuffer commandBuffer,
                                                      const VkResolveImageInfo2KHR* pResolveImageInfo) {
     auto cb = GetWrite<bp_state::CommandBuffer>(commandBuffer);
-    auto &funcs = cb->queue_submit_functions;
+    auto &checks = cb->queue_submit_checks;
     auto src = Get<bp_state::Image>(pResolveImageInfo->srcImage);
     auto dst = Get<bp_state::Image>(pResolveImageInfo->dstImage);
     uint32_t regionCount = pResolveImageInfo->regionCount;
 
     for (uint32_t i = 0; i < regionCount; i++) {
-        QueueValidateImage(funcs, "vkCmdResolveImage2KHR()", src, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_READ, pResolveImageInfo->pRegions[i].srcSubresource);
-        QueueValidateImage(funcs, "vkCmdResolveImage2KHR()", dst, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_WRITE, pResolveImageInfo->pRegions[i].dstSubresource);
+        QueueValidateImage(checks, "vkCmdResolveImage2KHR()", src, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_READ, pResolveImageInfo->pRegions[i].srcSubresource);
+        QueueValidateImage(checks, "vkCmdResolveImage2KHR()", dst, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_WRITE, pResolveImageInfo->pRegions[i].dstSubresource);
     }
 }
 
 void BestPractices::PreCallRecordCmdResolveImage2(VkCommandBuffer commandBuffer,
                                                      const VkResolveImageInfo2* pResolveImageInfo) {
     auto cb = GetWrite<bp_state::CommandBuffer>(commandBuffer);
-    auto& funcs = cb->queue_submit_functions;
+    auto& checks = cb->queue_submit_checks;
     auto src = Get<bp_state::Image>(pResolveImageInfo->srcImage);
     auto dst = Get<bp_state::Image>(pResolveImageInfo->dstImage);
     uint32_t regionCount = pResolveImageInfo->regionCount;
 
     for (uint32_t i = 0; i < regionCount; i++) {
-        QueueValidateImage(funcs, "vkCmdResolveImage2()", src, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_READ,
+        QueueValidateImage(checks, "vkCmdResolveImage2()", src, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_READ,
                            pResolveImageInfo->pRegions[i].srcSubresource);
-        QueueValidateImage(funcs, "vkCmdResolveImage2()", dst, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_WRITE,
+        QueueValidateImage(checks, "vkCmdResolveImage2()", dst, IMAGE_SUBRESOURCE_USAGE_BP::RESOLVE_WRITE,
                            pResolveImageInfo->pRegions[i].dstSubresource);
     }
 }
@@ -4725,11 +4724,11 @@ void BestPractices::PreCallRecordCmdClearColorImage(VkCommandBuffer commandBuffe
                                                     const VkClearColorValue* pColor, uint32_t rangeCount,
                                                     const VkImageSubresourceRange* pRanges) {
     auto cb = GetWrite<bp_state::CommandBuffer>(commandBuffer);
-    auto &funcs = cb->queue_submit_functions;
+    auto &checks = cb->queue_submit_checks;
     auto dst = Get<bp_state::Image>(image);
 
     for (uint32_t i = 0; i < rangeCount; i++) {
-        QueueValidateImage(funcs, "vkCmdClearColorImage()", dst, IMAGE_SUBRESOURCE_USAGE_BP::CLEARED, pRanges[i]);
+        QueueValidateImage(checks, "vkCmdClearColorImage()", dst, IMAGE_SUBRESOURCE_USAGE_BP::CLEARED, pRanges[i]);
     }
 
     if (VendorCheckEnabled(kBPVendorNVIDIA)) {
@@ -4744,11 +4743,11 @@ void BestPractices::PreCallRecordCmdClearDepthStencilImage(VkCommandBuffer comma
                                                                    pRanges);
 
     auto cb = GetWrite<bp_state::CommandBuffer>(commandBuffer);
-    auto &funcs = cb->queue_submit_functions;
+    auto &checks = cb->queue_submit_checks;
     auto dst = Get<bp_state::Image>(image);
 
     for (uint32_t i = 0; i < rangeCount; i++) {
-        QueueValidateImage(funcs, "vkCmdClearDepthStencilImage()", dst, IMAGE_SUBRESOURCE_USAGE_BP::CLEARED, pRanges[i]);
+        QueueValidateImage(checks, "vkCmdClearDepthStencilImage()", dst, IMAGE_SUBRESOURCE_USAGE_BP::CLEARED, pRanges[i]);
     }
     if (VendorCheckEnabled(kBPVendorNVIDIA)) {
         for (uint32_t i = 0; i < rangeCount; i++) {
@@ -4764,13 +4763,13 @@ void BestPractices::PreCallRecordCmdCopyImage(VkCommandBuffer commandBuffer, VkI
                                                       regionCount, pRegions);
 
     auto cb = GetWrite<bp_state::CommandBuffer>(commandBuffer);
-    auto &funcs = cb->queue_submit_functions;
+    auto &checks = cb->queue_submit_checks;
     auto src = Get<bp_state::Image>(srcImage);
     auto dst = Get<bp_state::Image>(dstImage);
 
     for (uint32_t i = 0; i < regionCount; i++) {
-        QueueValidateImage(funcs, "vkCmdCopyImage()", src, IMAGE_SUBRESOURCE_USAGE_BP::COPY_READ, pRegions[i].srcSubresource);
-        QueueValidateImage(funcs, "vkCmdCopyImage()", dst, IMAGE_SUBRESOURCE_USAGE_BP::COPY_WRITE, pRegions[i].dstSubresource);
+        QueueValidateImage(checks, "vkCmdCopyImage()", src, IMAGE_SUBRESOURCE_USAGE_BP::COPY_READ, pRegions[i].srcSubresource);
+        QueueValidateImage(checks, "vkCmdCopyImage()", dst, IMAGE_SUBRESOURCE_USAGE_BP::COPY_WRITE, pRegions[i].dstSubresource);
     }
 }
 
@@ -4778,22 +4777,22 @@ void BestPractices::PreCallRecordCmdCopyBufferToImage(VkCommandBuffer commandBuf
                                                       VkImageLayout dstImageLayout, uint32_t regionCount,
                                                       const VkBufferImageCopy* pRegions) {
     auto cb = GetWrite<bp_state::CommandBuffer>(commandBuffer);
-    auto &funcs = cb->queue_submit_functions;
+    auto &checks = cb->queue_submit_checks;
     auto dst = Get<bp_state::Image>(dstImage);
 
     for (uint32_t i = 0; i < regionCount; i++) {
-        QueueValidateImage(funcs, "vkCmdCopyBufferToImage()", dst, IMAGE_SUBRESOURCE_USAGE_BP::COPY_WRITE, pRegions[i].imageSubresource);
+        QueueValidateImage(checks, "vkCmdCopyBufferToImage()", dst, IMAGE_SUBRESOURCE_USAGE_BP::COPY_WRITE, pRegions[i].imageSubresource);
     }
 }
 
 void BestPractices::PreCallRecordCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
                                                       VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions) {
     auto cb = GetWrite<bp_state::CommandBuffer>(commandBuffer);
-    auto &funcs = cb->queue_submit_functions;
+    auto &checks = cb->queue_submit_checks;
     auto src = Get<bp_state::Image>(srcImage);
 
     for (uint32_t i = 0; i < regionCount; i++) {
-        QueueValidateImage(funcs, "vkCmdCopyImageToBuffer()", src, IMAGE_SUBRESOURCE_USAGE_BP::COPY_READ, pRegions[i].imageSubresource);
+        QueueValidateImage(checks, "vkCmdCopyImageToBuffer()", src, IMAGE_SUBRESOURCE_USAGE_BP::COPY_READ, pRegions[i].imageSubresource);
     }
 }
 
@@ -4801,13 +4800,13 @@ void BestPractices::PreCallRecordCmdBlitImage(VkCommandBuffer commandBuffer, VkI
                                               VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                               const VkImageBlit* pRegions, VkFilter filter) {
     auto cb = GetWrite<bp_state::CommandBuffer>(commandBuffer);
-    auto &funcs = cb->queue_submit_functions;
+    auto &checks = cb->queue_submit_checks;
     auto src = Get<bp_state::Image>(srcImage);
     auto dst = Get<bp_state::Image>(dstImage);
 
     for (uint32_t i = 0; i < regionCount; i++) {
-        QueueValidateImage(funcs, "vkCmdBlitImage()", src, IMAGE_SUBRESOURCE_USAGE_BP::BLIT_READ, pRegions[i].srcSubresource);
-        QueueValidateImage(funcs, "vkCmdBlitImage()", dst, IMAGE_SUBRESOURCE_USAGE_BP::BLIT_WRITE, pRegions[i].dstSubresource);
+        QueueValidateImage(checks, "vkCmdBlitImage()", src, IMAGE_SUBRESOURCE_USAGE_BP::BLIT_READ, pRegions[i].srcSubresource);
+        QueueValidateImage(checks, "vkCmdBlitImage()", dst, IMAGE_SUBRESOURCE_USAGE_BP::BLIT_WRITE, pRegions[i].dstSubresource);
     }
 }
 
@@ -5221,16 +5220,8 @@ void BestPractices::RecordCmdPipelineBarrierImageBarrier(VkCommandBuffer command
     // Is a queue ownership acquisition barrier
     if (barrier.srcQueueFamilyIndex != barrier.dstQueueFamilyIndex &&
         barrier.dstQueueFamilyIndex == cb->command_pool->queueFamilyIndex) {
-        auto image = Get<bp_state::Image>(barrier.image);
-        auto subresource_range = barrier.subresourceRange;
-        cb->queue_submit_functions.push_back([image, subresource_range](const ValidationStateTracker& vst, const QUEUE_STATE& qs,
-                                                                        const CMD_BUFFER_STATE& cbs) -> bool {
-            ForEachSubresource(*image, subresource_range, [&](uint32_t layer, uint32_t level) {
-                // Update queue family index without changing usage, signifying a correct queue family transfer
-                image->UpdateUsage(layer, level, image->GetUsageType(layer, level), qs.queueFamilyIndex);
-            });
-            return false;
-        });
+        cb->queue_submit_checks.Append(DeferredCheckOp::kAcquireImageQueueFamily,
+                                       bp_state::CommandBuffer::ImageQueueFamilyAcquire{barrier.image, barrier.subresourceRange});
     }
 
     if (VendorCheckEnabled(kBPVendorNVIDIA)) {
@@ -5499,6 +5490,43 @@ void BestPractices::ManualPostCallRecordGetSwapchainImagesKHR(VkDevice device, V
     }
 }
 
+void BestPractices::ReplayQueueSubmitChecks(const QUEUE_STATE& qs, const bp_state::CommandBuffer& cb) {
+    // Consecutive records usually refer to the same image, one per subresource
+    std::shared_ptr<bp_state::Image> image;
+    auto get_image = [this, &image](VkImage handle) {
+        if (!image || image->image() != handle) {
+            image = Get<bp_state::Image>(handle);
+        }
+        return image.get();
+    };
+
+    for (const auto& record : cb.queue_submit_checks) {
+        switch (record.Op()) {
+            case DeferredCheckOp::kValidateImageInQueue: {
+                const auto& check = record.Get<bp_state::CommandBuffer::ImageUsageCheck>();
+                auto* state = get_image(check.image);
+                if (state) {
+                    ValidateImageInQueue(qs, cb, check.function_name, *state, check.usage, check.array_layer, check.mip_level);
+                }
+                break;
+            }
+            case DeferredCheckOp::kAcquireImageQueueFamily: {
+                const auto& acquire = record.Get<bp_state::CommandBuffer::ImageQueueFamilyAcquire>();
+                auto* state = get_image(acquire.image);
+                if (state) {
+                    ForEachSubresource(*state, acquire.subresource_range, [&](uint32_t layer, uint32_t level) {
+                        // Update queue family index without changing usage, signifying a correct queue family transfer
+                        state->UpdateUsage(layer, level, state->GetUsageType(layer, level), qs.queueFamilyIndex);
+                    });
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
 void BestPractices::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
     ValidationStateTracker::PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
 
@@ -5507,9 +5535,7 @@ void BestPractices::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount
         const auto& submit_info = pSubmits[submit];
         for (uint32_t cb_index = 0; cb_index < submit_info.commandBufferCount; cb_index++) {
             auto cb = GetWrite<bp_state::CommandBuffer>(submit_info.pCommandBuffers[cb_index]);
-            for (auto &func : cb->queue_submit_functions) {
-                func(*this, *queue_state, *cb);
-            }
+            ReplayQueueSubmitChecks(*queue_state, *cb);
             cb->num_submits++;
         }
     }
@@ -346,6 +346,19 @@ class CommandBuffer : public CMD_BUFFER_STATE {
     CommandBufferStateNV nv;
     uint64_t num_submits = 0;
     bool is_one_time_submit = false;
+
+    // Payloads of the DeferredCheckStream records owned by BestPractices
+    struct ImageUsageCheck {
+        VkImage image;
+        const char* function_name;
+        IMAGE_SUBRESOURCE_USAGE_BP usage;
+        uint32_t array_layer;
+        uint32_t mip_level;
+    };
+    struct ImageQueueFamilyAcquire {
+        VkImage image;
+        VkImageSubresourceRange subresource_range;
+    };
 };
 
 class DescriptorPool : public DESCRIPTOR_POOL_STATE {
@@ -705,16 +718,15 @@ class BestPractices : public ValidationStateTracker {
     bool PreCallValidateCmdResolveImage2(VkCommandBuffer commandBuffer,
                                          const VkResolveImageInfo2* pResolveImageInfo) const override;
 
-    using QueueCallbacks = std::vector<CMD_BUFFER_STATE::QueueCallback>;
-
-    void QueueValidateImageView(QueueCallbacks &func, const char* function_name,
+    void QueueValidateImageView(DeferredCheckStream& checks, const char* function_name,
                                 IMAGE_VIEW_STATE* view, IMAGE_SUBRESOURCE_USAGE_BP usage);
-    void QueueValidateImage(QueueCallbacks& func, const char* function_name, std::shared_ptr<bp_state::Image>& state,
+    void QueueValidateImage(DeferredCheckStream& checks, const char* function_name, std::shared_ptr<bp_state::Image>& state,
                             IMAGE_SUBRESOURCE_USAGE_BP usage, const VkImageSubresourceRange& subresource_range);
-    void QueueValidateImage(QueueCallbacks& func, const char* function_name, std::shared_ptr<bp_state::Image>& state,
+    void QueueValidateImage(DeferredCheckStream& checks, const char* function_name, std::shared_ptr<bp_state::Image>& state,
                             IMAGE_SUBRESOURCE_USAGE_BP usage, const VkImageSubresourceLayers& range);
-    void QueueValidateImage(QueueCallbacks& func, const char* function_name, std::shared_ptr<bp_state::Image>& state,
+    void QueueValidateImage(DeferredCheckStream& checks, const char* function_name, std::shared_ptr<bp_state::Image>& state,
                             IMAGE_SUBRESOURCE_USAGE_BP usage, uint32_t array_layer, uint32_t mip_level);
+    void ReplayQueueSubmitChecks(const QUEUE_STATE& qs, const bp_state::CommandBuffer& cb);
     void ValidateImageInQueue(const QUEUE_STATE& qs, const CMD_BUFFER_STATE& cbs, const char* function_name, bp_state::Image& state,
                               IMAGE_SUBRESOURCE_USAGE_BP usage, uint32_t array_layer, uint32_t mip_level);
     void ValidateImageInQueueArmImg(const char* function_name, const bp_state::Image& image, IMAGE_SUBRESOURCE_USAGE_BP last_usage,
@@ -1174,14 +1174,10 @@ void CoreChecks::RecordBarrierValidationInfo(const Location &loc, CMD_BUFFER_STA
         auto handle_state = BarrierHandleState(*this, barrier);
         bool mode_concurrent = handle_state ? handle_state->createInfo.sharingMode == VK_SHARING_MODE_CONCURRENT : false;
         if (!mode_concurrent) {
-            const auto typed_handle = BarrierTypedHandle(barrier);
-            core_error::LocationCapture loc_capture(loc);
-            cb_state->queue_submit_functions.emplace_back(
-                [loc_capture, typed_handle, src_queue_family, dst_queue_family](
-                    const ValidationStateTracker &device_data, const QUEUE_STATE &queue_state, const CMD_BUFFER_STATE &cb_state) {
-                    return ValidateConcurrentBarrierAtSubmit(loc_capture.Get(), device_data, queue_state, cb_state, typed_handle,
-                                                             src_queue_family, dst_queue_family);
-                });
+            assert(!loc.prev);
+            const CORE_CMD_BUFFER_STATE::ConcurrentBarrierCheck check{loc, BarrierTypedHandle(barrier), src_queue_family,
+                                                                      dst_queue_family};
+            cb_state->queue_submit_checks.Append(DeferredCheckOp::kValidateConcurrentBarrier, check);
         }
     }
 }
@@ -5789,6 +5785,44 @@ bool CoreChecks::ValidateConcurrentBarrierAtSubmit(const Location &loc, const Va
     return ValidatorState::ValidateAtQueueSubmit(&queue_state, &state_data, src_queue_family, dst_queue_family, val);
 }
 
+bool CoreChecks::ValidateQueueSubmitChecks(const QUEUE_STATE &queue_state, const CMD_BUFFER_STATE &cb_state) const {
+    bool skip = false;
+    for (const auto &record : cb_state.queue_submit_checks) {
+        switch (record.Op()) {
+            case DeferredCheckOp::kValidateConcurrentBarrier: {
+                const auto &check = record.Get<CORE_CMD_BUFFER_STATE::ConcurrentBarrierCheck>();
+                skip |= ValidateConcurrentBarrierAtSubmit(check.loc, *this, queue_state, cb_state, check.typed_handle,
+                                                          check.src_queue_family, check.dst_queue_family);
+                break;
+            }
+            case DeferredCheckOp::kValidateBufferCopyOverlap: {
+                using CopyCheck = CORE_CMD_BUFFER_STATE::BufferCopyOverlapCheck;
+                const auto &check = record.Get<CopyCheck>();
+                auto src_buffer_state = Get<BUFFER_STATE>(check.src_buffer);
+                auto dst_buffer_state = Get<BUFFER_STATE>(check.dst_buffer);
+                if (!src_buffer_state || !dst_buffer_state) break;
+                const auto *regions = record.Extra<CopyCheck, VkBufferCopy>();
+                for (uint32_t src = 0; src < check.region_count; ++src) {
+                    const sparse_container::range<VkDeviceSize> src_range{regions[src].srcOffset,
+                                                                          regions[src].srcOffset + regions[src].size};
+                    for (uint32_t dst = 0; dst < check.region_count; ++dst) {
+                        const sparse_container::range<VkDeviceSize> dst_range{regions[dst].dstOffset,
+                                                                              regions[dst].dstOffset + regions[dst].size};
+                        if (src_buffer_state->DoesResourceMemoryOverlap(src_range, dst_buffer_state.get(), dst_range)) {
+                            skip |= LogError(src_buffer_state->buffer(), check.vuid,
+                                             "%s: Detected overlap between source and dest regions in memory.", check.func_name);
+                        }
+                    }
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    return skip;
+}
+
 // Type specific wrapper for image barriers
 template <typename ImgBarrier>
 bool CoreChecks::ValidateBarrierQueueFamilies(const Location &loc, const CMD_BUFFER_STATE *cb_state, const ImgBarrier &barrier,
@@ -6859,32 +6893,15 @@ void CoreChecks::RecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer src
     if (src_buffer_state->sparse || dst_buffer_state->sparse) {
         auto cb_state_ptr = Get<CMD_BUFFER_STATE>(commandBuffer);
 
-        std::vector<sparse_container::range<VkDeviceSize>> src_ranges;
-        std::vector<sparse_container::range<VkDeviceSize>> dst_ranges;
-
+        std::vector<VkBufferCopy> regions(regionCount);
         for (uint32_t i = 0u; i < regionCount; ++i) {
-            const RegionType &region = pRegions[i];
-            src_ranges.emplace_back(sparse_container::range<VkDeviceSize>{region.srcOffset, region.srcOffset + region.size});
-            dst_ranges.emplace_back(sparse_container::range<VkDeviceSize>{region.dstOffset, region.dstOffset + region.size});
-        }
-
-        auto queue_submit_validation = [this, src_buffer_state, dst_buffer_state, src_ranges, dst_ranges, vuid, func_name](
-                                           const ValidationStateTracker &device_data, const class QUEUE_STATE &queue_state,
-                                           const CMD_BUFFER_STATE &cb_state) -> bool {
-            bool skip = false;
-            for (const auto &src : src_ranges) {
-                for (const auto &dst : dst_ranges) {
-                    if (src_buffer_state->DoesResourceMemoryOverlap(src, dst_buffer_state.get(), dst)) {
-                        skip |= this->LogError(src_buffer_state->buffer(), vuid,
-                                               "%s: Detected overlap between source and dest regions in memory.", func_name);
-                    }
-                }
-            }
-
-            return skip;
-        };
+            regions[i] = {pRegions[i].srcOffset, pRegions[i].dstOffset, pRegions[i].size};
+        }
 
-        cb_state_ptr->queue_submit_functions.emplace_back(queue_submit_validation);
+        cb_state_ptr->queue_submit_checks.Append(
+            DeferredCheckOp::kValidateBufferCopyOverlap,
+            CORE_CMD_BUFFER_STATE::BufferCopyOverlapCheck{srcBuffer, dstBuffer, vuid, func_name, regionCount}, regions.data(),
+            regionCount);
     }
 }
 
@@ -133,7 +133,8 @@ void CMD_BUFFER_STATE::Reset() {
     image_layout_change_count = 1;  // Start at 1. 0 is insert value for validation cache versions, s.t. new == dirty
     status.reset();
     static_status.reset();
-    inheritedViewportDepths.clear();
+    layer_data::ReleaseArenaStorage(inheritedViewportDepths);
+    layer_data::ReleaseArenaStorage(dynamicViewports);
     usedViewportScissorCount = 0;
     pipelineStaticViewportCount = 0;
     pipelineStaticScissorCount = 0;
@@ -161,8 +162,8 @@ void CMD_BUFFER_STATE::Reset() {
     activeSubpass = 0;
     broken_bindings.clear();
     waitedEvents.clear();
-    events.clear();
-    writeEventsBeforeWait.clear();
+    layer_data::ReleaseArenaStorage(events);
+    layer_data::ReleaseArenaStorage(writeEventsBeforeWait);
     activeQueries.clear();
     startedQueries.clear();
     image_layout_map.clear();
@@ -176,11 +177,11 @@ void CMD_BUFFER_STATE::Reset() {
     // Remove reverse command buffer links.
     Invalidate(true);
 
-    queue_submit_functions.clear();
-    queue_submit_functions_after_render_pass.clear();
-    cmd_execute_commands_functions.clear();
-    eventUpdates.clear();
-    queryUpdates.clear();
+    queue_submit_checks.Release();
+    queue_submit_checks_after_render_pass.Release();
+    layer_data::ReleaseArenaStorage(cmd_execute_commands_functions);
+    event_updates.Release();
+    query_updates.Release();
 
     // Remove object bindings
     for (const auto &obj : object_bindings) {
@@ -205,12 +206,19 @@ void CMD_BUFFER_STATE::Reset() {
     // Clean up the label data
     debug_label.Reset();
     validate_descriptorsets_in_queuesubmit.clear();
+    layer_data::ReleaseArenaStorage(push_constant_data);
+    push_constant_data_ranges.reset();
+    push_constant_data_update.clear();
+    push_constant_pipeline_layout_set = VK_NULL_HANDLE;
 
     // Best practices info
     small_indexed_draw_call_count = 0;
 
     transform_feedback_active = false;
 
+    // Every container backed by recording_arena has been released above
+    recording_arena.Reset();
+
     // Clean up the label data
     ResetCmdDebugUtilsLabel(dev_data->report_data, commandBuffer());
 }
@@ -375,20 +383,13 @@ static bool SetQueryState(const QueryObject &object, QueryState value, QueryMap
 void CMD_BUFFER_STATE::BeginQuery(const QueryObject &query_obj) {
     activeQueries.insert(query_obj);
     startedQueries.insert(query_obj);
-    queryUpdates.emplace_back([query_obj](CMD_BUFFER_STATE &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                          uint32_t perfQueryPass, QueryMap *localQueryToStateMap) {
-        SetQueryState(QueryObject(query_obj, perfQueryPass), QUERYSTATE_RUNNING, localQueryToStateMap);
-        return false;
-    });
+    query_updates.Append(DeferredCheckOp::kSetQueryState, QueryStateUpdate{query_obj, QUERYSTATE_RUNNING});
     updatedQueries.insert(query_obj);
 }
 
 void CMD_BUFFER_STATE::EndQuery(const QueryObject &query_obj) {
     activeQueries.erase(query_obj);
-    queryUpdates.emplace_back([query_obj](CMD_BUFFER_STATE &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                          uint32_t perfQueryPass, QueryMap *localQueryToStateMap) {
-        return SetQueryState(QueryObject(query_obj, perfQueryPass), QUERYSTATE_ENDED, localQueryToStateMap);
-    });
+    query_updates.Append(DeferredCheckOp::kSetQueryState, QueryStateUpdate{query_obj, QUERYSTATE_ENDED});
     updatedQueries.insert(query_obj);
 }
 
@@ -420,11 +421,8 @@ void CMD_BUFFER_STATE::EndQueries(VkQueryPool queryPool, uint32_t firstQuery, ui
         activeQueries.erase(query);
         updatedQueries.insert(query);
     }
-    queryUpdates.emplace_back([queryPool, firstQuery, queryCount](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                                  VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
-                                                                  QueryMap *localQueryToStateMap) {
-        return SetQueryStateMulti(queryPool, firstQuery, queryCount, perfQueryPass, QUERYSTATE_ENDED, localQueryToStateMap);
-    });
+    query_updates.Append(DeferredCheckOp::kSetQueryStateRange,
+                         QueryRangeStateUpdate{queryPool, firstQuery, queryCount, QUERYSTATE_ENDED});
 }
 
 void CMD_BUFFER_STATE::ResetQueryPool(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
@@ -434,11 +432,8 @@ void CMD_BUFFER_STATE::ResetQueryPool(VkQueryPool queryPool, uint32_t firstQuery
         updatedQueries.insert(query);
     }
 
-    queryUpdates.emplace_back([queryPool, firstQuery, queryCount](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                                  VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
-                                                                  QueryMap *localQueryToStateMap) {
-        return SetQueryStateMulti(queryPool, firstQuery, queryCount, perfQueryPass, QUERYSTATE_RESET, localQueryToStateMap);
-    });
+    query_updates.Append(DeferredCheckOp::kSetQueryStateRange,
+                         QueryRangeStateUpdate{queryPool, firstQuery, queryCount, QUERYSTATE_RESET});
 }
 
 void UpdateSubpassAttachments(const safe_VkSubpassDescription2 &subpass, std::vector<SUBPASS_INFO> &subpasses) {
@@ -765,23 +760,10 @@ void CMD_BUFFER_STATE::ExecuteCommands(uint32_t commandBuffersCount, const VkCom
         AddChild(sub_cb_state);
         // Add a query update that runs all the query updates that happen in the sub command buffer.
         // This avoids locking ambiguity because primary command buffers are locked when these
-        // callbacks run, but secondary command buffers are not.
-        queryUpdates.push_back([sub_command_buffer](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                    VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
-                                                    QueryMap *localQueryToStateMap) {
-            bool skip = false;
-            auto sub_cb_state_arg = cb_state_arg.dev_data->GetWrite<CMD_BUFFER_STATE>(sub_command_buffer);
-            for (auto &function : sub_cb_state_arg->queryUpdates) {
-                skip |= function(*sub_cb_state_arg, do_validate, firstPerfQueryPool, perfQueryPass, localQueryToStateMap);
-            }
-            return skip;
-        });
-        for (auto &function : sub_cb_state->eventUpdates) {
-            eventUpdates.push_back(function);
-        }
-        for (auto &function : sub_cb_state->queue_submit_functions) {
-            queue_submit_functions.push_back(function);
-        }
+        // records are replayed, but secondary command buffers are not.
+        query_updates.Append(DeferredCheckOp::kReplaySecondaryQueries, sub_command_buffer);
+        event_updates.Append(sub_cb_state->event_updates);
+        queue_submit_checks.Append(sub_cb_state->queue_submit_checks);
 
         // State is trashed after executing secondary command buffers.
         // Importantly, this function runs after CoreChecks::PreCallValidateCmdExecuteCommands.
@@ -1144,9 +1126,7 @@ void CMD_BUFFER_STATE::RecordSetEvent(CMD_TYPE cmd_type, VkEvent event, VkPipeli
     if (!waitedEvents.count(event)) {
         writeEventsBeforeWait.push_back(event);
     }
-    eventUpdates.emplace_back([event, stageMask](CMD_BUFFER_STATE &, bool do_validate, EventToStageMap *localEventToStageMap) {
-        return SetEventStageMask(event, stageMask, localEventToStageMap);
-    });
+    event_updates.Append(DeferredCheckOp::kSetEventStageMask, EventStageMaskUpdate{event, stageMask});
 }
 
 void CMD_BUFFER_STATE::RecordResetEvent(CMD_TYPE cmd_type, VkEvent event, VkPipelineStageFlags2KHR stageMask) {
@@ -1162,9 +1142,7 @@ void CMD_BUFFER_STATE::RecordResetEvent(CMD_TYPE cmd_type, VkEvent event, VkPipe
         writeEventsBeforeWait.push_back(event);
     }
 
-    eventUpdates.emplace_back([event](CMD_BUFFER_STATE &, bool do_validate, EventToStageMap *localEventToStageMap) {
-        return SetEventStageMask(event, VkPipelineStageFlags2KHR(0), localEventToStageMap);
-    });
+    event_updates.Append(DeferredCheckOp::kSetEventStageMask, EventStageMaskUpdate{event, VkPipelineStageFlags2KHR(0)});
 }
 
 void CMD_BUFFER_STATE::RecordWaitEvents(CMD_TYPE cmd_type, uint32_t eventCount, const VkEvent *pEvents,
@@ -1231,22 +1209,64 @@ void CMD_BUFFER_STATE::RecordWriteTimestamp(CMD_TYPE cmd_type, VkPipelineStageFl
     EndQuery(query);
 }
 
+bool CMD_BUFFER_STATE::ReplayQueryUpdates(bool do_validate, VkQueryPool &first_perf_query_pool, uint32_t perf_pass,
+                                          QueryMap *local_query_to_state_map) const {
+    bool skip = false;
+    for (const auto &record : query_updates) {
+        switch (record.Op()) {
+            case DeferredCheckOp::kSetQueryState: {
+                const auto &update = record.Get<QueryStateUpdate>();
+                SetQueryState(QueryObject(update.query, perf_pass), update.state, local_query_to_state_map);
+                break;
+            }
+            case DeferredCheckOp::kSetQueryStateRange: {
+                const auto &update = record.Get<QueryRangeStateUpdate>();
+                SetQueryStateMulti(update.pool, update.first_query, update.query_count, perf_pass, update.state,
+                                   local_query_to_state_map);
+                break;
+            }
+            case DeferredCheckOp::kReplaySecondaryQueries: {
+                auto sub_cb_state = dev_data->GetWrite<CMD_BUFFER_STATE>(record.Get<VkCommandBuffer>());
+                if (!sub_cb_state) {
+                    // The secondary was destroyed after being recorded, invalidating this command buffer
+                    continue;
+                }
+                skip |= sub_cb_state->ReplayQueryUpdates(do_validate, first_perf_query_pool, perf_pass, local_query_to_state_map);
+                break;
+            }
+            default:
+                skip |= ReplayQueryRecord(record, do_validate, first_perf_query_pool, perf_pass, local_query_to_state_map);
+                break;
+        }
+    }
+    return skip;
+}
+
+bool CMD_BUFFER_STATE::ReplayEventUpdates(bool do_validate, EventToStageMap *local_event_to_stage_map) const {
+    bool skip = false;
+    for (const auto &record : event_updates) {
+        if (record.Op() == DeferredCheckOp::kSetEventStageMask) {
+            const auto &update = record.Get<EventStageMaskUpdate>();
+            SetEventStageMask(update.event, update.stage_mask, local_event_to_stage_map);
+        } else {
+            skip |= ReplayEventRecord(record, do_validate, local_event_to_stage_map);
+        }
+    }
+    return skip;
+}
+
 void CMD_BUFFER_STATE::Submit(uint32_t perf_submit_pass) {
     VkQueryPool first_pool = VK_NULL_HANDLE;
     EventToStageMap local_event_to_stage_map;
     QueryMap local_query_to_state_map;
-    for (auto &function : queryUpdates) {
-        function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
-    }
+    ReplayQueryUpdates(/*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
 
     for (const auto &query_state_pair : local_query_to_state_map) {
         auto query_pool_state = dev_data->Get<QUERY_POOL_STATE>(query_state_pair.first.pool);
         query_pool_state->SetQueryState(query_state_pair.first.query, query_state_pair.first.perf_pass, query_state_pair.second);
     }
 
-    for (const auto &function : eventUpdates) {
-        function(*this, /*do_validate*/ false, &local_event_to_stage_map);
-    }
+    ReplayEventUpdates(/*do_validate*/ false, &local_event_to_stage_map);
 
     for (const auto &eventStagePair : local_event_to_stage_map) {
         auto event_state = dev_data->Get<EVENT_STATE>(eventStagePair.first);
@@ -1264,9 +1284,7 @@ void CMD_BUFFER_STATE::Retire(uint32_t perf_submit_pass, const std::function<boo
     }
     QueryMap local_query_to_state_map;
     VkQueryPool first_pool = VK_NULL_HANDLE;
-    for (auto &function : queryUpdates) {
-        function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
-    }
+    ReplayQueryUpdates(/*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
 
     for (const auto &query_state_pair : local_query_to_state_map) {
         if (query_state_pair.second == QUERYSTATE_ENDED && !is_query_updated_after(query_state_pair.first)) {
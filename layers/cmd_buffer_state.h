@@ -35,6 +35,7 @@
 #include "device_state.h"
 #include "descriptor_sets.h"
 #include "qfo_transfer.h"
+#include "deferred_check_stream.h"
 
 struct SUBPASS_INFO;
 class FRAMEBUFFER_STATE;
@@ -190,6 +191,14 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     std::shared_ptr<const CMD_BUFFER_STATE> shared_from_this() const { return SharedFromThisImpl(this); }
     std::shared_ptr<CMD_BUFFER_STATE> shared_from_this() { return SharedFromThisImpl(this); }
 
+    // Backing store for per-recording containers, released in one step by Reset(). Must be declared before, and so destroyed
+    // after, every container allocating from it.
+    layer_data::MonotonicArena recording_arena;
+    template <typename T>
+    layer_data::ArenaAllocator<T> RecordingAllocator() {
+        return layer_data::ArenaAllocator<T>(&recording_arena);
+    }
+
     using DescriptorBindingInfo = std::pair<const uint32_t, DescriptorRequirement>;
     struct CmdDrawDispatchInfo {
         CMD_TYPE cmd_type;
@@ -197,12 +206,27 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
         VkFramebuffer framebuffer;
         std::shared_ptr<std::vector<SUBPASS_INFO>> subpasses;
         std::shared_ptr<std::vector<IMAGE_VIEW_STATE *>> attachments;
+        // Sum of the set's change count and, for sets with bindless bindings, ValidationStateTracker::BindlessResourceGeneration()
+        // at the last submit time validation of this draw that found no errors. Both only grow, so an unchanged sum means neither
+        // changed. Updated from the const submit validation path, which concurrent submits of a simultaneous use command buffer
+        // can run at once.
+        struct ValidatedEpoch {
+            std::atomic<uint64_t> value{~0ULL};
+            ValidatedEpoch() = default;
+            ValidatedEpoch(const ValidatedEpoch &other) : value(other.value.load(std::memory_order_relaxed)) {}
+            ValidatedEpoch &operator=(const ValidatedEpoch &other) {
+                value.store(other.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                return *this;
+            }
+        };
+        mutable ValidatedEpoch validated_epoch;
     };
-    layer_data::unordered_map<VkDescriptorSet, std::vector<CmdDrawDispatchInfo>> validate_descriptorsets_in_queuesubmit;
+    layer_data::unordered_map<VkDescriptorSet, layer_data::arena_vector<CmdDrawDispatchInfo>>
+        validate_descriptorsets_in_queuesubmit;
 
     // If VK_NV_inherited_viewport_scissor is enabled and VkCommandBufferInheritanceViewportScissorInfoNV::viewportScissor2D is
     // true, then is the nonempty list of viewports passed in pViewportDepths. Otherwise, this is empty.
-    std::vector<VkViewport> inheritedViewportDepths;
+    layer_data::arena_vector<VkViewport> inheritedViewportDepths{RecordingAllocator<VkViewport>()};
 
     // For each draw command D recorded to this command buffer, let
     //  * g_D be the graphics pipeline used
@@ -222,7 +246,7 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
 
     // Dynamic viewports set in this command buffer; if bit j of viewportMask is set then dynamicViewports[j] is valid, but the
     // converse need not be true.
-    std::vector<VkViewport> dynamicViewports;
+    layer_data::arena_vector<VkViewport> dynamicViewports{RecordingAllocator<VkViewport>()};
 
     // Bits set when binding graphics pipeline defining corresponding static state, or executing any secondary command buffer.
     // Bits unset by calling a corresponding vkCmdSet[State] cmd.
@@ -260,8 +284,8 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     QFOTransferBarrierSets<QFOImageTransferBarrier> qfo_transfer_image_barriers;
 
     layer_data::unordered_set<VkEvent> waitedEvents;
-    std::vector<VkEvent> writeEventsBeforeWait;
-    std::vector<VkEvent> events;
+    layer_data::arena_vector<VkEvent> writeEventsBeforeWait{RecordingAllocator<VkEvent>()};
+    layer_data::arena_vector<VkEvent> events{RecordingAllocator<VkEvent>()};
     layer_data::unordered_set<QueryObject> activeQueries;
     layer_data::unordered_set<QueryObject> startedQueries;
     layer_data::unordered_set<QueryObject> resetQueries;
@@ -274,21 +298,18 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     VkCommandBuffer primaryCommandBuffer;
     // If primary, the secondary command buffers we will call.
     layer_data::unordered_set<CMD_BUFFER_STATE *> linkedCommandBuffers;
-    // Validation functions run at primary CB queue submit time
-    using QueueCallback = std::function<bool(const ValidationStateTracker &device_data, const class QUEUE_STATE &queue_state,
-                                             const CMD_BUFFER_STATE &cb_state)>;
-    std::vector<QueueCallback> queue_submit_functions;
+    // Checks run at primary CB queue submit time. The records are layer specific; the owning validation object replays them.
+    DeferredCheckStream queue_submit_checks{RecordingAllocator<uint64_t>()};
     // Used by some layers to defer actions until vkCmdEndRenderPass time.
-    // Layers using this are responsible for inserting the callbacks into queue_submit_functions.
-    std::vector<QueueCallback> queue_submit_functions_after_render_pass;
+    // Layers using this are responsible for appending these records to queue_submit_checks.
+    DeferredCheckStream queue_submit_checks_after_render_pass{RecordingAllocator<uint64_t>()};
     // Validation functions run when secondary CB is executed in primary
-    std::vector<std::function<bool(const CMD_BUFFER_STATE &secondary, const CMD_BUFFER_STATE *primary, const FRAMEBUFFER_STATE *)>>
-        cmd_execute_commands_functions;
-    std::vector<std::function<bool(CMD_BUFFER_STATE &cb_state, bool do_validate, EventToStageMap *localEventToStageMap)>>
-        eventUpdates;
-    std::vector<std::function<bool(CMD_BUFFER_STATE &cb_state, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                   uint32_t perfQueryPass, QueryMap *localQueryToStateMap)>>
-        queryUpdates;
+    using ExecuteCommandsCallback =
+        std::function<bool(const CMD_BUFFER_STATE &secondary, const CMD_BUFFER_STATE *primary, const FRAMEBUFFER_STATE *)>;
+    layer_data::arena_vector<ExecuteCommandsCallback> cmd_execute_commands_functions{RecordingAllocator<ExecuteCommandsCallback>()};
+    // Event and query state changes applied at submit time, see ReplayEventUpdates() and ReplayQueryUpdates()
+    DeferredCheckStream event_updates{RecordingAllocator<uint64_t>()};
+    DeferredCheckStream query_updates{RecordingAllocator<uint64_t>()};
     layer_data::unordered_map<const cvdescriptorset::DescriptorSet *, cvdescriptorset::DescriptorSet::CachedValidation>
         descriptorset_cache;
     IndexBufferBinding index_buffer_binding;
@@ -298,7 +319,7 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     // Cache of current insert label...
     LoggingLabel debug_label;
 
-    std::vector<uint8_t> push_constant_data;
+    layer_data::arena_vector<uint8_t> push_constant_data{RecordingAllocator<uint8_t>()};
     PushConstantRangesId push_constant_data_ranges;
 
     std::map<VkShaderStageFlagBits, std::vector<uint8_t>>
@@ -465,6 +486,28 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     void Submit(uint32_t perf_submit_pass);
     void Retire(uint32_t perf_submit_pass, const std::function<bool(const QueryObject &)> &is_query_updated_after);
 
+    // Payloads of the DeferredCheckStream records owned by the state tracker
+    struct QueryStateUpdate {
+        QueryObject query;
+        QueryState state;
+    };
+    struct QueryRangeStateUpdate {
+        VkQueryPool pool;
+        uint32_t first_query;
+        uint32_t query_count;
+        QueryState state;
+    };
+    struct EventStageMaskUpdate {
+        VkEvent event;
+        VkPipelineStageFlags2KHR stage_mask;
+    };
+
+    // Apply the query and event updates of one submission to local mirrors of the device state. With do_validate set, the
+    // deferred checks of the derived layer run as well.
+    bool ReplayQueryUpdates(bool do_validate, VkQueryPool &first_perf_query_pool, uint32_t perf_pass,
+                            QueryMap *local_query_to_state_map) const;
+    bool ReplayEventUpdates(bool do_validate, EventToStageMap *local_event_to_stage_map) const;
+
     uint32_t GetDynamicColorAttachmentCount() const {
         if (activeRenderPass) {
             if (activeRenderPass->use_dynamic_rendering_inherited) {
@@ -516,6 +559,16 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     void NotifyInvalidate(const BASE_NODE::NodeList &invalid_nodes, bool unlink) override;
     void UpdateAttachmentsView(const VkRenderPassBeginInfo *pRenderPassBegin);
     void UnbindResources();
+
+    // Replay a query_updates or event_updates record whose op is not owned by the state tracker
+    virtual bool ReplayQueryRecord(const DeferredCheckStream::Record &record, bool do_validate, VkQueryPool &first_perf_query_pool,
+                                   uint32_t perf_pass, QueryMap *local_query_to_state_map) const {
+        return false;
+    }
+    virtual bool ReplayEventRecord(const DeferredCheckStream::Record &record, bool do_validate,
+                                   EventToStageMap *local_event_to_stage_map) const {
+        return false;
+    }
 };
 
 // specializations for barriers that cannot do queue family ownership transfers
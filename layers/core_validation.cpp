@@ -48,6 +48,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <random>
 #include <set>
 #include <sstream>
 #include <stdio.h>
@@ -4713,40 +4714,18 @@ void CoreChecks::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
 
     // Allocate shader validation cache
     if (!disabled[shader_validation_caching] && !disabled[shader_validation] && !core_validation_cache) {
-        auto tmp_path = GetEnvironment("XDG_CACHE_HOME");
-        if (!tmp_path.size()) {
-            auto cachepath = GetEnvironment("HOME") + "/.cache";
-            struct stat info;
-            if (stat(cachepath.c_str(), &info) == 0) {
-                if ((info.st_mode & S_IFMT) == S_IFDIR) {
-                    tmp_path = cachepath;
-                }
-            }
-        }
-        if (!tmp_path.size()) tmp_path = GetEnvironment("TMPDIR");
-        if (!tmp_path.size()) tmp_path = GetEnvironment("TMP");
-        if (!tmp_path.size()) tmp_path = GetEnvironment("TEMP");
-        if (!tmp_path.size()) tmp_path = "/tmp";
-        validation_cache_path = tmp_path + "/shader_validation_cache";
-#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
-        validation_cache_path += "-" + std::to_string(getuid());
-#endif
-        validation_cache_path += ".bin";
+        validation_cache_path = GetLayerCacheFilePath("shader_validation_cache");
 
-        std::vector<char> validation_cache_data;
-        std::ifstream read_file(validation_cache_path.c_str(), std::ios::in | std::ios::binary);
-
-        if (read_file) {
-            std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(validation_cache_data));
-            read_file.close();
-        } else {
+        // The cache is parsed straight from the mapping, which is released once the entries have been read
+        LayerMappedFile validation_cache_file(validation_cache_path);
+        if (!validation_cache_file.Data()) {
             LogInfo(device, "UNASSIGNED-cache-file-error",
                     "Cannot open shader validation cache at %s for reading (it may not exist yet)", validation_cache_path.c_str());
         }
 
         VkValidationCacheCreateInfoEXT cacheCreateInfo = LvlInitStruct<VkValidationCacheCreateInfoEXT>();
-        cacheCreateInfo.initialDataSize = validation_cache_data.size();
-        cacheCreateInfo.pInitialData = validation_cache_data.data();
+        cacheCreateInfo.initialDataSize = validation_cache_file.Size();
+        cacheCreateInfo.pInitialData = validation_cache_file.Data();
         cacheCreateInfo.flags = 0;
         CoreLayerCreateValidationCacheEXT(device, &cacheCreateInfo, nullptr, &core_validation_cache);
     }
@@ -4778,10 +4757,20 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
         }
 
         if (validation_cache_path.size() > 0) {
-            std::ofstream write_file(validation_cache_path.c_str(), std::ios::out | std::ios::binary);
+            // Write to a temporary file that replaces the cache once complete, so that a process mapping the cache while it is
+            // written never sees the file shrink or change under it
+            const std::string temp_path = validation_cache_path + "." + std::to_string(std::random_device{}()) + ".tmp";
+            std::ofstream write_file(temp_path.c_str(), std::ios::out | std::ios::binary);
             if (write_file) {
                 write_file.write(static_cast<char *>(validation_cache_data), validation_cache_size);
                 write_file.close();
+                if (std::rename(temp_path.c_str(), validation_cache_path.c_str()) != 0) {
+                    // rename does not replace an existing file on all platforms
+                    std::remove(validation_cache_path.c_str());
+                    if (std::rename(temp_path.c_str(), validation_cache_path.c_str()) != 0) {
+                        std::remove(temp_path.c_str());
+                    }
+                }
             } else {
                 LogInfo(device, "UNASSIGNED-cache-write-error", "Cannot open shader validation cache at %s for writing",
                         validation_cache_path.c_str());
@@ -5491,48 +5480,116 @@ struct CommandBufferSubmitState {
 
     CommandBufferSubmitState(const CoreChecks *c, const char *func, const QUEUE_STATE *q) : core(c), queue_state(q) {}
 
-    bool Validate(const core_error::Location &loc, const CMD_BUFFER_STATE &cb_state, uint32_t perf_pass) {
+    // Total descriptor count of the draws to validate above which the checks are spread across the worker pool
+    static constexpr uint32_t kParallelDescriptorThreshold = 4096;
+
+    struct DescriptorCheck {
+        const cvdescriptorset::DescriptorSet *set_node;
+        const CMD_BUFFER_STATE::CmdDrawDispatchInfo *cmd_info;
+        uint64_t epoch;
+    };
+
+    bool ValidateDescriptorSet(const core_error::Location &loc, const CMD_BUFFER_STATE &cb_state,
+                               const DescriptorCheck &check) const {
         bool skip = false;
-        skip |= core->ValidateCmdBufImageLayouts(loc, cb_state, overlay_image_layout_map);
-        auto cmd = cb_state.commandBuffer();
-        current_cmds.push_back(cmd);
-        skip |= core->ValidatePrimaryCommandBufferState(loc, cb_state,
-                                                        static_cast<int>(std::count(current_cmds.begin(), current_cmds.end(), cmd)),
-                                                        &qfo_image_scoreboards, &qfo_buffer_scoreboards);
-        skip |= core->ValidateQueueFamilyIndices(loc, cb_state, queue_state->Queue());
+        const auto &set_node = *check.set_node;
+        const auto &cmd_info = *check.cmd_info;
+        // dynamic data isn't allowed in UPDATE_AFTER_BIND, so dynamicOffsets is always empty.
+        std::vector<uint32_t> dynamic_offsets;
+        layer_data::optional<layer_data::unordered_map<VkImageView, VkImageLayout>> checked_layouts;
+
+        std::string function = loc.StringFunc();
+        function += ", ";
+        function += CommandTypeString(cmd_info.cmd_type);
+        CoreChecks::DescriptorContext context{function.c_str(),
+                                              core->GetDrawDispatchVuid(cmd_info.cmd_type),
+                                              cb_state,
+                                              set_node,
+                                              cmd_info.framebuffer,
+                                              false,  // This is submit time not record time...
+                                              dynamic_offsets,
+                                              checked_layouts};
+
+        for (const auto &binding_info : cmd_info.binding_infos) {
+            std::string error;
+            if (set_node.GetTotalDescriptorCount() > cvdescriptorset::PrefilterBindRequestMap::kManyDescriptors_) {
+                context.checked_layouts.emplace();
+            }
+            const auto *binding = set_node.GetBinding(binding_info.first);
+            skip |= core->ValidateDescriptorSetBindingData(context, binding_info, *binding);
+        }
+        return skip;
+    }
 
+    bool ValidateDescriptorSets(const core_error::Location &loc, const CMD_BUFFER_STATE &cb_state) const {
+        bool skip = false;
+        // Draws whose descriptor set and referenced objects are unchanged since they last validated cleanly are skipped
+        const uint64_t bindless_generation = core->BindlessResourceGeneration();
+        std::vector<std::shared_ptr<const cvdescriptorset::DescriptorSet>> set_nodes;
+        std::vector<DescriptorCheck> checks;
+        uint64_t descriptor_count = 0;
         for (const auto &descriptor_set : cb_state.validate_descriptorsets_in_queuesubmit) {
             auto set_node = core->Get<cvdescriptorset::DescriptorSet>(descriptor_set.first);
             if (!set_node) {
                 continue;
             }
+            const uint64_t epoch = set_node->GetChangeCount() + (set_node->HasBindlessBindings() ? bindless_generation : 0);
             for (const auto &cmd_info : descriptor_set.second) {
-                // dynamic data isn't allowed in UPDATE_AFTER_BIND, so dynamicOffsets is always empty.
-                std::vector<uint32_t> dynamic_offsets;
-                layer_data::optional<layer_data::unordered_map<VkImageView, VkImageLayout>> checked_layouts;
-
-                std::string function = loc.StringFunc();
-                function += ", ";
-                function += CommandTypeString(cmd_info.cmd_type);
-                CoreChecks::DescriptorContext context{function.c_str(),
-                                                      core->GetDrawDispatchVuid(cmd_info.cmd_type),
-                                                      cb_state,
-                                                      *set_node,
-                                                      cmd_info.framebuffer,
-                                                      false,  // This is submit time not record time...
-                                                      dynamic_offsets,
-                                                      checked_layouts};
-
-                for (const auto &binding_info : cmd_info.binding_infos) {
-                    std::string error;
-                    if (set_node->GetTotalDescriptorCount() > cvdescriptorset::PrefilterBindRequestMap::kManyDescriptors_) {
-                        context.checked_layouts.emplace();
-                    }
-                    const auto *binding = set_node->GetBinding(binding_info.first);
-                    skip |= core->ValidateDescriptorSetBindingData(context, binding_info, *binding);
+                if (cmd_info.validated_epoch.value.load(std::memory_order_relaxed) == epoch) {
+                    continue;
+                }
+                checks.emplace_back(DescriptorCheck{set_node.get(), &cmd_info, epoch});
+                descriptor_count += set_node->GetTotalDescriptorCount();
+            }
+            set_nodes.emplace_back(std::move(set_node));
+        }
+
+        WorkerPool *pool = core->GetWorkerPool();
+        if (!pool || checks.size() < 2 || descriptor_count < kParallelDescriptorThreshold) {
+            // The skip result doesn't tell if anything was found: warnings and filtered messages don't set it
+            for (const auto &check : checks) {
+                LogMessageCapture capture;
+                {
+                    LogMessageCapture::Scope scope(capture);
+                    ValidateDescriptorSet(loc, cb_state, check);
                 }
+                if (capture.empty() && !capture.Filtered()) {
+                    check.cmd_info->validated_epoch.value.store(check.epoch, std::memory_order_relaxed);
+                } else {
+                    skip |= capture.Report(core->report_data);
+                }
+            }
+            return skip;
+        }
+
+        // Each check only reads state, so they can run on any thread. Messages are captured per check and reported
+        // afterwards in check order, so the output matches serial validation.
+        std::vector<LogMessageCapture> captures(checks.size());
+        pool->ParallelFor(checks.size(), [&](size_t i) {
+            LogMessageCapture::Scope scope(captures[i]);
+            ValidateDescriptorSet(loc, cb_state, checks[i]);
+        });
+        for (size_t i = 0; i < checks.size(); ++i) {
+            if (captures[i].empty() && !captures[i].Filtered()) {
+                checks[i].cmd_info->validated_epoch.value.store(checks[i].epoch, std::memory_order_relaxed);
+            } else {
+                skip |= captures[i].Report(core->report_data);
             }
         }
+        return skip;
+    }
+
+    bool Validate(const core_error::Location &loc, const CMD_BUFFER_STATE &cb_state, uint32_t perf_pass) {
+        bool skip = false;
+        skip |= core->ValidateCmdBufImageLayouts(loc, cb_state, overlay_image_layout_map);
+        auto cmd = cb_state.commandBuffer();
+        current_cmds.push_back(cmd);
+        skip |= core->ValidatePrimaryCommandBufferState(loc, cb_state,
+                                                        static_cast<int>(std::count(current_cmds.begin(), current_cmds.end(), cmd)),
+                                                        &qfo_image_scoreboards, &qfo_buffer_scoreboards);
+        skip |= core->ValidateQueueFamilyIndices(loc, cb_state, queue_state->Queue());
+
+        skip |= ValidateDescriptorSets(loc, cb_state);
 
         // Potential early exit here as bad object state may crash in delayed function calls
         if (skip) {
@@ -5540,17 +5597,10 @@ struct CommandBufferSubmitState {
         }
 
         // Call submit-time functions to validate or update local mirrors of state (to preserve const-ness at validate time)
-        for (auto &function : cb_state.queue_submit_functions) {
-            skip |= function(*core, *queue_state, cb_state);
-        }
-        for (auto &function : cb_state.eventUpdates) {
-            skip |= function(const_cast<CMD_BUFFER_STATE &>(cb_state), /*do_validate*/ true, &local_event_to_stage_map);
-        }
+        skip |= core->ValidateQueueSubmitChecks(*queue_state, cb_state);
+        skip |= cb_state.ReplayEventUpdates(/*do_validate*/ true, &local_event_to_stage_map);
         VkQueryPool first_perf_query_pool = VK_NULL_HANDLE;
-        for (auto &function : cb_state.queryUpdates) {
-            skip |= function(const_cast<CMD_BUFFER_STATE &>(cb_state), /*do_validate*/ true, first_perf_query_pool, perf_pass,
-                             &local_query_to_state_map);
-        }
+        skip |= cb_state.ReplayQueryUpdates(/*do_validate*/ true, first_perf_query_pool, perf_pass, &local_query_to_state_map);
         return skip;
     }
 };
@@ -11771,12 +11821,16 @@ void CORE_CMD_BUFFER_STATE::RecordWaitEvents(CMD_TYPE cmd_type, uint32_t eventCo
     auto first_event_index = events.size();
     CMD_BUFFER_STATE::RecordWaitEvents(cmd_type, eventCount, pEvents, srcStageMask);
     auto event_added_count = events.size() - first_event_index;
-    eventUpdates.emplace_back([event_added_count, first_event_index, srcStageMask](CMD_BUFFER_STATE &cb_state, bool do_validate,
-                                                                                   EventToStageMap *localEventToStageMap) {
-        if (!do_validate) return false;
-        return CoreChecks::ValidateEventStageMask(cb_state, event_added_count, first_event_index, srcStageMask,
-                                                  localEventToStageMap);
-    });
+    event_updates.Append(DeferredCheckOp::kValidateEventStageMask,
+                         EventStageMaskCheck{event_added_count, first_event_index, srcStageMask});
+}
+
+bool CORE_CMD_BUFFER_STATE::ReplayEventRecord(const DeferredCheckStream::Record &record, bool do_validate,
+                                              EventToStageMap *local_event_to_stage_map) const {
+    if (!do_validate || record.Op() != DeferredCheckOp::kValidateEventStageMask) return false;
+    const auto &check = record.Get<EventStageMaskCheck>();
+    return CoreChecks::ValidateEventStageMask(*this, check.event_count, check.first_event_index, check.src_stage_mask,
+                                              local_event_to_stage_map);
 }
 
 void CoreChecks::PreCallRecordCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
@@ -12269,15 +12323,7 @@ void CoreChecks::EnqueueVerifyBeginQuery(VkCommandBuffer command_buffer, const Q
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(command_buffer);
 
     // Enqueue the submit time validation here, ahead of the submit time state update in the StateTracker's PostCallRecord
-    cb_state->queryUpdates.emplace_back([query_obj, cmd_type](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                              VkQueryPool &firstPerfQueryPool, uint32_t perfPass,
-                                                              QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        bool skip = false;
-        skip |= ValidatePerformanceQuery(cb_state_arg, query_obj, cmd_type, firstPerfQueryPool, perfPass, localQueryToStateMap);
-        skip |= VerifyQueryIsReset(cb_state_arg, query_obj, cmd_type, firstPerfQueryPool, perfPass, localQueryToStateMap);
-        return skip;
-    });
+    cb_state->query_updates.Append(DeferredCheckOp::kVerifyBeginQuery, CORE_CMD_BUFFER_STATE::BeginQueryCheck{query_obj, cmd_type});
 }
 
 void CoreChecks::PreCallRecordCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot, VkFlags flags) {
@@ -12288,23 +12334,55 @@ void CoreChecks::PreCallRecordCmdBeginQuery(VkCommandBuffer commandBuffer, VkQue
 
 void CoreChecks::EnqueueVerifyEndQuery(CMD_BUFFER_STATE &cb_state, const QueryObject &query_obj) {
     // Enqueue the submit time validation here, ahead of the submit time state update in the StateTracker's PostCallRecord
-    cb_state.queryUpdates.emplace_back([query_obj](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                   VkQueryPool &firstPerfQueryPool, uint32_t perfPass,
-                                                   QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        bool skip = false;
-        auto device_data = cb_state_arg.dev_data;
-        auto query_pool_state = device_data->Get<QUERY_POOL_STATE>(query_obj.pool);
-        if (query_pool_state->has_perf_scope_command_buffer && (cb_state_arg.commandCount - 1) != query_obj.endCommandIndex) {
-            skip |= device_data->LogError(cb_state_arg.Handle(), "VUID-vkCmdEndQuery-queryPool-03227",
-                                          "vkCmdEndQuery: Query pool %s was created with a counter of scope"
-                                          "VK_QUERY_SCOPE_COMMAND_BUFFER_KHR but the end of the query is not the last "
-                                          "command in the command buffer %s.",
-                                          device_data->report_data->FormatHandle(query_obj.pool).c_str(),
-                                          device_data->report_data->FormatHandle(cb_state_arg.Handle()).c_str());
+    cb_state.query_updates.Append(DeferredCheckOp::kVerifyEndQuery, query_obj);
+}
+
+bool CORE_CMD_BUFFER_STATE::ReplayQueryRecord(const DeferredCheckStream::Record &record, bool do_validate,
+                                              VkQueryPool &first_perf_query_pool, uint32_t perf_pass,
+                                              QueryMap *local_query_to_state_map) const {
+    if (!do_validate) return false;
+    bool skip = false;
+    switch (record.Op()) {
+        case DeferredCheckOp::kVerifyBeginQuery: {
+            const auto &check = record.Get<BeginQueryCheck>();
+            skip |= CoreChecks::ValidatePerformanceQuery(*this, check.query, check.cmd_type, first_perf_query_pool, perf_pass,
+                                                         local_query_to_state_map);
+            skip |= CoreChecks::VerifyQueryIsReset(*this, check.query, check.cmd_type, first_perf_query_pool, perf_pass,
+                                                   local_query_to_state_map);
+            break;
         }
-        return skip;
-    });
+        case DeferredCheckOp::kVerifyEndQuery: {
+            const auto &query_obj = record.Get<QueryObject>();
+            auto query_pool_state = dev_data->Get<QUERY_POOL_STATE>(query_obj.pool);
+            if (query_pool_state->has_perf_scope_command_buffer && (commandCount - 1) != query_obj.endCommandIndex) {
+                skip |= dev_data->LogError(Handle(), "VUID-vkCmdEndQuery-queryPool-03227",
+                                           "vkCmdEndQuery: Query pool %s was created with a counter of scope"
+                                           "VK_QUERY_SCOPE_COMMAND_BUFFER_KHR but the end of the query is not the last "
+                                           "command in the command buffer %s.",
+                                           dev_data->report_data->FormatHandle(query_obj.pool).c_str(),
+                                           dev_data->report_data->FormatHandle(Handle()).c_str());
+            }
+            break;
+        }
+        case DeferredCheckOp::kValidateCopyQueryPoolResults: {
+            const auto &check = record.Get<CopyQueryPoolResultsCheck>();
+            skip |= CoreChecks::ValidateCopyQueryPoolResults(*this, check.pool, check.first_query, check.query_count, perf_pass,
+                                                             check.flags, local_query_to_state_map);
+            break;
+        }
+        case DeferredCheckOp::kVerifyQueryRangeIsReset: {
+            const auto &check = record.Get<QueryRangeResetCheck>();
+            for (uint32_t i = 0; i < check.query_count; i++) {
+                QueryObject query = {{check.pool, check.first_query + i}, perf_pass};
+                skip |= CoreChecks::VerifyQueryIsReset(*this, query, check.cmd_type, first_perf_query_pool, perf_pass,
+                                                       local_query_to_state_map);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    return skip;
 }
 
 bool CoreChecks::ValidateCmdEndQuery(const CMD_BUFFER_STATE &cb_state, const QueryObject &query_obj, uint32_t index, CMD_TYPE cmd,
@@ -12524,12 +12602,8 @@ void CoreChecks::PreCallRecordCmdCopyQueryPoolResults(VkCommandBuffer commandBuf
                                                       VkDeviceSize stride, VkQueryResultFlags flags) {
     if (disabled[query_validation]) return;
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
-    cb_state->queryUpdates.emplace_back([queryPool, firstQuery, queryCount, flags](
-                                            CMD_BUFFER_STATE &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                            uint32_t perfPass, QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        return ValidateCopyQueryPoolResults(cb_state_arg, queryPool, firstQuery, queryCount, perfPass, flags, localQueryToStateMap);
-    });
+    cb_state->query_updates.Append(DeferredCheckOp::kValidateCopyQueryPoolResults,
+                                   CORE_CMD_BUFFER_STATE::CopyQueryPoolResultsCheck{queryPool, firstQuery, queryCount, flags});
 }
 
 bool CoreChecks::PreCallValidateCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
@@ -12675,14 +12749,8 @@ void CoreChecks::PreCallRecordCmdWriteTimestamp(VkCommandBuffer commandBuffer, V
     if (disabled[query_validation]) return;
     // Enqueue the submit time validation check here, before the submit time state update in StateTracker::PostCall...
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
-    QueryObject query = {queryPool, slot};
-    CMD_TYPE cmd_type = CMD_WRITETIMESTAMP;
-    cb_state->queryUpdates.emplace_back([query, cmd_type](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                          VkQueryPool &firstPerfQueryPool, uint32_t perfPass,
-                                                          QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        return VerifyQueryIsReset(cb_state_arg, query, cmd_type, firstPerfQueryPool, perfPass, localQueryToStateMap);
-    });
+    cb_state->query_updates.Append(DeferredCheckOp::kVerifyQueryRangeIsReset,
+                                   CORE_CMD_BUFFER_STATE::QueryRangeResetCheck{queryPool, slot, 1, CMD_WRITETIMESTAMP});
 }
 
 void CoreChecks::PreCallRecordCmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR pipelineStage,
@@ -12690,14 +12758,8 @@ void CoreChecks::PreCallRecordCmdWriteTimestamp2KHR(VkCommandBuffer commandBuffe
     if (disabled[query_validation]) return;
     // Enqueue the submit time validation check here, before the submit time state update in StateTracker::PostCall...
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
-    QueryObject query = {queryPool, slot};
-    CMD_TYPE cmd_type = CMD_WRITETIMESTAMP2KHR;
-    cb_state->queryUpdates.emplace_back([query, cmd_type](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                          VkQueryPool &firstPerfQueryPool, uint32_t perfPass,
-                                                          QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        return VerifyQueryIsReset(cb_state_arg, query, cmd_type, firstPerfQueryPool, perfPass, localQueryToStateMap);
-    });
+    cb_state->query_updates.Append(DeferredCheckOp::kVerifyQueryRangeIsReset,
+                                   CORE_CMD_BUFFER_STATE::QueryRangeResetCheck{queryPool, slot, 1, CMD_WRITETIMESTAMP2KHR});
 }
 
 void CoreChecks::PreCallRecordCmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 pipelineStage,
@@ -12705,14 +12767,8 @@ void CoreChecks::PreCallRecordCmdWriteTimestamp2(VkCommandBuffer commandBuffer,
     if (disabled[query_validation]) return;
     // Enqueue the submit time validation check here, before the submit time state update in StateTracker::PostCall...
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
-    QueryObject query = {queryPool, slot};
-    CMD_TYPE cmd_type = CMD_WRITETIMESTAMP2;
-    cb_state->queryUpdates.emplace_back([query, cmd_type](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                          VkQueryPool &firstPerfQueryPool, uint32_t perfPass,
-                                                          QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        return VerifyQueryIsReset(cb_state_arg, query, cmd_type, firstPerfQueryPool, perfPass, localQueryToStateMap);
-    });
+    cb_state->query_updates.Append(DeferredCheckOp::kVerifyQueryRangeIsReset,
+                                   CORE_CMD_BUFFER_STATE::QueryRangeResetCheck{queryPool, slot, 1, CMD_WRITETIMESTAMP2});
 }
 
 void CoreChecks::PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR(VkCommandBuffer commandBuffer,
@@ -12723,18 +12779,9 @@ void CoreChecks::PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR(VkComm
     if (disabled[query_validation]) return;
     // Enqueue the submit time validation check here, before the submit time state update in StateTracker::PostCall...
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
-    CMD_TYPE cmd_type = CMD_WRITEACCELERATIONSTRUCTURESPROPERTIESKHR;
-    cb_state->queryUpdates.emplace_back([accelerationStructureCount, firstQuery, queryPool, cmd_type](
-                                            CMD_BUFFER_STATE &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                            uint32_t perfPass, QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        bool skip = false;
-        for (uint32_t i = 0; i < accelerationStructureCount; i++) {
-            QueryObject query = {{queryPool, firstQuery + i}, perfPass};
-            skip |= VerifyQueryIsReset(cb_state_arg, query, cmd_type, firstPerfQueryPool, perfPass, localQueryToStateMap);
-        }
-        return skip;
-    });
+    cb_state->query_updates.Append(DeferredCheckOp::kVerifyQueryRangeIsReset,
+                                   CORE_CMD_BUFFER_STATE::QueryRangeResetCheck{queryPool, firstQuery, accelerationStructureCount,
+                                                                               CMD_WRITEACCELERATIONSTRUCTURESPROPERTIESKHR});
 }
 
 bool CoreChecks::MatchUsage(uint32_t count, const VkAttachmentReference2 *attachments, const VkFramebufferCreateInfo *fbci,
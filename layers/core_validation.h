@@ -212,6 +212,50 @@ class CORE_CMD_BUFFER_STATE : public CMD_BUFFER_STATE {
 
     void RecordWaitEvents(CMD_TYPE cmd_type, uint32_t eventCount, const VkEvent* pEvents,
                           VkPipelineStageFlags2KHR src_stage_mask) override;
+
+    // Payloads of the DeferredCheckStream records owned by CoreChecks
+    struct EventStageMaskCheck {
+        size_t event_count;
+        size_t first_event_index;
+        VkPipelineStageFlags2KHR src_stage_mask;
+    };
+    struct BeginQueryCheck {
+        QueryObject query;
+        CMD_TYPE cmd_type;
+    };
+    struct CopyQueryPoolResultsCheck {
+        VkQueryPool pool;
+        uint32_t first_query;
+        uint32_t query_count;
+        VkQueryResultFlags flags;
+    };
+    struct QueryRangeResetCheck {
+        VkQueryPool pool;
+        uint32_t first_query;
+        uint32_t query_count;
+        CMD_TYPE cmd_type;
+    };
+    struct ConcurrentBarrierCheck {
+        // Barrier locations are single links, so the Location can be copied without capturing a chain
+        core_error::Location loc;
+        VulkanTypedHandle typed_handle;
+        uint32_t src_queue_family;
+        uint32_t dst_queue_family;
+    };
+    // Followed by region_count VkBufferCopy regions
+    struct BufferCopyOverlapCheck {
+        VkBuffer src_buffer;
+        VkBuffer dst_buffer;
+        const char* vuid;
+        const char* func_name;
+        uint32_t region_count;
+    };
+
+  protected:
+    bool ReplayQueryRecord(const DeferredCheckStream::Record& record, bool do_validate, VkQueryPool& first_perf_query_pool,
+                           uint32_t perf_pass, QueryMap* local_query_to_state_map) const override;
+    bool ReplayEventRecord(const DeferredCheckStream::Record& record, bool do_validate,
+                           EventToStageMap* local_event_to_stage_map) const override;
 };
 
 class CoreChecks : public ValidationStateTracker {
@@ -225,6 +269,7 @@ class CoreChecks : public ValidationStateTracker {
     GlobalQFOTransferBarrierMap<QFOImageTransferBarrier> qfo_release_image_barrier_map;
     GlobalQFOTransferBarrierMap<QFOBufferTransferBarrier> qfo_release_buffer_barrier_map;
     VkValidationCacheEXT core_validation_cache = VK_NULL_HANDLE;
+    mutable SpecializedShaderCache specialized_shader_cache;
     std::string validation_cache_path;
 
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
@@ -316,6 +361,8 @@ class CoreChecks : public ValidationStateTracker {
                                         const VkRenderPass rp_handle, const ImgBarrier& img_barrier,
                                         const CMD_BUFFER_STATE* primary_cb_state = nullptr) const;
 
+    // Replay the CoreChecks records of cb_state.queue_submit_checks
+    bool ValidateQueueSubmitChecks(const QUEUE_STATE& queue_state, const CMD_BUFFER_STATE& cb_state) const;
     static bool ValidateConcurrentBarrierAtSubmit(const Location& loc, const ValidationStateTracker& state_data,
                                                   const QUEUE_STATE& queue_data, const CMD_BUFFER_STATE& cb_state,
                                                   const VulkanTypedHandle& typed_handle, uint32_t src_queue_family,
@@ -625,6 +672,8 @@ class CoreChecks : public ValidationStateTracker {
 
     // Stuff from shader_validation
     bool ValidateGraphicsPipelineShaderState(const PIPELINE_STATE& pipeline) const;
+    uint64_t InterfaceVerdictKey(const PipelineStageState& producer, uint32_t producer_id, const PipelineStageState& consumer,
+                                 uint32_t consumer_id) const;
     bool ValidateGraphicsPipelineShaderDynamicState(const PIPELINE_STATE& pipeline, const CMD_BUFFER_STATE& cb_state,
                                                     const char* caller, const DrawDispatchVuid& vuid) const;
     bool ValidateGraphicsPipelineBlendEnable(const PIPELINE_STATE& pPipeline) const;
@@ -640,6 +689,8 @@ class CoreChecks : public ValidationStateTracker {
     bool PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) const override;
     bool ValidatePipelineShaderStage(const PIPELINE_STATE& pipeline, const PipelineStageState& stage_state) const;
+    std::shared_ptr<const SpecializedShaderResult> SpecializeShaderModule(
+        const SHADER_MODULE_STATE& module_state, const std::unordered_map<uint32_t, std::vector<uint32_t>>& id_value_map) const;
     bool ValidatePointSizeShaderState(const PIPELINE_STATE& pipeline, const SHADER_MODULE_STATE& module_state,
                                       const Instruction& entrypoint, VkShaderStageFlagBits stage) const;
     bool ValidatePrimitiveRateShaderState(const PIPELINE_STATE& pipeline, const SHADER_MODULE_STATE& module_state,
@@ -69,6 +69,10 @@ void DebugPrintf::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
         aborted = true;
         return;
     }
+
+    if (GpuGetOption("khronos_validation.instrumented_shader_cache", true)) {
+        instrumentation_cache.Load(GetLayerCacheFilePath("debug_printf_shader_cache"));
+    }
 }
 
 // Free the device memory and descriptor set associated with a command buffer.
@@ -81,20 +85,30 @@ void DebugPrintf::DestroyBuffer(DPFBufferInfo &buffer_info) {
 
 // Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
 bool DebugPrintf::InstrumentShader(const layer_data::span<const uint32_t> &input, std::vector<uint32_t> &new_pgm,
-                                   uint32_t *unique_shader_id) {
+                                   uint32_t unique_shader_id) {
     if (aborted) return false;
     if (input[0] != spv::MagicNumber) return false;
 
+    using namespace spvtools;
+    spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+
+    // Everything but the shader ID that the instrumented code depends on
+    const uint64_t cache_options = (static_cast<uint64_t>(desc_set_bind_index) << 32) | (static_cast<uint64_t>(target_env) << 8);
+    const bool use_cache = instrumentation_cache.Enabled() && UtilInstrumentationCache::CanCache(input);
+    if (use_cache && instrumentation_cache.Find(input, cache_options, unique_shader_id, new_pgm)) {
+        return true;
+    }
+
     // Load original shader SPIR-V
     new_pgm.clear();
     new_pgm.reserve(input.size());
     new_pgm.insert(new_pgm.end(), &input.front(), &input.back() + 1);
 
     // Call the optimizer to instrument the shader.
-    // Use the unique_shader_module_id as a shader ID so we can look up its handle later in the shader_map.
+    // Use the unique_shader_id as a shader ID so we can look up its handle later in the shader_map. Cached shaders use a
+    // placeholder instead, which is patched to the unique_shader_id.
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
-    using namespace spvtools;
-    spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+    const uint32_t shader_id = use_cache ? UtilInstrumentationCache::kPlaceholderShaderId : unique_shader_id;
     spvtools::ValidatorOptions val_options;
     AdjustValidatorOptions(device_extensions, enabled_features, val_options);
     spvtools::OptimizerOptions opt_options;
@@ -115,12 +129,13 @@ bool DebugPrintf::InstrumentShader(const layer_data::span<const uint32_t> &input
         }
     };
     optimizer.SetMessageConsumer(debug_printf_console_message_consumer);
-    optimizer.RegisterPass(CreateInstDebugPrintfPass(desc_set_bind_index, unique_shader_module_id));
+    optimizer.RegisterPass(CreateInstDebugPrintfPass(desc_set_bind_index, shader_id));
     bool pass = optimizer.Run(new_pgm.data(), new_pgm.size(), &new_pgm, opt_options);
     if (!pass) {
         ReportSetupProblem(device, "Failure to instrument shader.  Proceeding with non-instrumented shader.");
+    } else if (use_cache) {
+        instrumentation_cache.Insert(input, cache_options, new_pgm, unique_shader_id);
     }
-    *unique_shader_id = unique_shader_module_id++;
     return pass;
 }
 // Create the instrumented shader data to provide to the driver.
@@ -128,8 +143,9 @@ void DebugPrintf::PreCallRecordCreateShaderModule(VkDevice device, const VkShade
                                                   const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                   void *csm_state_data) {
     create_shader_module_api_state *csm_state = reinterpret_cast<create_shader_module_api_state *>(csm_state_data);
+    csm_state->unique_shader_id = unique_shader_module_id++;
     bool pass = InstrumentShader(layer_data::make_span(pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t)),
-                                 csm_state->instrumented_pgm, &csm_state->unique_shader_id);
+                                 csm_state->instrumented_pgm, csm_state->unique_shader_id);
     if (pass) {
         csm_state->instrumented_create_info.pCode = csm_state->instrumented_pgm.data();
         csm_state->instrumented_create_info.codeSize = csm_state->instrumented_pgm.size() * sizeof(uint32_t);
@@ -238,19 +254,11 @@ std::vector<DPFSubstring> DebugPrintf::ParseFormatString(const std::string &form
     return parsed_strings;
 }
 
-std::string DebugPrintf::FindFormatString(std::vector<uint32_t> pgm, uint32_t string_id) {
+std::string DebugPrintf::FindFormatString(const UtilShaderDebugInfo *debug_info, uint32_t string_id) {
     std::string format_string;
-    SHADER_MODULE_STATE module_state(pgm);
-    if (module_state.words_.size() > 0) {
-        for (const auto &insn : module_state) {
-            if (insn.opcode() == spv::OpString) {
-                uint32_t offset = insn.offset();
-                if (pgm[offset + 1] == string_id) {
-                    format_string = reinterpret_cast<char *>(&pgm[offset + 2]);
-                    break;
-                }
-            }
-        }
+    const uint32_t offset = debug_info ? debug_info->FindString(string_id) : 0;
+    if (offset != 0) {
+        format_string = reinterpret_cast<const char *>(&debug_info->Pgm()[offset + 2]);
     }
 
     return format_string;
@@ -310,7 +318,7 @@ void DebugPrintf::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQ
         std::stringstream shader_message;
         VkShaderModule shader_module_handle = VK_NULL_HANDLE;
         VkPipeline pipeline_handle = VK_NULL_HANDLE;
-        std::vector<uint32_t> pgm;
+        std::shared_ptr<const UtilShaderDebugInfo> debug_info;
 
         DPFOutputRecord *debug_record = reinterpret_cast<DPFOutputRecord *>(&debug_output_buffer[index]);
         // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
@@ -319,10 +327,10 @@ void DebugPrintf::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQ
         if (it != shader_map.end()) {
             shader_module_handle = it->second.shader_module;
             pipeline_handle = it->second.pipeline;
-            pgm = it->second.pgm;
+            debug_info = it->second.debug_info;
         }
         // Search through the shader source for the printf format string for this invocation
-        auto format_string = FindFormatString(pgm, debug_record->format_string_id);
+        auto format_string = FindFormatString(debug_info.get(), debug_record->format_string_id);
         // Break the format string into strings with 1 or 0 value
         auto format_substrings = ParseFormatString(format_string);
         void *values = static_cast<void *>(&debug_record->values);
@@ -388,7 +396,7 @@ void DebugPrintf::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQ
             UtilGenerateStageMessage(&debug_output_buffer[index], stage_message);
             UtilGenerateCommonMessage(report_data, command_buffer, &debug_output_buffer[index], shader_module_handle,
                                       pipeline_handle, buffer_info.pipeline_bind_point, operation_index, common_message);
-            UtilGenerateSourceMessages(pgm, &debug_output_buffer[index], true, filename_message, source_message);
+            UtilGenerateSourceMessages(debug_info.get(), &debug_output_buffer[index], true, filename_message, source_message);
             if (use_stdout) {
                 std::cout << "UNASSIGNED-DEBUG-PRINTF " << common_message.c_str() << " " << stage_message.c_str() << " "
                           << shader_message.str().c_str() << " " << filename_message.c_str() << " " << source_message.c_str();
@@ -0,0 +1,147 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "vk_layer_data.h"
+
+// Operations recorded into a DeferredCheckStream. Every op has exactly one payload type, declared next to the code that
+// records and replays it. A stream only ever holds the ops of the state tracker plus those of the single validation object
+// owning the command buffer state, so the replay switch of each object only needs to handle its own ops.
+enum class DeferredCheckOp : uint32_t {
+    // CMD_BUFFER_STATE (cmd_buffer_state.h)
+    kSetQueryState,
+    kSetQueryStateRange,
+    kReplaySecondaryQueries,
+    kSetEventStageMask,
+    // CoreChecks (core_validation.h)
+    kValidateEventStageMask,
+    kVerifyBeginQuery,
+    kVerifyEndQuery,
+    kValidateCopyQueryPoolResults,
+    kVerifyQueryRangeIsReset,
+    kValidateConcurrentBarrier,
+    kValidateBufferCopyOverlap,
+    // BestPractices (best_practices_validation.h)
+    kValidateImageInQueue,
+    kAcquireImageQueueFamily,
+};
+
+// Contiguous stream of tagged records, replacing lists of std::function for work deferred from command recording to queue
+// submission. Each record is a header word followed by a trivially copyable payload and an optional trailing array, all
+// padded to 8 bytes. Appending does not allocate beyond growing the (usually arena backed) word buffer, and replay is a
+// linear walk over it.
+class DeferredCheckStream {
+  public:
+    using Storage = layer_data::arena_vector<uint64_t>;
+
+    class Record {
+      public:
+        DeferredCheckOp Op() const { return static_cast<DeferredCheckOp>(words_[0] & 0xffffffff); }
+
+        template <typename Payload>
+        const Payload &Get() const {
+            static_assert(std::is_trivially_copyable<Payload>::value, "deferred check payloads must be trivially copyable");
+            return *reinterpret_cast<const Payload *>(words_ + 1);
+        }
+
+        // Trailing array stored after a payload of type Payload
+        template <typename Payload, typename Element>
+        const Element *Extra() const {
+            return reinterpret_cast<const Element *>(words_ + 1 + WordCount(sizeof(Payload)));
+        }
+
+      private:
+        friend class DeferredCheckStream;
+        explicit Record(const uint64_t *words) : words_(words) {}
+        const uint64_t *words_;
+    };
+
+    class const_iterator {
+      public:
+        Record operator*() const { return Record(pos_); }
+        const_iterator &operator++() {
+            pos_ += 1 + (*pos_ >> 32);
+            return *this;
+        }
+        bool operator==(const const_iterator &other) const { return pos_ == other.pos_; }
+        bool operator!=(const const_iterator &other) const { return pos_ != other.pos_; }
+
+      private:
+        friend class DeferredCheckStream;
+        explicit const_iterator(const uint64_t *pos) : pos_(pos) {}
+        const uint64_t *pos_;
+    };
+
+    DeferredCheckStream() = default;
+    explicit DeferredCheckStream(const Storage::allocator_type &allocator) : words_(allocator) {}
+
+    template <typename Payload>
+    void Append(DeferredCheckOp op, const Payload &payload) {
+        Append<Payload, uint64_t>(op, payload, nullptr, 0);
+    }
+
+    template <typename Payload, typename Element>
+    void Append(DeferredCheckOp op, const Payload &payload, const Element *extra, uint32_t extra_count) {
+        static_assert(std::is_trivially_copyable<Payload>::value, "deferred check payloads must be trivially copyable");
+        static_assert(std::is_trivially_copyable<Element>::value, "deferred check payloads must be trivially copyable");
+        static_assert(alignof(Payload) <= alignof(uint64_t) && alignof(Element) <= alignof(uint64_t),
+                      "deferred check payloads must not be over-aligned");
+        const size_t payload_words = WordCount(sizeof(Payload));
+        const size_t record_words = payload_words + WordCount(sizeof(Element) * extra_count);
+        const size_t start = words_.size();
+        words_.resize(start + 1 + record_words);
+        uint64_t *record = words_.data() + start;
+        record[0] = static_cast<uint64_t>(op) | (static_cast<uint64_t>(record_words) << 32);
+        std::memcpy(record + 1, &payload, sizeof(Payload));
+        if (extra_count) {
+            std::memcpy(record + 1 + payload_words, extra, sizeof(Element) * extra_count);
+        }
+        ++count_;
+    }
+
+    // Append all of the records of other, in order
+    void Append(const DeferredCheckStream &other) {
+        words_.insert(words_.end(), other.words_.begin(), other.words_.end());
+        count_ += other.count_;
+    }
+
+    const_iterator begin() const { return const_iterator(words_.data()); }
+    const_iterator end() const { return const_iterator(words_.data() + words_.size()); }
+    bool empty() const { return count_ == 0; }
+    size_t size() const { return count_; }
+
+    void clear() {
+        words_.clear();
+        count_ = 0;
+    }
+    // Drop the storage as well, as required before resetting the arena it was allocated from
+    void Release() {
+        layer_data::ReleaseArenaStorage(words_);
+        count_ = 0;
+    }
+
+  private:
+    static constexpr size_t WordCount(size_t bytes) { return (bytes + sizeof(uint64_t) - 1) / sizeof(uint64_t); }
+
+    Storage words_;
+    size_t count_ = 0;
+};
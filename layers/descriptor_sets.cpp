@@ -417,7 +417,8 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
       layout_(layout),
       state_data_(state_data),
       variable_count_(variable_count),
-      change_count_(0) {
+      change_count_(0),
+      has_bindless_bindings_(false) {
     // Foreach binding, create default descriptors of given type
     auto binding_count = layout_->GetBindingCount();
     bindings_.reserve(binding_count);
@@ -502,6 +503,9 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
                 assert(0);  // Bad descriptor type specified
                 break;
         }
+        if (!bindings_.empty() && bindings_.back()->IsBindless()) {
+            has_bindless_bindings_ = true;
+        }
     }
 }
 
@@ -574,6 +578,8 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
             change_count_++;
             dst_iter.updated(true);
         } else {
+            // Clearing the updated flag changes the outcome of validation as much as writing does
+            change_count_++;
             dst_iter.updated(false);
         }
     }
@@ -647,7 +653,10 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
             cmd_info.attachments = cb_state->active_attachments;
             cmd_info.subpasses = cb_state->active_subpasses;
         }
-        cb_state->validate_descriptorsets_in_queuesubmit[GetSet()].emplace_back(cmd_info);
+        auto &cmd_infos = cb_state->validate_descriptorsets_in_queuesubmit
+                              .emplace(GetSet(), cb_state->RecordingAllocator<CMD_BUFFER_STATE::CmdDrawDispatchInfo>())
+                              .first->second;
+        cmd_infos.emplace_back(cmd_info);
     }
 }
 
@@ -751,6 +760,8 @@ static void ReplaceStatePtr(DescriptorSet *set_state, T &dst, const T &src, bool
     // parent, so that destroying the object wont invalidate the descriptor
     if (dst && !is_bindless) {
         dst->AddParent(set_state);
+    } else if (dst) {
+        dst->SetBindlessReferenced();
     }
 }
 
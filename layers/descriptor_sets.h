@@ -922,7 +922,11 @@ class DescriptorSet : public BASE_NODE {
         auto pos = dynamic_offset_idx_to_descriptor_list_.at(index);
         return bindings_[pos.first]->GetDescriptor(pos.second);
     }
-    uint64_t GetChangeCount() const { return change_count_; }
+    uint64_t GetChangeCount() const { return change_count_.load(); }
+    // Called when an object that a descriptor of the set references is destroyed or has its memory rebound, so that work keyed
+    // on the change count, like submit time descriptor validation, is redone
+    void NotifyReferencedObjectChanged() { change_count_++; }
+    bool HasBindlessBindings() const { return has_bindless_bindings_; }
 
     const std::vector<safe_VkWriteDescriptorSet> &GetWrites() const { return push_descriptor_set_writes; }
 
@@ -1055,7 +1059,8 @@ class DescriptorSet : public BASE_NODE {
     std::vector<BindingPtr> bindings_;
     const StateTracker *state_data_;
     uint32_t variable_count_;
-    uint64_t change_count_;
+    std::atomic<uint64_t> change_count_;
+    bool has_bindless_bindings_;
 
     // For a given dynamic offset index in the set, map to associated index of the descriptors in the set
     std::vector<std::pair<uint32_t, uint32_t>> dynamic_offset_idx_to_descriptor_list_;
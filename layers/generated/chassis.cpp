@@ -33,11 +33,9 @@
 
 small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
 
-// Global unique object identifier.
-std::atomic<uint64_t> global_unique_id(1ULL);
 // Map uniqueID to actual object handle. Accesses to the map itself are
 // internally synchronized.
-vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+vl_concurrent_id_table unique_id_mapping;
 
 bool wrap_handles = true;
 
@@ -319,12 +317,12 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     // Init dispatch array and call registration functions
     bool skip = false;
     for (auto intercept : local_object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateInstance(pCreateInfo, pAllocator, pInstance);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : local_object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance);
     }
 
@@ -357,7 +355,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     sync_validation_obj->FinalizeInstanceValidationObject(framework, *pInstance);
 
     for (auto intercept : framework->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, result);
     }
 
@@ -384,18 +382,18 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     ActivateInstanceDebugCallbacks(layer_data->report_data);
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyInstance(instance, pAllocator);
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyInstance(instance, pAllocator);
     }
 
     layer_data->instance_dispatch_table.DestroyInstance(instance, pAllocator);
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyInstance(instance, pAllocator);
     }
 
@@ -441,12 +439,12 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 
     bool skip = false;
     for (auto intercept : instance_interceptor->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : instance_interceptor->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, &modified_create_info);
     }
 
@@ -474,6 +472,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     // Note that this DEFINES THE ORDER IN WHICH THE LAYER VALIDATION OBJECTS ARE CALLED
     auto disables = instance_interceptor->disabled;
     auto enables = instance_interceptor->enabled;
+#ifdef VVL_STATIC_DISPATCH
+    FilterStaticDispatchObjects(device_interceptor, disables, enables);
+#endif
 
     auto thread_safety_obj = new ThreadSafety(reinterpret_cast<ThreadSafety *>(instance_interceptor->GetValidationObject(instance_interceptor->object_dispatch, LayerObjectTypeThreading)));
     thread_safety_obj->InitDeviceValidationObject(!disables[thread_safety], instance_interceptor, device_interceptor);
@@ -513,11 +514,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     }
 
     for (auto intercept : instance_interceptor->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
     }
 
     device_interceptor->InitObjectDispatchVectors();
+    for (auto item : device_interceptor->object_dispatch) {
+        device_interceptor->static_dispatch_objects[item->container_type] = item;
+    }
 
     DeviceExtensionWhitelist(device_interceptor, pCreateInfo, *pDevice);
     DeviceExtensionWarnlist(device_interceptor, pCreateInfo, *pDevice);
@@ -533,18 +537,18 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     dispatch_key key = get_dispatch_key(device);
     auto layer_data = GetLayerDataPtr(key, layer_data_map);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDevice(device, pAllocator);
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyDevice(device, pAllocator);
     }
 
     layer_data->device_dispatch_table.DestroyDevice(device, pAllocator);
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
 
@@ -571,12 +575,12 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
     }
 
@@ -586,7 +590,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     VkResult result = DispatchCreateGraphicsPipelines(device, pipelineCache, createInfoCount, usepCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(cgpl_state[intercept->container_type]));
     }
     return result;
@@ -607,12 +611,12 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
     }
 
@@ -622,7 +626,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     VkResult result = DispatchCreateComputePipelines(device, pipelineCache, createInfoCount, usepCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(ccpl_state[intercept->container_type]));
     }
     return result;
@@ -642,13 +646,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
 
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
     }
@@ -656,7 +660,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     VkResult result = DispatchCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
     }
@@ -678,13 +682,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
 
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
     }
@@ -692,7 +696,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
     VkResult result = DispatchCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
     }
@@ -712,17 +716,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
     cpl_state.modified_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, &cpl_state);
     }
     VkResult result = DispatchCreatePipelineLayout(device, &cpl_state.modified_create_info, pAllocator, pPipelineLayout);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     }
     return result;
@@ -741,17 +745,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
     csm_state.instrumented_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
     }
     VkResult result = DispatchCreateShaderModule(device, &csm_state.instrumented_create_info, pAllocator, pShaderModule);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, &csm_state);
     }
     return result;
@@ -768,18 +772,18 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
 
     for (auto intercept : layer_data->object_dispatch) {
         ads_state[intercept->container_type].Init(pAllocateInfo->descriptorSetCount);
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateDescriptorSets(device,
             pAllocateInfo, pDescriptorSets, &(ads_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
     VkResult result = DispatchAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets,
             result, &(ads_state[intercept->container_type]));
     }
@@ -799,17 +803,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
     cb_state.modified_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, &cb_state);
     }
     VkResult result = DispatchCreateBuffer(device, &cb_state.modified_create_info, pAllocator, pBuffer);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, result);
     }
     return result;
@@ -845,13 +849,13 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
     }
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
     }
 
@@ -863,7 +867,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
     (*pToolCount)++;
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, result);
     }
     return result;
@@ -956,17 +960,17 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
     }
     VkResult result = DispatchEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices, result);
     }
     return result;
@@ -978,17 +982,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
     }
     DispatchGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
     }
 }
@@ -1000,17 +1004,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
     }
     DispatchGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
     }
 }
@@ -1026,17 +1030,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties, result);
     }
     return result;
@@ -1048,17 +1052,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceProperties(physicalDevice, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceProperties(physicalDevice, pProperties);
     }
     DispatchGetPhysicalDeviceProperties(physicalDevice, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceProperties(physicalDevice, pProperties);
     }
 }
@@ -1070,17 +1074,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
     DispatchGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
 }
@@ -1091,17 +1095,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
     }
     DispatchGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
     }
 }
@@ -1114,17 +1118,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceQueue]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
     DispatchGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceQueue]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
     }
 }
@@ -1137,17 +1141,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSubmit]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence);
     }
     VkResult result = DispatchQueueSubmit(queue, submitCount, pSubmits, fence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSubmit]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
     }
     return result;
@@ -1158,17 +1162,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueWaitIdle]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueWaitIdle(queue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueWaitIdle]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordQueueWaitIdle(queue);
     }
     VkResult result = DispatchQueueWaitIdle(queue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueWaitIdle]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordQueueWaitIdle(queue, result);
     }
     return result;
@@ -1179,17 +1183,17 @@ VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeviceWaitIdle]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDeviceWaitIdle(device);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDeviceWaitIdle]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDeviceWaitIdle(device);
     }
     VkResult result = DispatchDeviceWaitIdle(device);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDeviceWaitIdle]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDeviceWaitIdle(device, result);
     }
     return result;
@@ -1203,17 +1207,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateMemory]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     }
     VkResult result = DispatchAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAllocateMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordAllocateMemory(device, pAllocateInfo, pAllocator, pMemory, result);
     }
     return result;
@@ -1226,17 +1230,17 @@ VKAPI_ATTR void VKAPI_CALL FreeMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeMemory]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeMemory(device, memory, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordFreeMemory(device, memory, pAllocator);
     }
     DispatchFreeMemory(device, memory, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordFreeMemory(device, memory, pAllocator);
     }
 }
@@ -1251,17 +1255,17 @@ VKAPI_ATTR VkResult VKAPI_CALL MapMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMapMemory]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMapMemory(device, memory, offset, size, flags, ppData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordMapMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordMapMemory(device, memory, offset, size, flags, ppData);
     }
     VkResult result = DispatchMapMemory(device, memory, offset, size, flags, ppData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordMapMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordMapMemory(device, memory, offset, size, flags, ppData, result);
     }
     return result;
@@ -1273,17 +1277,17 @@ VKAPI_ATTR void VKAPI_CALL UnmapMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUnmapMemory]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUnmapMemory(device, memory);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUnmapMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordUnmapMemory(device, memory);
     }
     DispatchUnmapMemory(device, memory);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUnmapMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordUnmapMemory(device, memory);
     }
 }
@@ -1295,17 +1299,17 @@ VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFlushMappedMemoryRanges]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFlushMappedMemoryRanges]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFlushMappedMemoryRanges]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
     return result;
@@ -1318,17 +1322,17 @@ VKAPI_ATTR VkResult VKAPI_CALL InvalidateMappedMemoryRanges(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateInvalidateMappedMemoryRanges]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordInvalidateMappedMemoryRanges]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     }
     VkResult result = DispatchInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordInvalidateMappedMemoryRanges]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges, result);
     }
     return result;
@@ -1341,17 +1345,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryCommitment]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryCommitment]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
     DispatchGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryCommitment]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     }
 }
@@ -1364,17 +1368,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory(device, buffer, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordBindBufferMemory(device, buffer, memory, memoryOffset);
     }
     VkResult result = DispatchBindBufferMemory(device, buffer, memory, memoryOffset);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordBindBufferMemory(device, buffer, memory, memoryOffset, result);
     }
     return result;
@@ -1388,17 +1392,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory(device, image, memory, memoryOffset);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordBindImageMemory(device, image, memory, memoryOffset);
     }
     VkResult result = DispatchBindImageMemory(device, image, memory, memoryOffset);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordBindImageMemory(device, image, memory, memoryOffset, result);
     }
     return result;
@@ -1411,17 +1415,17 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     }
 }
@@ -1433,17 +1437,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements(device, image, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements(device, image, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetImageMemoryRequirements(device, image, pMemoryRequirements);
     }
 }
@@ -1456,17 +1460,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -1483,17 +1487,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
     }
     DispatchGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
     }
 }
@@ -1506,17 +1510,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueBindSparse]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueBindSparse]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
     }
     VkResult result = DispatchQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueBindSparse]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordQueueBindSparse(queue, bindInfoCount, pBindInfo, fence, result);
     }
     return result;
@@ -1530,17 +1534,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFence(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFence]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFence(device, pCreateInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateFence]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence);
     }
     VkResult result = DispatchCreateFence(device, pCreateInfo, pAllocator, pFence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateFence]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateFence(device, pCreateInfo, pAllocator, pFence, result);
     }
     return result;
@@ -1553,17 +1557,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyFence(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFence]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFence(device, fence, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyFence]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyFence(device, fence, pAllocator);
     }
     DispatchDestroyFence(device, fence, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyFence]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyFence(device, fence, pAllocator);
     }
 }
@@ -1575,17 +1579,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetFences(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetFences]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetFences(device, fenceCount, pFences);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetFences]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordResetFences(device, fenceCount, pFences);
     }
     VkResult result = DispatchResetFences(device, fenceCount, pFences);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetFences]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordResetFences(device, fenceCount, pFences, result);
     }
     return result;
@@ -1597,17 +1601,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceStatus]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceStatus(device, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceStatus]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetFenceStatus(device, fence);
     }
     VkResult result = DispatchGetFenceStatus(device, fence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceStatus]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetFenceStatus(device, fence, result);
     }
     return result;
@@ -1622,17 +1626,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitForFences]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitForFences(device, fenceCount, pFences, waitAll, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitForFences]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout);
     }
     VkResult result = DispatchWaitForFences(device, fenceCount, pFences, waitAll, timeout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitForFences]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, result);
     }
     return result;
@@ -1646,17 +1650,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSemaphore]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSemaphore]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     }
     VkResult result = DispatchCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSemaphore]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore, result);
     }
     return result;
@@ -1669,17 +1673,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySemaphore(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySemaphore]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySemaphore(device, semaphore, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySemaphore]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
     DispatchDestroySemaphore(device, semaphore, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySemaphore]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroySemaphore(device, semaphore, pAllocator);
     }
 }
@@ -1692,17 +1696,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateEvent]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateEvent(device, pCreateInfo, pAllocator, pEvent);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent);
     }
     VkResult result = DispatchCreateEvent(device, pCreateInfo, pAllocator, pEvent);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateEvent(device, pCreateInfo, pAllocator, pEvent, result);
     }
     return result;
@@ -1715,17 +1719,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyEvent]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyEvent(device, event, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyEvent(device, event, pAllocator);
     }
     DispatchDestroyEvent(device, event, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyEvent(device, event, pAllocator);
     }
 }
@@ -1736,17 +1740,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetEventStatus]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetEventStatus(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetEventStatus]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetEventStatus(device, event);
     }
     VkResult result = DispatchGetEventStatus(device, event);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetEventStatus]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetEventStatus(device, event, result);
     }
     return result;
@@ -1758,17 +1762,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetEvent]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordSetEvent(device, event);
     }
     VkResult result = DispatchSetEvent(device, event);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordSetEvent(device, event, result);
     }
     return result;
@@ -1780,17 +1784,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetEvent]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetEvent(device, event);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordResetEvent(device, event);
     }
     VkResult result = DispatchResetEvent(device, event);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordResetEvent(device, event, result);
     }
     return result;
@@ -1804,17 +1808,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateQueryPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     }
     VkResult result = DispatchCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool, result);
     }
     return result;
@@ -1827,17 +1831,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyQueryPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyQueryPool(device, queryPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
     DispatchDestroyQueryPool(device, queryPool, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyQueryPool(device, queryPool, pAllocator);
     }
 }
@@ -1854,17 +1858,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueryPoolResults]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetQueryPoolResults]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     }
     VkResult result = DispatchGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetQueryPoolResults]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags, result);
     }
     return result;
@@ -1877,17 +1881,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBuffer(device, buffer, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
     DispatchDestroyBuffer(device, buffer, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyBuffer(device, buffer, pAllocator);
     }
 }
@@ -1900,17 +1904,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateBufferView]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBufferView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateBufferView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateBufferView(device, pCreateInfo, pAllocator, pView);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateBufferView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateBufferView(device, pCreateInfo, pAllocator, pView, result);
     }
     return result;
@@ -1923,17 +1927,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBufferView]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBufferView(device, bufferView, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyBufferView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
     DispatchDestroyBufferView(device, bufferView, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyBufferView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyBufferView(device, bufferView, pAllocator);
     }
 }
@@ -1946,17 +1950,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImage(device, pCreateInfo, pAllocator, pImage);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage);
     }
     VkResult result = DispatchCreateImage(device, pCreateInfo, pAllocator, pImage);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage, result);
     }
     return result;
@@ -1969,17 +1973,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImage(device, image, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyImage(device, image, pAllocator);
     }
     DispatchDestroyImage(device, image, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyImage(device, image, pAllocator);
     }
 }
@@ -1992,17 +1996,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSubresourceLayout]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSubresourceLayout(device, image, pSubresource, pLayout);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSubresourceLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
     DispatchGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSubresourceLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
 }
@@ -2015,17 +2019,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImageView]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImageView(device, pCreateInfo, pAllocator, pView);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateImageView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView);
     }
     VkResult result = DispatchCreateImageView(device, pCreateInfo, pAllocator, pView);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateImageView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateImageView(device, pCreateInfo, pAllocator, pView, result);
     }
     return result;
@@ -2038,17 +2042,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyImageView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImageView]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyImageView(device, imageView, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyImageView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyImageView(device, imageView, pAllocator);
     }
     DispatchDestroyImageView(device, imageView, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyImageView]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyImageView(device, imageView, pAllocator);
     }
 }
@@ -2060,17 +2064,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyShaderModule]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyShaderModule(device, shaderModule, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyShaderModule]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
     DispatchDestroyShaderModule(device, shaderModule, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyShaderModule]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyShaderModule(device, shaderModule, pAllocator);
     }
 }
@@ -2083,17 +2087,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePipelineCache]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreatePipelineCache]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     }
     VkResult result = DispatchCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePipelineCache]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache, result);
     }
     return result;
@@ -2106,17 +2110,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineCache]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineCache(device, pipelineCache, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipelineCache]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
     DispatchDestroyPipelineCache(device, pipelineCache, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipelineCache]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyPipelineCache(device, pipelineCache, pAllocator);
     }
 }
@@ -2129,17 +2133,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineCacheData]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineCacheData]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
     }
     VkResult result = DispatchGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineCacheData]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPipelineCacheData(device, pipelineCache, pDataSize, pData, result);
     }
     return result;
@@ -2153,17 +2157,17 @@ VKAPI_ATTR VkResult VKAPI_CALL MergePipelineCaches(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMergePipelineCaches]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordMergePipelineCaches]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
     }
     VkResult result = DispatchMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordMergePipelineCaches]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches, result);
     }
     return result;
@@ -2176,17 +2180,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipeline]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipeline(device, pipeline, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipeline]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
     DispatchDestroyPipeline(device, pipeline, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipeline]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyPipeline(device, pipeline, pAllocator);
     }
 }
@@ -2198,17 +2202,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineLayout]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPipelineLayout(device, pipelineLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPipelineLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
     DispatchDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPipelineLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyPipelineLayout(device, pipelineLayout, pAllocator);
     }
 }
@@ -2221,17 +2225,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSampler]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSampler(device, pCreateInfo, pAllocator, pSampler);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSampler]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler);
     }
     VkResult result = DispatchCreateSampler(device, pCreateInfo, pAllocator, pSampler);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSampler]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateSampler(device, pCreateInfo, pAllocator, pSampler, result);
     }
     return result;
@@ -2244,17 +2248,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySampler(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySampler]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySampler(device, sampler, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySampler]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroySampler(device, sampler, pAllocator);
     }
     DispatchDestroySampler(device, sampler, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySampler]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroySampler(device, sampler, pAllocator);
     }
 }
@@ -2267,17 +2271,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorSetLayout]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorSetLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     }
     VkResult result = DispatchCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorSetLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout, result);
     }
     return result;
@@ -2290,17 +2294,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorSetLayout]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorSetLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
     DispatchDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorSetLayout]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     }
 }
@@ -2313,17 +2317,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     }
     VkResult result = DispatchCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool, result);
     }
     return result;
@@ -2336,17 +2340,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorPool(device, descriptorPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
     DispatchDestroyDescriptorPool(device, descriptorPool, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator);
     }
 }
@@ -2358,17 +2362,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetDescriptorPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetDescriptorPool(device, descriptorPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetDescriptorPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordResetDescriptorPool(device, descriptorPool, flags);
     }
     VkResult result = DispatchResetDescriptorPool(device, descriptorPool, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetDescriptorPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordResetDescriptorPool(device, descriptorPool, flags, result);
     }
     return result;
@@ -2382,17 +2386,17 @@ VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeDescriptorSets]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeDescriptorSets]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
     }
     VkResult result = DispatchFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeDescriptorSets]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets, result);
     }
     return result;
@@ -2407,17 +2411,17 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSets]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSets]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
     DispatchUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSets]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
     }
 }
@@ -2430,17 +2434,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFramebuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateFramebuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
     }
     VkResult result = DispatchCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateFramebuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer, result);
     }
     return result;
@@ -2453,17 +2457,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFramebuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyFramebuffer(device, framebuffer, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyFramebuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
     DispatchDestroyFramebuffer(device, framebuffer, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyFramebuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyFramebuffer(device, framebuffer, pAllocator);
     }
 }
@@ -2476,17 +2480,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -2499,17 +2503,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyRenderPass]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyRenderPass(device, renderPass, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
     DispatchDestroyRenderPass(device, renderPass, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyRenderPass(device, renderPass, pAllocator);
     }
 }
@@ -2521,17 +2525,17 @@ VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRenderAreaGranularity]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRenderAreaGranularity(device, renderPass, pGranularity);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRenderAreaGranularity]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
     DispatchGetRenderAreaGranularity(device, renderPass, pGranularity);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRenderAreaGranularity]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetRenderAreaGranularity(device, renderPass, pGranularity);
     }
 }
@@ -2544,17 +2548,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCommandPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     }
     VkResult result = DispatchCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool, result);
     }
     return result;
@@ -2567,17 +2571,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCommandPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyCommandPool(device, commandPool, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
     DispatchDestroyCommandPool(device, commandPool, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyCommandPool(device, commandPool, pAllocator);
     }
 }
@@ -2589,17 +2593,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandPool(device, commandPool, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordResetCommandPool(device, commandPool, flags);
     }
     VkResult result = DispatchResetCommandPool(device, commandPool, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordResetCommandPool(device, commandPool, flags, result);
     }
     return result;
@@ -2612,17 +2616,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateCommandBuffers]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateCommandBuffers]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
     }
     VkResult result = DispatchAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAllocateCommandBuffers]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers, result);
     }
     return result;
@@ -2636,17 +2640,17 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeCommandBuffers]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordFreeCommandBuffers]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
     DispatchFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordFreeCommandBuffers]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     }
 }
@@ -2657,17 +2661,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBeginCommandBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBeginCommandBuffer(commandBuffer, pBeginInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBeginCommandBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo);
     }
     VkResult result = DispatchBeginCommandBuffer(commandBuffer, pBeginInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBeginCommandBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, result);
     }
     return result;
@@ -2678,17 +2682,17 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateEndCommandBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEndCommandBuffer(commandBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordEndCommandBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordEndCommandBuffer(commandBuffer);
     }
     VkResult result = DispatchEndCommandBuffer(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordEndCommandBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordEndCommandBuffer(commandBuffer, result);
     }
     return result;
@@ -2700,17 +2704,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetCommandBuffer(commandBuffer, flags);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetCommandBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordResetCommandBuffer(commandBuffer, flags);
     }
     VkResult result = DispatchResetCommandBuffer(commandBuffer, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetCommandBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordResetCommandBuffer(commandBuffer, flags, result);
     }
     return result;
@@ -2723,17 +2727,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipeline]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindPipeline]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
     DispatchCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindPipeline]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     }
 }
@@ -2746,17 +2750,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewport]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewport]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
     DispatchCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewport]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
     }
 }
@@ -2769,17 +2773,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissor]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissor]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
     DispatchCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissor]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
     }
 }
@@ -2790,17 +2794,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineWidth]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineWidth(commandBuffer, lineWidth);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineWidth]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
     DispatchCmdSetLineWidth(commandBuffer, lineWidth);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineWidth]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetLineWidth(commandBuffer, lineWidth);
     }
 }
@@ -2813,17 +2817,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBias]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBias]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
     DispatchCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBias]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
     }
 }
@@ -2834,17 +2838,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetBlendConstants]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetBlendConstants(commandBuffer, blendConstants);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetBlendConstants]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
     DispatchCmdSetBlendConstants(commandBuffer, blendConstants);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetBlendConstants]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetBlendConstants(commandBuffer, blendConstants);
     }
 }
@@ -2856,17 +2860,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBounds]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBounds]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
     DispatchCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBounds]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
     }
 }
@@ -2878,17 +2882,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilCompareMask]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilCompareMask]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
     DispatchCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilCompareMask]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
     }
 }
@@ -2900,17 +2904,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilWriteMask]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilWriteMask]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
     DispatchCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilWriteMask]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
     }
 }
@@ -2922,17 +2926,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilReference]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilReference(commandBuffer, faceMask, reference);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilReference]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
     DispatchCmdSetStencilReference(commandBuffer, faceMask, reference);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilReference]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetStencilReference(commandBuffer, faceMask, reference);
     }
 }
@@ -2949,17 +2953,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorSets]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindDescriptorSets]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
     DispatchCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindDescriptorSets]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 }
@@ -2972,17 +2976,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindIndexBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindIndexBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
     DispatchCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindIndexBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     }
 }
@@ -2996,17 +3000,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
     DispatchCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
     }
 }
@@ -3020,17 +3024,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDraw]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDraw]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
     DispatchCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDraw]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
     }
 }
@@ -3045,17 +3049,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexed]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexed]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
     DispatchCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexed]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
     }
 }
@@ -3069,17 +3073,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirect]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirect]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirect]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -3093,17 +3097,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirect]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirect]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirect]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -3116,17 +3120,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatch(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatch]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatch]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatch]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -3138,17 +3142,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchIndirect]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchIndirect(commandBuffer, buffer, offset);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchIndirect]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
     DispatchCmdDispatchIndirect(commandBuffer, buffer, offset);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchIndirect]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset);
     }
 }
@@ -3162,17 +3166,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     }
 }
@@ -3188,17 +3192,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3215,17 +3219,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
     DispatchCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     }
 }
@@ -3240,17 +3244,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3265,17 +3269,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
     DispatchCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     }
 }
@@ -3289,17 +3293,17 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdUpdateBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdUpdateBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
     DispatchCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdUpdateBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     }
 }
@@ -3313,17 +3317,17 @@ VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdFillBuffer]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdFillBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
     DispatchCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdFillBuffer]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     }
 }
@@ -3338,17 +3342,17 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearColorImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearColorImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
     DispatchCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearColorImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     }
 }
@@ -3363,17 +3367,17 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearDepthStencilImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearDepthStencilImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
     DispatchCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearDepthStencilImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     }
 }
@@ -3387,17 +3391,17 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearAttachments]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdClearAttachments]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
     DispatchCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdClearAttachments]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
     }
 }
@@ -3413,17 +3417,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
     DispatchCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     }
 }
@@ -3435,17 +3439,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdSetEvent(commandBuffer, event, stageMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetEvent(commandBuffer, event, stageMask);
     }
 }
@@ -3457,17 +3461,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetEvent(commandBuffer, event, stageMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
     DispatchCmdResetEvent(commandBuffer, event, stageMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetEvent]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdResetEvent(commandBuffer, event, stageMask);
     }
 }
@@ -3487,17 +3491,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWaitEvents]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWaitEvents]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
 }
@@ -3516,17 +3520,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPipelineBarrier]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
     DispatchCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPipelineBarrier]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
     }
 }
@@ -3539,17 +3543,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQuery]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQuery(commandBuffer, queryPool, query, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginQuery]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
     DispatchCmdBeginQuery(commandBuffer, queryPool, query, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginQuery]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBeginQuery(commandBuffer, queryPool, query, flags);
     }
 }
@@ -3561,17 +3565,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQuery]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQuery(commandBuffer, queryPool, query);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndQuery]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
     DispatchCmdEndQuery(commandBuffer, queryPool, query);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndQuery]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdEndQuery(commandBuffer, queryPool, query);
     }
 }
@@ -3584,17 +3588,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetQueryPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
     DispatchCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     }
 }
@@ -3607,17 +3611,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteTimestamp]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
     DispatchCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteTimestamp]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     }
 }
@@ -3634,17 +3638,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyQueryPoolResults]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyQueryPoolResults]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
     DispatchCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyQueryPoolResults]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     }
 }
@@ -3659,17 +3663,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushConstants]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushConstants]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
     DispatchCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushConstants]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     }
 }
@@ -3681,17 +3685,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
     DispatchCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
     }
 }
@@ -3702,17 +3706,17 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass(commandBuffer, contents);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdNextSubpass(commandBuffer, contents);
     }
     DispatchCmdNextSubpass(commandBuffer, contents);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdNextSubpass(commandBuffer, contents);
     }
 }
@@ -3722,17 +3726,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdEndRenderPass(commandBuffer);
     }
     DispatchCmdEndRenderPass(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdEndRenderPass(commandBuffer);
     }
 }
@@ -3744,17 +3748,17 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteCommands]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdExecuteCommands]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
     DispatchCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdExecuteCommands]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
     }
 }
@@ -3767,17 +3771,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordBindBufferMemory2(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -3790,17 +3794,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordBindImageMemory2(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -3815,17 +3819,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeatures(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeatures]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeatures]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeatures]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
 }
@@ -3836,17 +3840,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMask]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMask(commandBuffer, deviceMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDeviceMask]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMask(commandBuffer, deviceMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDeviceMask]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDeviceMask(commandBuffer, deviceMask);
     }
 }
@@ -3862,17 +3866,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBase]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchBase]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchBase]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -3884,17 +3888,17 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceGroups(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     }
     VkResult result = DispatchEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties, result);
     }
     return result;
@@ -3907,17 +3911,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
 }
@@ -3929,17 +3933,17 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
     }
 }
@@ -3952,17 +3956,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -3973,17 +3977,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
     }
     DispatchGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
     }
 }
@@ -3994,17 +3998,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceProperties2(physicalDevice, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceProperties2(physicalDevice, pProperties);
     }
     DispatchGetPhysicalDeviceProperties2(physicalDevice, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceProperties2(physicalDevice, pProperties);
     }
 }
@@ -4016,17 +4020,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
     }
     DispatchGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
     }
 }
@@ -4038,17 +4042,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties, result);
     }
     return result;
@@ -4061,17 +4065,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
     DispatchGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
 }
@@ -4082,17 +4086,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
     }
     DispatchGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
     }
 }
@@ -4105,17 +4109,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
     DispatchGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
 }
@@ -4127,17 +4131,17 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPool(device, commandPool, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordTrimCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordTrimCommandPool(device, commandPool, flags);
     }
     DispatchTrimCommandPool(device, commandPool, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordTrimCommandPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordTrimCommandPool(device, commandPool, flags);
     }
 }
@@ -4149,17 +4153,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceQueue2(device, pQueueInfo, pQueue);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceQueue2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
     DispatchGetDeviceQueue2(device, pQueueInfo, pQueue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceQueue2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceQueue2(device, pQueueInfo, pQueue);
     }
 }
@@ -4172,17 +4176,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSamplerYcbcrConversion]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSamplerYcbcrConversion]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSamplerYcbcrConversion]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
     return result;
@@ -4195,17 +4199,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversion(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySamplerYcbcrConversion]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySamplerYcbcrConversion]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySamplerYcbcrConversion]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     }
 }
@@ -4218,17 +4222,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorUpdateTemplate]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorUpdateTemplate]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorUpdateTemplate]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
     return result;
@@ -4241,17 +4245,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplate(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorUpdateTemplate]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorUpdateTemplate]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorUpdateTemplate]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
     }
 }
@@ -4264,17 +4268,17 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplate(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSetWithTemplate]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSetWithTemplate]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSetWithTemplate]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
 }
@@ -4286,17 +4290,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
     DispatchGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
 }
@@ -4308,17 +4312,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFenceProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
     DispatchGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
 }
@@ -4330,17 +4334,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphoreProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
     DispatchGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
 }
@@ -4352,17 +4356,17 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupport(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutSupport]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutSupport]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutSupport]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
     }
 }
@@ -4379,17 +4383,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCount]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -4405,17 +4409,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCount]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -4428,17 +4432,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -4451,17 +4455,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
 }
@@ -4473,17 +4477,17 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
 }
@@ -4494,17 +4498,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
     }
 }
@@ -4517,17 +4521,17 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPool]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPool(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPool(device, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetQueryPool]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordResetQueryPool(device, queryPool, firstQuery, queryCount);
     }
 }
@@ -4539,17 +4543,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValue]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValue(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreCounterValue]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetSemaphoreCounterValue(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValue(device, semaphore, pValue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreCounterValue]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetSemaphoreCounterValue(device, semaphore, pValue, result);
     }
     return result;
@@ -4562,17 +4566,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphores]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphores(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitSemaphores]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordWaitSemaphores(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphores(device, pWaitInfo, timeout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitSemaphores]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordWaitSemaphores(device, pWaitInfo, timeout, result);
     }
     return result;
@@ -4584,17 +4588,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphore]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphore(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSignalSemaphore]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordSignalSemaphore(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphore(device, pSignalInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSignalSemaphore]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordSignalSemaphore(device, pSignalInfo, result);
     }
     return result;
@@ -4606,17 +4610,17 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddress]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddress]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetBufferDeviceAddress(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddress(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddress]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetBufferDeviceAddress(device, pInfo, result);
     }
     return result;
@@ -4628,17 +4632,17 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddress(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferOpaqueCaptureAddress]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferOpaqueCaptureAddress]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddress(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferOpaqueCaptureAddress]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetBufferOpaqueCaptureAddress(device, pInfo);
     }
     return result;
@@ -4650,17 +4654,17 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddress(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddress]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddress]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddress]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
     }
     return result;
@@ -4674,17 +4678,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolProperties(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, result);
     }
     return result;
@@ -4698,17 +4702,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlot(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePrivateDataSlot]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePrivateDataSlot(device, pCreateInfo, pAllocator, pPrivateDataSlot);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreatePrivateDataSlot]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreatePrivateDataSlot(device, pCreateInfo, pAllocator, pPrivateDataSlot);
     }
     VkResult result = DispatchCreatePrivateDataSlot(device, pCreateInfo, pAllocator, pPrivateDataSlot);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePrivateDataSlot]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreatePrivateDataSlot(device, pCreateInfo, pAllocator, pPrivateDataSlot, result);
     }
     return result;
@@ -4721,17 +4725,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlot(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPrivateDataSlot]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPrivateDataSlot(device, privateDataSlot, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPrivateDataSlot]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyPrivateDataSlot(device, privateDataSlot, pAllocator);
     }
     DispatchDestroyPrivateDataSlot(device, privateDataSlot, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPrivateDataSlot]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyPrivateDataSlot(device, privateDataSlot, pAllocator);
     }
 }
@@ -4745,17 +4749,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetPrivateData(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetPrivateData]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetPrivateData(device, objectType, objectHandle, privateDataSlot, data);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetPrivateData]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordSetPrivateData(device, objectType, objectHandle, privateDataSlot, data);
     }
     VkResult result = DispatchSetPrivateData(device, objectType, objectHandle, privateDataSlot, data);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetPrivateData]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordSetPrivateData(device, objectType, objectHandle, privateDataSlot, data, result);
     }
     return result;
@@ -4770,17 +4774,17 @@ VKAPI_ATTR void VKAPI_CALL GetPrivateData(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPrivateData]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPrivateData(device, objectType, objectHandle, privateDataSlot, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPrivateData]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPrivateData(device, objectType, objectHandle, privateDataSlot, pData);
     }
     DispatchGetPrivateData(device, objectType, objectHandle, privateDataSlot, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPrivateData]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPrivateData(device, objectType, objectHandle, privateDataSlot, pData);
     }
 }
@@ -4792,17 +4796,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetEvent2(commandBuffer, event, pDependencyInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetEvent2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetEvent2(commandBuffer, event, pDependencyInfo);
     }
     DispatchCmdSetEvent2(commandBuffer, event, pDependencyInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetEvent2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetEvent2(commandBuffer, event, pDependencyInfo);
     }
 }
@@ -4814,17 +4818,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetEvent2(commandBuffer, event, stageMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetEvent2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdResetEvent2(commandBuffer, event, stageMask);
     }
     DispatchCmdResetEvent2(commandBuffer, event, stageMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetEvent2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdResetEvent2(commandBuffer, event, stageMask);
     }
 }
@@ -4837,17 +4841,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWaitEvents2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
     }
     DispatchCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWaitEvents2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
     }
 }
@@ -4858,17 +4862,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPipelineBarrier2(commandBuffer, pDependencyInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPipelineBarrier2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdPipelineBarrier2(commandBuffer, pDependencyInfo);
     }
     DispatchCmdPipelineBarrier2(commandBuffer, pDependencyInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPipelineBarrier2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdPipelineBarrier2(commandBuffer, pDependencyInfo);
     }
 }
@@ -4881,17 +4885,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteTimestamp2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
     }
     DispatchCmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteTimestamp2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
     }
 }
@@ -4904,17 +4908,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSubmit2(queue, submitCount, pSubmits, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSubmit2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence);
     }
     VkResult result = DispatchQueueSubmit2(queue, submitCount, pSubmits, fence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSubmit2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, result);
     }
     return result;
@@ -4926,17 +4930,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
     }
     DispatchCmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
     }
 }
@@ -4947,17 +4951,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImage2(commandBuffer, pCopyImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyImage2(commandBuffer, pCopyImageInfo);
     }
     DispatchCmdCopyImage2(commandBuffer, pCopyImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyImage2(commandBuffer, pCopyImageInfo);
     }
 }
@@ -4968,17 +4972,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
     }
     DispatchCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
     }
 }
@@ -4989,17 +4993,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
     }
     DispatchCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
     }
 }
@@ -5010,17 +5014,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBlitImage2(commandBuffer, pBlitImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBlitImage2(commandBuffer, pBlitImageInfo);
     }
     DispatchCmdBlitImage2(commandBuffer, pBlitImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBlitImage2(commandBuffer, pBlitImageInfo);
     }
 }
@@ -5031,17 +5035,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResolveImage2(commandBuffer, pResolveImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdResolveImage2(commandBuffer, pResolveImageInfo);
     }
     DispatchCmdResolveImage2(commandBuffer, pResolveImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdResolveImage2(commandBuffer, pResolveImageInfo);
     }
 }
@@ -5052,17 +5056,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRendering(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRendering]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRendering(commandBuffer, pRenderingInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRendering]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBeginRendering(commandBuffer, pRenderingInfo);
     }
     DispatchCmdBeginRendering(commandBuffer, pRenderingInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRendering]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBeginRendering(commandBuffer, pRenderingInfo);
     }
 }
@@ -5072,17 +5076,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRendering(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRendering]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRendering(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRendering]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdEndRendering(commandBuffer);
     }
     DispatchCmdEndRendering(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRendering]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdEndRendering(commandBuffer);
     }
 }
@@ -5093,17 +5097,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullMode(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCullMode]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCullMode(commandBuffer, cullMode);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCullMode]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetCullMode(commandBuffer, cullMode);
     }
     DispatchCmdSetCullMode(commandBuffer, cullMode);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCullMode]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetCullMode(commandBuffer, cullMode);
     }
 }
@@ -5114,17 +5118,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFace(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFrontFace]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetFrontFace(commandBuffer, frontFace);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFrontFace]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetFrontFace(commandBuffer, frontFace);
     }
     DispatchCmdSetFrontFace(commandBuffer, frontFace);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFrontFace]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetFrontFace(commandBuffer, frontFace);
     }
 }
@@ -5135,17 +5139,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopology(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveTopology]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveTopology]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
     }
     DispatchCmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveTopology]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
     }
 }
@@ -5157,17 +5161,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCount(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWithCount]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWithCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
     }
     DispatchCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWithCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
     }
 }
@@ -5179,17 +5183,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCount(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissorWithCount]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissorWithCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
     }
     DispatchCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissorWithCount]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
     }
 }
@@ -5205,17 +5209,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers2]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
     DispatchCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers2]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
 }
@@ -5226,17 +5230,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthTestEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthTestEnable(commandBuffer, depthTestEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthTestEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthTestEnable(commandBuffer, depthTestEnable);
     }
     DispatchCmdSetDepthTestEnable(commandBuffer, depthTestEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthTestEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthTestEnable(commandBuffer, depthTestEnable);
     }
 }
@@ -5247,17 +5251,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthWriteEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthWriteEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
     }
     DispatchCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthWriteEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
     }
 }
@@ -5268,17 +5272,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOp(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthCompareOp]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthCompareOp(commandBuffer, depthCompareOp);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthCompareOp]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthCompareOp(commandBuffer, depthCompareOp);
     }
     DispatchCmdSetDepthCompareOp(commandBuffer, depthCompareOp);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthCompareOp]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthCompareOp(commandBuffer, depthCompareOp);
     }
 }
@@ -5289,17 +5293,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBoundsTestEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBoundsTestEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
     }
     DispatchCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBoundsTestEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
     }
 }
@@ -5310,17 +5314,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilTestEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilTestEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
     }
     DispatchCmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilTestEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
     }
 }
@@ -5335,17 +5339,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOp(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilOp]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilOp]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
     DispatchCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilOp]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
 }
@@ -5356,17 +5360,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRasterizerDiscardEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRasterizerDiscardEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
     }
     DispatchCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRasterizerDiscardEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
     }
 }
@@ -5377,17 +5381,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBiasEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBiasEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
     }
     DispatchCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBiasEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
     }
 }
@@ -5398,17 +5402,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnable(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveRestartEnable]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveRestartEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
     }
     DispatchCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveRestartEnable]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
     }
 }
@@ -5420,17 +5424,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceBufferMemoryRequirements]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceBufferMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
     }
     DispatchGetDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceBufferMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
     }
 }
@@ -5442,17 +5446,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceImageMemoryRequirements]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceImageMemoryRequirements(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceImageMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceImageMemoryRequirements(device, pInfo, pMemoryRequirements);
     }
     DispatchGetDeviceImageMemoryRequirements(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceImageMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceImageMemoryRequirements(device, pInfo, pMemoryRequirements);
     }
 }
@@ -5465,17 +5469,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageSparseMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceImageSparseMemoryRequirements]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceImageSparseMemoryRequirements(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceImageSparseMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceImageSparseMemoryRequirements(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetDeviceImageSparseMemoryRequirements(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceImageSparseMemoryRequirements]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceImageSparseMemoryRequirements(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -5488,17 +5492,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySurfaceKHR(instance, surface, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroySurfaceKHR(instance, surface, pAllocator);
     }
     DispatchDestroySurfaceKHR(instance, surface, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroySurfaceKHR(instance, surface, pAllocator);
     }
 }
@@ -5511,17 +5515,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported, result);
     }
     return result;
@@ -5534,17 +5538,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilitiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities, result);
     }
     return result;
@@ -5558,17 +5562,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormatsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats, result);
     }
     return result;
@@ -5582,17 +5586,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes, result);
     }
     return result;
@@ -5607,17 +5611,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSwapchainKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSwapchainKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
     }
     VkResult result = DispatchCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSwapchainKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain, result);
     }
     return result;
@@ -5630,17 +5634,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySwapchainKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySwapchainKHR(device, swapchain, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySwapchainKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
     DispatchDestroySwapchainKHR(device, swapchain, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySwapchainKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
     }
 }
@@ -5653,17 +5657,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainImagesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainImagesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
     }
     VkResult result = DispatchGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainImagesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages, result);
     }
     return result;
@@ -5679,17 +5683,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImageKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireNextImageKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireNextImageKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex, result);
     }
     return result;
@@ -5701,17 +5705,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueuePresentKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueuePresentKHR(queue, pPresentInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueuePresentKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordQueuePresentKHR(queue, pPresentInfo);
     }
     VkResult result = DispatchQueuePresentKHR(queue, pPresentInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueuePresentKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordQueuePresentKHR(queue, pPresentInfo, result);
     }
     return result;
@@ -5723,17 +5727,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupPresentCapabilitiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPresentCapabilitiesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPresentCapabilitiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
     }
     VkResult result = DispatchGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPresentCapabilitiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities, result);
     }
     return result;
@@ -5746,17 +5750,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes, result);
     }
     return result;
@@ -5770,17 +5774,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDevicePresentRectanglesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
     }
     VkResult result = DispatchGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects, result);
     }
     return result;
@@ -5793,17 +5797,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImage2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImage2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireNextImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
     }
     VkResult result = DispatchAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireNextImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex, result);
     }
     return result;
@@ -5817,17 +5821,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties, result);
     }
     return result;
@@ -5840,17 +5844,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPlanePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties, result);
     }
     return result;
@@ -5864,17 +5868,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneSupportedDisplaysKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
     }
     VkResult result = DispatchGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays, result);
     }
     return result;
@@ -5888,17 +5892,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties, result);
     }
     return result;
@@ -5913,17 +5917,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayModeKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
     }
     VkResult result = DispatchCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode, result);
     }
     return result;
@@ -5937,17 +5941,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilitiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
     }
     VkResult result = DispatchGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities, result);
     }
     return result;
@@ -5961,17 +5965,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayPlaneSurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -5987,17 +5991,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSharedSwapchainsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSharedSwapchainsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
     }
     VkResult result = DispatchCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSharedSwapchainsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains, result);
     }
     return result;
@@ -6013,17 +6017,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateXlibSurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -6037,17 +6041,17 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXlibPresentationSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
     }
     VkBool32 result = DispatchGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
     }
     return result;
@@ -6064,17 +6068,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateXcbSurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -6088,17 +6092,17 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXcbPresentationSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
     }
     VkBool32 result = DispatchGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
     }
     return result;
@@ -6115,17 +6119,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateWaylandSurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -6138,17 +6142,17 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWaylandPresentationSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
     }
     VkBool32 result = DispatchGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
     }
     return result;
@@ -6165,17 +6169,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAndroidSurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -6192,17 +6196,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateWin32SurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -6214,17 +6218,17 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWin32PresentationSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
     }
     VkBool32 result = DispatchGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
     }
     return result;
@@ -6241,17 +6245,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceVideoCapabilitiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceVideoCapabilitiesKHR(physicalDevice, pVideoProfile, pCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceVideoCapabilitiesKHR(physicalDevice, pVideoProfile, pCapabilities);
     }
     VkResult result = DispatchGetPhysicalDeviceVideoCapabilitiesKHR(physicalDevice, pVideoProfile, pCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceVideoCapabilitiesKHR(physicalDevice, pVideoProfile, pCapabilities, result);
     }
     return result;
@@ -6265,17 +6269,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceVideoFormatPropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceVideoFormatPropertiesKHR(physicalDevice, pVideoFormatInfo, pVideoFormatPropertyCount, pVideoFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceVideoFormatPropertiesKHR(physicalDevice, pVideoFormatInfo, pVideoFormatPropertyCount, pVideoFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceVideoFormatPropertiesKHR(physicalDevice, pVideoFormatInfo, pVideoFormatPropertyCount, pVideoFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceVideoFormatPropertiesKHR(physicalDevice, pVideoFormatInfo, pVideoFormatPropertyCount, pVideoFormatProperties, result);
     }
     return result;
@@ -6289,17 +6293,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateVideoSessionKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateVideoSessionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession);
     }
     VkResult result = DispatchCreateVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateVideoSessionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession, result);
     }
     return result;
@@ -6312,17 +6316,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyVideoSessionKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyVideoSessionKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyVideoSessionKHR(device, videoSession, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyVideoSessionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyVideoSessionKHR(device, videoSession, pAllocator);
     }
     DispatchDestroyVideoSessionKHR(device, videoSession, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyVideoSessionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyVideoSessionKHR(device, videoSession, pAllocator);
     }
 }
@@ -6335,17 +6339,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetVideoSessionMemoryRequirementsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetVideoSessionMemoryRequirementsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetVideoSessionMemoryRequirementsKHR(device, videoSession, pMemoryRequirementsCount, pMemoryRequirements);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetVideoSessionMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetVideoSessionMemoryRequirementsKHR(device, videoSession, pMemoryRequirementsCount, pMemoryRequirements);
     }
     VkResult result = DispatchGetVideoSessionMemoryRequirementsKHR(device, videoSession, pMemoryRequirementsCount, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetVideoSessionMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetVideoSessionMemoryRequirementsKHR(device, videoSession, pMemoryRequirementsCount, pMemoryRequirements, result);
     }
     return result;
@@ -6359,17 +6363,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindVideoSessionMemoryKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindVideoSessionMemoryKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindVideoSessionMemoryKHR(device, videoSession, bindSessionMemoryInfoCount, pBindSessionMemoryInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindVideoSessionMemoryKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordBindVideoSessionMemoryKHR(device, videoSession, bindSessionMemoryInfoCount, pBindSessionMemoryInfos);
     }
     VkResult result = DispatchBindVideoSessionMemoryKHR(device, videoSession, bindSessionMemoryInfoCount, pBindSessionMemoryInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindVideoSessionMemoryKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordBindVideoSessionMemoryKHR(device, videoSession, bindSessionMemoryInfoCount, pBindSessionMemoryInfos, result);
     }
     return result;
@@ -6383,17 +6387,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionParametersKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateVideoSessionParametersKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateVideoSessionParametersKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters);
     }
     VkResult result = DispatchCreateVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateVideoSessionParametersKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters, result);
     }
     return result;
@@ -6406,17 +6410,17 @@ VKAPI_ATTR VkResult VKAPI_CALL UpdateVideoSessionParametersKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateVideoSessionParametersKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateVideoSessionParametersKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordUpdateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo);
     }
     VkResult result = DispatchUpdateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateVideoSessionParametersKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordUpdateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo, result);
     }
     return result;
@@ -6429,17 +6433,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyVideoSessionParametersKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyVideoSessionParametersKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyVideoSessionParametersKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
     }
     DispatchDestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyVideoSessionParametersKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
     }
 }
@@ -6450,17 +6454,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginVideoCodingKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginVideoCodingKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginVideoCodingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
     }
     DispatchCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginVideoCodingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
     }
 }
@@ -6471,17 +6475,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndVideoCodingKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndVideoCodingKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndVideoCodingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
     }
     DispatchCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndVideoCodingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
     }
 }
@@ -6492,17 +6496,17 @@ VKAPI_ATTR void VKAPI_CALL CmdControlVideoCodingKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdControlVideoCodingKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdControlVideoCodingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
     }
     DispatchCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdControlVideoCodingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
     }
 }
@@ -6516,17 +6520,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDecodeVideoKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDecodeVideoKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDecodeVideoKHR(commandBuffer, pDecodeInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDecodeVideoKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDecodeVideoKHR(commandBuffer, pDecodeInfo);
     }
     DispatchCmdDecodeVideoKHR(commandBuffer, pDecodeInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDecodeVideoKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDecodeVideoKHR(commandBuffer, pDecodeInfo);
     }
 }
@@ -6539,17 +6543,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderingKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderingKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
     }
     DispatchCmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
     }
 }
@@ -6559,17 +6563,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderingKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderingKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderingKHR(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdEndRenderingKHR(commandBuffer);
     }
     DispatchCmdEndRenderingKHR(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderingKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdEndRenderingKHR(commandBuffer);
     }
 }
@@ -6582,17 +6586,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
     }
     DispatchGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
     }
 }
@@ -6603,17 +6607,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
     }
     DispatchGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
     }
 }
@@ -6625,17 +6629,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
     }
     DispatchGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
     }
 }
@@ -6647,17 +6651,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties, result);
     }
     return result;
@@ -6670,17 +6674,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
     DispatchGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
     }
 }
@@ -6691,17 +6695,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
     }
     DispatchGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
     }
 }
@@ -6714,17 +6718,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
     DispatchGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
     }
 }
@@ -6739,17 +6743,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeaturesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
     DispatchGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
     }
 }
@@ -6760,17 +6764,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMaskKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMaskKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDeviceMaskKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
     DispatchCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDeviceMaskKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
     }
 }
@@ -6786,17 +6790,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBaseKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDispatchBaseKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDispatchBaseKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -6810,17 +6814,17 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPoolKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPoolKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateTrimCommandPoolKHR(device, commandPool, flags);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordTrimCommandPoolKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
     DispatchTrimCommandPoolKHR(device, commandPool, flags);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordTrimCommandPoolKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordTrimCommandPoolKHR(device, commandPool, flags);
     }
 }
@@ -6833,17 +6837,17 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceGroupsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     }
     VkResult result = DispatchEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties, result);
     }
     return result;
@@ -6857,17 +6861,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferPropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
     DispatchGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
     }
 }
@@ -6882,17 +6886,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -6906,17 +6910,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandlePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandlePropertiesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandlePropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
     }
     VkResult result = DispatchGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandlePropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties, result);
     }
     return result;
@@ -6931,17 +6935,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetMemoryFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetMemoryFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -6955,17 +6959,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdPropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdPropertiesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryFdPropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
     }
     VkResult result = DispatchGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryFdPropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties, result);
     }
     return result;
@@ -6982,17 +6986,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphorePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
     DispatchGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
     }
 }
@@ -7006,17 +7010,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreWin32HandleKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportSemaphoreWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
     }
     VkResult result = DispatchImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportSemaphoreWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo, result);
     }
     return result;
@@ -7029,17 +7033,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreWin32HandleKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -7053,17 +7057,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreFdKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportSemaphoreFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
     }
     VkResult result = DispatchImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportSemaphoreFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo, result);
     }
     return result;
@@ -7076,17 +7080,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreFdKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetSemaphoreFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -7103,17 +7107,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSetKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
     DispatchCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSetKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
     }
 }
@@ -7127,17 +7131,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplateKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPushDescriptorSetWithTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
     DispatchCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
     }
 }
@@ -7154,17 +7158,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorUpdateTemplateKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDescriptorUpdateTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     }
     VkResult result = DispatchCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDescriptorUpdateTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate, result);
     }
     return result;
@@ -7177,17 +7181,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorUpdateTemplateKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDescriptorUpdateTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
     DispatchDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDescriptorUpdateTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
     }
 }
@@ -7200,17 +7204,17 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSetWithTemplateKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUpdateDescriptorSetWithTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
     DispatchUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUpdateDescriptorSetWithTemplateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
     }
 }
@@ -7225,17 +7229,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
     }
     VkResult result = DispatchCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateRenderPass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass, result);
     }
     return result;
@@ -7248,17 +7252,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginRenderPass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
     DispatchCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginRenderPass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
     }
 }
@@ -7270,17 +7274,17 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdNextSubpass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
     DispatchCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdNextSubpass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
     }
 }
@@ -7291,17 +7295,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndRenderPass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
     DispatchCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndRenderPass2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
     }
 }
@@ -7313,17 +7317,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainStatusKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainStatusKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainStatusKHR(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainStatusKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetSwapchainStatusKHR(device, swapchain);
     }
     VkResult result = DispatchGetSwapchainStatusKHR(device, swapchain);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainStatusKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetSwapchainStatusKHR(device, swapchain, result);
     }
     return result;
@@ -7337,17 +7341,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFencePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
     DispatchGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
     }
 }
@@ -7361,17 +7365,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceWin32HandleKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportFenceWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
     }
     VkResult result = DispatchImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportFenceWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo, result);
     }
     return result;
@@ -7384,17 +7388,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceWin32HandleKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceWin32HandleKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     }
     VkResult result = DispatchGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceWin32HandleKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle, result);
     }
     return result;
@@ -7408,17 +7412,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceFdKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportFenceFdKHR(device, pImportFenceFdInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportFenceFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordImportFenceFdKHR(device, pImportFenceFdInfo);
     }
     VkResult result = DispatchImportFenceFdKHR(device, pImportFenceFdInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportFenceFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordImportFenceFdKHR(device, pImportFenceFdInfo, result);
     }
     return result;
@@ -7431,17 +7435,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceFdKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceFdKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFenceFdKHR(device, pGetFdInfo, pFd);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFenceFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd);
     }
     VkResult result = DispatchGetFenceFdKHR(device, pGetFdInfo, pFd);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFenceFdKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetFenceFdKHR(device, pGetFdInfo, pFd, result);
     }
     return result;
@@ -7457,17 +7461,17 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceQueueFamilyPerformanceQuer
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
     }
     VkResult result = DispatchEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions, result);
     }
     return result;
@@ -7480,17 +7484,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
     }
     DispatchGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
     }
 }
@@ -7501,17 +7505,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireProfilingLockKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireProfilingLockKHR(device, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireProfilingLockKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordAcquireProfilingLockKHR(device, pInfo);
     }
     VkResult result = DispatchAcquireProfilingLockKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireProfilingLockKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordAcquireProfilingLockKHR(device, pInfo, result);
     }
     return result;
@@ -7522,17 +7526,17 @@ VKAPI_ATTR void VKAPI_CALL ReleaseProfilingLockKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseProfilingLockKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseProfilingLockKHR(device);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleaseProfilingLockKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordReleaseProfilingLockKHR(device);
     }
     DispatchReleaseProfilingLockKHR(device);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleaseProfilingLockKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordReleaseProfilingLockKHR(device);
     }
 }
@@ -7546,17 +7550,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilities2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities, result);
     }
     return result;
@@ -7570,17 +7574,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormats2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats, result);
     }
     return result;
@@ -7595,17 +7599,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties, result);
     }
     return result;
@@ -7618,17 +7622,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPlaneProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties, result);
     }
     return result;
@@ -7642,17 +7646,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModeProperties2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties, result);
     }
     return result;
@@ -7665,17 +7669,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilities2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
     }
     VkResult result = DispatchGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities, result);
     }
     return result;
@@ -7692,17 +7696,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageMemoryRequirements2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageMemoryRequirements2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -7714,17 +7718,17 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferMemoryRequirements2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferMemoryRequirements2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -7737,17 +7741,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSparseMemoryRequirements2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSparseMemoryRequirements2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSparseMemoryRequirements2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -7762,17 +7766,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversionKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSamplerYcbcrConversionKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateSamplerYcbcrConversionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
     }
     VkResult result = DispatchCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateSamplerYcbcrConversionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion, result);
     }
     return result;
@@ -7785,17 +7789,17 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversionKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySamplerYcbcrConversionKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroySamplerYcbcrConversionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
     DispatchDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroySamplerYcbcrConversionKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     }
 }
@@ -7808,17 +7812,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindBufferMemory2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindBufferMemory2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordBindBufferMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -7831,17 +7835,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindImageMemory2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindImageMemory2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordBindImageMemory2KHR(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -7858,17 +7862,17 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutSupportKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutSupportKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
     DispatchGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutSupportKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
     }
 }
@@ -7885,17 +7889,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCountKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCountKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -7911,17 +7915,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCountKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCountKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCountKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -7943,17 +7947,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValueKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValueKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreCounterValueKHR(device, semaphore, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreCounterValueKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue);
     }
     VkResult result = DispatchGetSemaphoreCounterValueKHR(device, semaphore, pValue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreCounterValueKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetSemaphoreCounterValueKHR(device, semaphore, pValue, result);
     }
     return result;
@@ -7966,17 +7970,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphoresKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphoresKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitSemaphoresKHR(device, pWaitInfo, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitSemaphoresKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout);
     }
     VkResult result = DispatchWaitSemaphoresKHR(device, pWaitInfo, timeout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitSemaphoresKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordWaitSemaphoresKHR(device, pWaitInfo, timeout, result);
     }
     return result;
@@ -7988,17 +7992,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphoreKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphoreKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSignalSemaphoreKHR(device, pSignalInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSignalSemaphoreKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordSignalSemaphoreKHR(device, pSignalInfo);
     }
     VkResult result = DispatchSignalSemaphoreKHR(device, pSignalInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSignalSemaphoreKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordSignalSemaphoreKHR(device, pSignalInfo, result);
     }
     return result;
@@ -8014,17 +8018,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceFragmentShadingRatesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceFragmentShadingRatesKHR(physicalDevice, pFragmentShadingRateCount, pFragmentShadingRates);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceFragmentShadingRatesKHR(physicalDevice, pFragmentShadingRateCount, pFragmentShadingRates);
     }
     VkResult result = DispatchGetPhysicalDeviceFragmentShadingRatesKHR(physicalDevice, pFragmentShadingRateCount, pFragmentShadingRates);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceFragmentShadingRatesKHR(physicalDevice, pFragmentShadingRateCount, pFragmentShadingRates, result);
     }
     return result;
@@ -8037,17 +8041,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFragmentShadingRateKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFragmentShadingRateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
     }
     DispatchCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFragmentShadingRateKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
     }
 }
@@ -8064,17 +8068,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForPresentKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitForPresentKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWaitForPresentKHR(device, swapchain, presentId, timeout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWaitForPresentKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordWaitForPresentKHR(device, swapchain, presentId, timeout);
     }
     VkResult result = DispatchWaitForPresentKHR(device, swapchain, presentId, timeout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWaitForPresentKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordWaitForPresentKHR(device, swapchain, presentId, timeout, result);
     }
     return result;
@@ -8088,17 +8092,17 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetBufferDeviceAddressKHR(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetBufferDeviceAddressKHR(device, pInfo, result);
     }
     return result;
@@ -8110,17 +8114,17 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddressKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferOpaqueCaptureAddressKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferOpaqueCaptureAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferOpaqueCaptureAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetBufferOpaqueCaptureAddressKHR(device, pInfo);
     }
     return result;
@@ -8132,17 +8136,17 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
     uint64_t result = DispatchGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
     }
     return result;
@@ -8156,17 +8160,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDeferredOperationKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDeferredOperationKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateDeferredOperationKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
     }
     VkResult result = DispatchCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateDeferredOperationKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation, result);
     }
     return result;
@@ -8179,17 +8183,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyDeferredOperationKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDeferredOperationKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDeferredOperationKHR(device, operation, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyDeferredOperationKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyDeferredOperationKHR(device, operation, pAllocator);
     }
     DispatchDestroyDeferredOperationKHR(device, operation, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyDeferredOperationKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyDeferredOperationKHR(device, operation, pAllocator);
     }
 }
@@ -8200,17 +8204,17 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetDeferredOperationMaxConcurrencyKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeferredOperationMaxConcurrencyKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeferredOperationMaxConcurrencyKHR(device, operation);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeferredOperationMaxConcurrencyKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeferredOperationMaxConcurrencyKHR(device, operation);
     }
     uint32_t result = DispatchGetDeferredOperationMaxConcurrencyKHR(device, operation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeferredOperationMaxConcurrencyKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeferredOperationMaxConcurrencyKHR(device, operation);
     }
     return result;
@@ -8222,17 +8226,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeferredOperationResultKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeferredOperationResultKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeferredOperationResultKHR(device, operation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeferredOperationResultKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeferredOperationResultKHR(device, operation);
     }
     VkResult result = DispatchGetDeferredOperationResultKHR(device, operation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeferredOperationResultKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeferredOperationResultKHR(device, operation, result);
     }
     return result;
@@ -8244,17 +8248,17 @@ VKAPI_ATTR VkResult VKAPI_CALL DeferredOperationJoinKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeferredOperationJoinKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDeferredOperationJoinKHR(device, operation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDeferredOperationJoinKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDeferredOperationJoinKHR(device, operation);
     }
     VkResult result = DispatchDeferredOperationJoinKHR(device, operation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDeferredOperationJoinKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDeferredOperationJoinKHR(device, operation, result);
     }
     return result;
@@ -8269,17 +8273,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutablePropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutablePropertiesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutablePropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
     }
     VkResult result = DispatchGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutablePropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties, result);
     }
     return result;
@@ -8293,17 +8297,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableStatisticsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutableStatisticsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutableStatisticsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
     }
     VkResult result = DispatchGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutableStatisticsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics, result);
     }
     return result;
@@ -8317,17 +8321,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableInternalRepresentationsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineExecutableInternalRepresentationsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelineExecutableInternalRepresentationsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
     }
     VkResult result = DispatchGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelineExecutableInternalRepresentationsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations, result);
     }
     return result;
@@ -8345,17 +8349,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEncodeVideoKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEncodeVideoKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEncodeVideoKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
     }
     DispatchCmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEncodeVideoKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
     }
 }
@@ -8369,17 +8373,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetEvent2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
     }
     DispatchCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetEvent2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
     }
 }
@@ -8391,17 +8395,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResetEvent2KHR(commandBuffer, event, stageMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResetEvent2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdResetEvent2KHR(commandBuffer, event, stageMask);
     }
     DispatchCmdResetEvent2KHR(commandBuffer, event, stageMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResetEvent2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdResetEvent2KHR(commandBuffer, event, stageMask);
     }
 }
@@ -8414,17 +8418,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWaitEvents2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
     }
     DispatchCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWaitEvents2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
     }
 }
@@ -8435,17 +8439,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPipelineBarrier2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
     }
     DispatchCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPipelineBarrier2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
     }
 }
@@ -8458,17 +8462,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteTimestamp2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
     }
     DispatchCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteTimestamp2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
     }
 }
@@ -8481,17 +8485,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSubmit2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
     }
     VkResult result = DispatchQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSubmit2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, result);
     }
     return result;
@@ -8506,17 +8510,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarker2AMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteBufferMarker2AMD]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteBufferMarker2AMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
     }
     DispatchCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteBufferMarker2AMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
     }
 }
@@ -8528,17 +8532,17 @@ VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointData2NV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueueCheckpointData2NV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetQueueCheckpointData2NV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
     }
     DispatchGetQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetQueueCheckpointData2NV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
     }
 }
@@ -8554,17 +8558,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBuffer2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
     }
     DispatchCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBuffer2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
     }
 }
@@ -8575,17 +8579,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
     }
     DispatchCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
     }
 }
@@ -8596,17 +8600,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyBufferToImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
     }
     DispatchCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyBufferToImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
     }
 }
@@ -8617,17 +8621,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyImageToBuffer2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
     }
     DispatchCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyImageToBuffer2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
     }
 }
@@ -8638,17 +8642,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBlitImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
     }
     DispatchCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBlitImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
     }
 }
@@ -8659,17 +8663,17 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdResolveImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
     }
     DispatchCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdResolveImage2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
     }
 }
@@ -8682,17 +8686,17 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirect2KHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysIndirect2KHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysIndirect2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
     }
     DispatchCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysIndirect2KHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
     }
 }
@@ -8706,17 +8710,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirementsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceBufferMemoryRequirementsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceBufferMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceBufferMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceBufferMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetDeviceBufferMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceBufferMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceBufferMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -8728,17 +8732,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageMemoryRequirementsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceImageMemoryRequirementsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceImageMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceImageMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceImageMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     }
     DispatchGetDeviceImageMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceImageMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceImageMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
     }
 }
@@ -8751,17 +8755,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageSparseMemoryRequirementsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceImageSparseMemoryRequirementsKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceImageSparseMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
     DispatchGetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceImageSparseMemoryRequirementsKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     }
 }
@@ -8775,18 +8779,18 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDebugReportCallbackEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
     }
     VkResult result = DispatchCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
     layer_create_report_callback(layer_data->report_data, false, pCreateInfo, pAllocator, pCallback);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback, result);
     }
     return result;
@@ -8799,18 +8803,18 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugReportCallbackEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
     }
     DispatchDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
     layer_destroy_callback(layer_data->report_data, callback, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyDebugReportCallbackEXT(instance, callback, pAllocator);
     }
 }
@@ -8827,17 +8831,17 @@ VKAPI_ATTR void VKAPI_CALL DebugReportMessageEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
     }
     DispatchDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
     }
 }
@@ -8855,17 +8859,17 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectTagEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDebugMarkerSetObjectTagEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDebugMarkerSetObjectTagEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchDebugMarkerSetObjectTagEXT(device, pTagInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDebugMarkerSetObjectTagEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDebugMarkerSetObjectTagEXT(device, pTagInfo, result);
     }
     return result;
@@ -8877,18 +8881,18 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectNameEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDebugMarkerSetObjectNameEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDebugMarkerSetObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDebugMarkerSetObjectNameEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetMarkerObjectName(pNameInfo);
     VkResult result = DispatchDebugMarkerSetObjectNameEXT(device, pNameInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDebugMarkerSetObjectNameEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDebugMarkerSetObjectNameEXT(device, pNameInfo, result);
     }
     return result;
@@ -8900,17 +8904,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerBeginEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerBeginEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerBeginEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
     }
 }
@@ -8920,17 +8924,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerEndEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerEndEXT(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerEndEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
     DispatchCmdDebugMarkerEndEXT(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerEndEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDebugMarkerEndEXT(commandBuffer);
     }
 }
@@ -8941,17 +8945,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerInsertEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDebugMarkerInsertEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
     DispatchCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDebugMarkerInsertEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
     }
 }
@@ -8969,17 +8973,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindTransformFeedbackBuffersEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindTransformFeedbackBuffersEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindTransformFeedbackBuffersEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
     DispatchCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindTransformFeedbackBuffersEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
     }
 }
@@ -8993,17 +8997,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginTransformFeedbackEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginTransformFeedbackEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginTransformFeedbackEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginTransformFeedbackEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
 }
@@ -9017,17 +9021,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndTransformFeedbackEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndTransformFeedbackEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
     DispatchCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndTransformFeedbackEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
     }
 }
@@ -9041,17 +9045,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQueryIndexedEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginQueryIndexedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
     DispatchCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginQueryIndexedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     }
 }
@@ -9064,17 +9068,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQueryIndexedEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQueryIndexedEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndQueryIndexedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
     DispatchCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndQueryIndexedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     }
 }
@@ -9090,17 +9094,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectByteCountEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectByteCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
     DispatchCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectByteCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     }
 }
@@ -9114,17 +9118,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCuModuleNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCuModuleNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateCuModuleNVX(device, pCreateInfo, pAllocator, pModule);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateCuModuleNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateCuModuleNVX(device, pCreateInfo, pAllocator, pModule);
     }
     VkResult result = DispatchCreateCuModuleNVX(device, pCreateInfo, pAllocator, pModule);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateCuModuleNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateCuModuleNVX(device, pCreateInfo, pAllocator, pModule, result);
     }
     return result;
@@ -9138,17 +9142,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCuFunctionNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCuFunctionNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateCuFunctionNVX(device, pCreateInfo, pAllocator, pFunction);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateCuFunctionNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateCuFunctionNVX(device, pCreateInfo, pAllocator, pFunction);
     }
     VkResult result = DispatchCreateCuFunctionNVX(device, pCreateInfo, pAllocator, pFunction);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateCuFunctionNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateCuFunctionNVX(device, pCreateInfo, pAllocator, pFunction, result);
     }
     return result;
@@ -9161,17 +9165,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyCuModuleNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCuModuleNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyCuModuleNVX(device, module, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyCuModuleNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyCuModuleNVX(device, module, pAllocator);
     }
     DispatchDestroyCuModuleNVX(device, module, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyCuModuleNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyCuModuleNVX(device, module, pAllocator);
     }
 }
@@ -9183,17 +9187,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyCuFunctionNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCuFunctionNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyCuFunctionNVX(device, function, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyCuFunctionNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyCuFunctionNVX(device, function, pAllocator);
     }
     DispatchDestroyCuFunctionNVX(device, function, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyCuFunctionNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyCuFunctionNVX(device, function, pAllocator);
     }
 }
@@ -9204,17 +9208,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCuLaunchKernelNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCuLaunchKernelNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCuLaunchKernelNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo);
     }
     DispatchCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCuLaunchKernelNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo);
     }
 }
@@ -9226,17 +9230,17 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetImageViewHandleNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewHandleNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageViewHandleNVX(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageViewHandleNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetImageViewHandleNVX(device, pInfo);
     }
     uint32_t result = DispatchGetImageViewHandleNVX(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageViewHandleNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetImageViewHandleNVX(device, pInfo);
     }
     return result;
@@ -9249,17 +9253,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageViewAddressNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewAddressNVX]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageViewAddressNVX(device, imageView, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageViewAddressNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetImageViewAddressNVX(device, imageView, pProperties);
     }
     VkResult result = DispatchGetImageViewAddressNVX(device, imageView, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageViewAddressNVX]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetImageViewAddressNVX(device, imageView, pProperties, result);
     }
     return result;
@@ -9277,17 +9281,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountAMD]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndirectCountAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndirectCountAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -9303,17 +9307,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCountAMD]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawIndexedIndirectCountAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawIndexedIndirectCountAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -9342,17 +9346,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderInfoAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetShaderInfoAMD]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetShaderInfoAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     }
     VkResult result = DispatchGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetShaderInfoAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo, result);
     }
     return result;
@@ -9369,17 +9373,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateStreamDescriptorSurfaceGGP(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -9401,17 +9405,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceExternalImageFormatPropertiesNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties, result);
     }
     return result;
@@ -9428,17 +9432,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryWin32HandleNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
     }
     VkResult result = DispatchGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryWin32HandleNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetMemoryWin32HandleNV(device, memory, handleType, pHandle, result);
     }
     return result;
@@ -9459,17 +9463,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateViSurfaceNN(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -9488,17 +9492,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginConditionalRenderingEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginConditionalRenderingEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
     DispatchCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginConditionalRenderingEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
     }
 }
@@ -9508,17 +9512,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndConditionalRenderingEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndConditionalRenderingEXT(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndConditionalRenderingEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
     DispatchCmdEndConditionalRenderingEXT(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndConditionalRenderingEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdEndConditionalRenderingEXT(commandBuffer);
     }
 }
@@ -9532,17 +9536,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWScalingNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWScalingNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
     DispatchCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWScalingNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
     }
 }
@@ -9554,17 +9558,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleaseDisplayEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseDisplayEXT(physicalDevice, display);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordReleaseDisplayEXT(physicalDevice, display);
     }
     VkResult result = DispatchReleaseDisplayEXT(physicalDevice, display);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordReleaseDisplayEXT(physicalDevice, display, result);
     }
     return result;
@@ -9579,17 +9583,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireXlibDisplayEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireXlibDisplayEXT(physicalDevice, dpy, display);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordAcquireXlibDisplayEXT(physicalDevice, dpy, display);
     }
     VkResult result = DispatchAcquireXlibDisplayEXT(physicalDevice, dpy, display);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordAcquireXlibDisplayEXT(physicalDevice, dpy, display, result);
     }
     return result;
@@ -9603,17 +9607,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRandROutputDisplayEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
     }
     VkResult result = DispatchGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay, result);
     }
     return result;
@@ -9628,17 +9632,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilities2EXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities, result);
     }
     return result;
@@ -9652,17 +9656,17 @@ VKAPI_ATTR VkResult VKAPI_CALL DisplayPowerControlEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDisplayPowerControlEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDisplayPowerControlEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
     }
     VkResult result = DispatchDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDisplayPowerControlEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDisplayPowerControlEXT(device, display, pDisplayPowerInfo, result);
     }
     return result;
@@ -9676,17 +9680,17 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDeviceEventEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDeviceEventEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordRegisterDeviceEventEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordRegisterDeviceEventEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence, result);
     }
     return result;
@@ -9701,17 +9705,17 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDisplayEventEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordRegisterDisplayEventEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     }
     VkResult result = DispatchRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordRegisterDisplayEventEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence, result);
     }
     return result;
@@ -9725,17 +9729,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainCounterEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainCounterEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSwapchainCounterEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
     }
     VkResult result = DispatchGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSwapchainCounterEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue, result);
     }
     return result;
@@ -9749,17 +9753,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRefreshCycleDurationGOOGLE(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRefreshCycleDurationGOOGLE]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRefreshCycleDurationGOOGLE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
     }
     VkResult result = DispatchGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRefreshCycleDurationGOOGLE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties, result);
     }
     return result;
@@ -9773,17 +9777,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPastPresentationTimingGOOGLE(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPastPresentationTimingGOOGLE]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPastPresentationTimingGOOGLE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
     }
     VkResult result = DispatchGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPastPresentationTimingGOOGLE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings, result);
     }
     return result;
@@ -9803,17 +9807,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDiscardRectangleEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDiscardRectangleEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
     DispatchCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDiscardRectangleEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
     }
 }
@@ -9830,17 +9834,17 @@ VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetHdrMetadataEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetHdrMetadataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
     DispatchSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetHdrMetadataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
     }
 }
@@ -9855,17 +9859,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIOSSurfaceMVK(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -9882,17 +9886,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMacOSSurfaceMVK(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -9908,18 +9912,18 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectNameEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDebugUtilsObjectNameEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectNameEXT(device, pNameInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetDebugUtilsObjectNameEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo);
     }
     layer_data->report_data->DebugReportSetUtilsObjectName(pNameInfo);
     VkResult result = DispatchSetDebugUtilsObjectNameEXT(device, pNameInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetDebugUtilsObjectNameEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordSetDebugUtilsObjectNameEXT(device, pNameInfo, result);
     }
     return result;
@@ -9931,17 +9935,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectTagEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDebugUtilsObjectTagEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDebugUtilsObjectTagEXT(device, pTagInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetDebugUtilsObjectTagEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo);
     }
     VkResult result = DispatchSetDebugUtilsObjectTagEXT(device, pTagInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetDebugUtilsObjectTagEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordSetDebugUtilsObjectTagEXT(device, pTagInfo, result);
     }
     return result;
@@ -9953,18 +9957,18 @@ VKAPI_ATTR void VKAPI_CALL QueueBeginDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueBeginDebugUtilsLabelEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueBeginDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     BeginQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueBeginDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
     }
 }
@@ -9974,18 +9978,18 @@ VKAPI_ATTR void VKAPI_CALL QueueEndDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueEndDebugUtilsLabelEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueEndDebugUtilsLabelEXT(queue);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueEndDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
     DispatchQueueEndDebugUtilsLabelEXT(queue);
     EndQueueDebugUtilsLabel(layer_data->report_data, queue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueEndDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordQueueEndDebugUtilsLabelEXT(queue);
     }
 }
@@ -9996,18 +10000,18 @@ VKAPI_ATTR void VKAPI_CALL QueueInsertDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueInsertDebugUtilsLabelEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueInsertDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
     InsertQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);
     DispatchQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueInsertDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
     }
 }
@@ -10018,17 +10022,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginDebugUtilsLabelEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBeginDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBeginDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
 }
@@ -10038,17 +10042,17 @@ VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdEndDebugUtilsLabelEXT(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdEndDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
     DispatchCmdEndDebugUtilsLabelEXT(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdEndDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer);
     }
 }
@@ -10059,17 +10063,17 @@ VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdInsertDebugUtilsLabelEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdInsertDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
     DispatchCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdInsertDebugUtilsLabelEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
     }
 }
@@ -10082,18 +10086,18 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDebugUtilsMessengerEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
     }
     VkResult result = DispatchCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
     layer_create_messenger_callback(layer_data->report_data, false, pCreateInfo, pAllocator, pMessenger);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger, result);
     }
     return result;
@@ -10106,18 +10110,18 @@ VKAPI_ATTR void VKAPI_CALL DestroyDebugUtilsMessengerEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
     }
     DispatchDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
     layer_destroy_callback(layer_data->report_data, messenger, pAllocator);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
     }
 }
@@ -10130,17 +10134,17 @@ VKAPI_ATTR void VKAPI_CALL SubmitDebugUtilsMessageEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
     }
     DispatchSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
     }
 }
@@ -10154,17 +10158,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAndroidHardwareBufferPropertiesANDROID(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAndroidHardwareBufferPropertiesANDROID]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAndroidHardwareBufferPropertiesANDROID]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
     }
     VkResult result = DispatchGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAndroidHardwareBufferPropertiesANDROID]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties, result);
     }
     return result;
@@ -10177,17 +10181,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryAndroidHardwareBufferANDROID(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryAndroidHardwareBufferANDROID]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryAndroidHardwareBufferANDROID]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
     }
     VkResult result = DispatchGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryAndroidHardwareBufferANDROID]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer, result);
     }
     return result;
@@ -10207,17 +10211,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleLocationsEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetSampleLocationsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
     DispatchCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetSampleLocationsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
     }
 }
@@ -10229,17 +10233,17 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMultisamplePropertiesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
         if (skip) return;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
     }
     DispatchGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
     }
 }
@@ -10258,17 +10262,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageDrmFormatModifierPropertiesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageDrmFormatModifierPropertiesEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageDrmFormatModifierPropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
     }
     VkResult result = DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageDrmFormatModifierPropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties, result);
     }
     return result;
@@ -10285,17 +10289,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadingRateImageNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindShadingRateImageNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindShadingRateImageNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
     DispatchCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindShadingRateImageNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     }
 }
@@ -10308,17 +10312,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportShadingRatePaletteNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportShadingRatePaletteNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
     DispatchCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportShadingRatePaletteNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
     }
 }
@@ -10331,17 +10335,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoarseSampleOrderNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
     DispatchCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoarseSampleOrderNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
     }
 }
@@ -10355,17 +10359,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateAccelerationStructureNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
     }
     VkResult result = DispatchCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure, result);
     }
     return result;
@@ -10378,17 +10382,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyAccelerationStructureNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
     DispatchDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     }
 }
@@ -10400,17 +10404,17 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
     DispatchGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
 }
@@ -10422,17 +10426,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindAccelerationStructureMemoryNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindAccelerationStructureMemoryNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindAccelerationStructureMemoryNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
     }
     VkResult result = DispatchBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindAccelerationStructureMemoryNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos, result);
     }
     return result;
@@ -10451,17 +10455,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructureNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
     DispatchCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
     }
 }
@@ -10474,17 +10478,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
     DispatchCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     }
 }
@@ -10508,17 +10512,17 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
     DispatchCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     }
 }
@@ -10533,17 +10537,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
     return result;
@@ -10559,17 +10563,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
     return result;
@@ -10583,17 +10587,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureHandleNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureHandleNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureHandleNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
     }
     VkResult result = DispatchGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureHandleNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData, result);
     }
     return result;
@@ -10609,17 +10613,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
     DispatchCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
 }
@@ -10631,17 +10635,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CompileDeferredNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCompileDeferredNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCompileDeferredNV(device, pipeline, shader);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCompileDeferredNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCompileDeferredNV(device, pipeline, shader);
     }
     VkResult result = DispatchCompileDeferredNV(device, pipeline, shader);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCompileDeferredNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCompileDeferredNV(device, pipeline, shader, result);
     }
     return result;
@@ -10660,17 +10664,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryHostPointerPropertiesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryHostPointerPropertiesEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryHostPointerPropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
     }
     VkResult result = DispatchGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryHostPointerPropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties, result);
     }
     return result;
@@ -10686,17 +10690,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarkerAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteBufferMarkerAMD]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteBufferMarkerAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
     DispatchCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteBufferMarkerAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     }
 }
@@ -10710,17 +10714,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceCalibrateableTimeDomainsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
     }
     VkResult result = DispatchGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains, result);
     }
     return result;
@@ -10735,17 +10739,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetCalibratedTimestampsEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetCalibratedTimestampsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
     }
     VkResult result = DispatchGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetCalibratedTimestampsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation, result);
     }
     return result;
@@ -10771,17 +10775,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
     DispatchCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
     }
 }
@@ -10795,17 +10799,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -10821,17 +10825,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectCountNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -10847,17 +10851,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetExclusiveScissorNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetExclusiveScissorNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
     DispatchCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetExclusiveScissorNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
     }
 }
@@ -10869,17 +10873,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCheckpointNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCheckpointNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
     DispatchCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCheckpointNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
     }
 }
@@ -10891,17 +10895,17 @@ VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointDataNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueueCheckpointDataNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetQueueCheckpointDataNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
     DispatchGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetQueueCheckpointDataNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
     }
 }
@@ -10914,17 +10918,17 @@ VKAPI_ATTR VkResult VKAPI_CALL InitializePerformanceApiINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateInitializePerformanceApiINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateInitializePerformanceApiINTEL(device, pInitializeInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordInitializePerformanceApiINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo);
     }
     VkResult result = DispatchInitializePerformanceApiINTEL(device, pInitializeInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordInitializePerformanceApiINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordInitializePerformanceApiINTEL(device, pInitializeInfo, result);
     }
     return result;
@@ -10935,17 +10939,17 @@ VKAPI_ATTR void VKAPI_CALL UninitializePerformanceApiINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUninitializePerformanceApiINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateUninitializePerformanceApiINTEL(device);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordUninitializePerformanceApiINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordUninitializePerformanceApiINTEL(device);
     }
     DispatchUninitializePerformanceApiINTEL(device);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordUninitializePerformanceApiINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordUninitializePerformanceApiINTEL(device);
     }
 }
@@ -10956,17 +10960,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceMarkerINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceMarkerINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceMarkerINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
     return result;
@@ -10978,17 +10982,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceStreamMarkerINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceStreamMarkerINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
     }
     VkResult result = DispatchCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceStreamMarkerINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo, result);
     }
     return result;
@@ -11000,17 +11004,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPerformanceOverrideINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPerformanceOverrideINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
     }
     VkResult result = DispatchCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPerformanceOverrideINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo, result);
     }
     return result;
@@ -11023,17 +11027,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquirePerformanceConfigurationINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquirePerformanceConfigurationINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquirePerformanceConfigurationINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
     }
     VkResult result = DispatchAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquirePerformanceConfigurationINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration, result);
     }
     return result;
@@ -11045,17 +11049,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleasePerformanceConfigurationINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleasePerformanceConfigurationINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleasePerformanceConfigurationINTEL(device, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleasePerformanceConfigurationINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordReleasePerformanceConfigurationINTEL(device, configuration);
     }
     VkResult result = DispatchReleasePerformanceConfigurationINTEL(device, configuration);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleasePerformanceConfigurationINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordReleasePerformanceConfigurationINTEL(device, configuration, result);
     }
     return result;
@@ -11067,17 +11071,17 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSetPerformanceConfigurationINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSetPerformanceConfigurationINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateQueueSetPerformanceConfigurationINTEL(queue, configuration);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSetPerformanceConfigurationINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration);
     }
     VkResult result = DispatchQueueSetPerformanceConfigurationINTEL(queue, configuration);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSetPerformanceConfigurationINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordQueueSetPerformanceConfigurationINTEL(queue, configuration, result);
     }
     return result;
@@ -11090,17 +11094,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPerformanceParameterINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPerformanceParameterINTEL]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPerformanceParameterINTEL(device, parameter, pValue);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPerformanceParameterINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPerformanceParameterINTEL(device, parameter, pValue);
     }
     VkResult result = DispatchGetPerformanceParameterINTEL(device, parameter, pValue);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPerformanceParameterINTEL]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPerformanceParameterINTEL(device, parameter, pValue, result);
     }
     return result;
@@ -11115,17 +11119,17 @@ VKAPI_ATTR void VKAPI_CALL SetLocalDimmingAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetLocalDimmingAMD]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetLocalDimmingAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
     DispatchSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetLocalDimmingAMD]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     }
 }
@@ -11140,17 +11144,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImagePipeSurfaceFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -11167,17 +11171,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMetalSurfaceEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -11202,17 +11206,17 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferDeviceAddressEXT(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferDeviceAddressEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetBufferDeviceAddressEXT(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetBufferDeviceAddressEXT(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferDeviceAddressEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetBufferDeviceAddressEXT(device, pInfo, result);
     }
     return result;
@@ -11229,17 +11233,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceCooperativeMatrixPropertiesNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties, result);
     }
     return result;
@@ -11253,17 +11257,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSupportedFramebufferMixedSamples
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
     }
     VkResult result = DispatchGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations, result);
     }
     return result;
@@ -11282,17 +11286,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModes2EXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
     }
     VkResult result = DispatchGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes, result);
     }
     return result;
@@ -11304,17 +11308,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireFullScreenExclusiveModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireFullScreenExclusiveModeEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAcquireFullScreenExclusiveModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchAcquireFullScreenExclusiveModeEXT(device, swapchain);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordAcquireFullScreenExclusiveModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordAcquireFullScreenExclusiveModeEXT(device, swapchain, result);
     }
     return result;
@@ -11326,17 +11330,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleaseFullScreenExclusiveModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseFullScreenExclusiveModeEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateReleaseFullScreenExclusiveModeEXT(device, swapchain);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordReleaseFullScreenExclusiveModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain);
     }
     VkResult result = DispatchReleaseFullScreenExclusiveModeEXT(device, swapchain);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordReleaseFullScreenExclusiveModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordReleaseFullScreenExclusiveModeEXT(device, swapchain, result);
     }
     return result;
@@ -11349,17 +11353,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModes2EXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModes2EXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModes2EXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
     }
     VkResult result = DispatchGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModes2EXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes, result);
     }
     return result;
@@ -11375,17 +11379,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateHeadlessSurfaceEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -11399,17 +11403,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineStippleEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineStippleEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
     DispatchCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineStippleEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
     }
 }
@@ -11424,17 +11428,17 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPoolEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordResetQueryPoolEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
     DispatchResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordResetQueryPoolEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     }
 }
@@ -11447,17 +11451,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCullModeEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCullModeEXT(commandBuffer, cullMode);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCullModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetCullModeEXT(commandBuffer, cullMode);
     }
     DispatchCmdSetCullModeEXT(commandBuffer, cullMode);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCullModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetCullModeEXT(commandBuffer, cullMode);
     }
 }
@@ -11468,17 +11472,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFaceEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFrontFaceEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetFrontFaceEXT(commandBuffer, frontFace);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFrontFaceEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace);
     }
     DispatchCmdSetFrontFaceEXT(commandBuffer, frontFace);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFrontFaceEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetFrontFaceEXT(commandBuffer, frontFace);
     }
 }
@@ -11489,17 +11493,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopologyEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveTopologyEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveTopologyEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
     }
     DispatchCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveTopologyEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
     }
 }
@@ -11511,17 +11515,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWithCountEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWithCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
     }
     DispatchCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWithCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
     }
 }
@@ -11533,17 +11537,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCountEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissorWithCountEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetScissorWithCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
     }
     DispatchCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetScissorWithCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
     }
 }
@@ -11559,17 +11563,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2EXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers2EXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindVertexBuffers2EXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
     DispatchCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindVertexBuffers2EXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
     }
 }
@@ -11580,17 +11584,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthTestEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthTestEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
     }
     DispatchCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthTestEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
     }
 }
@@ -11601,17 +11605,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthWriteEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthWriteEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
     }
     DispatchCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthWriteEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
     }
 }
@@ -11622,17 +11626,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOpEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthCompareOpEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthCompareOpEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
     }
     DispatchCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthCompareOpEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
     }
 }
@@ -11643,17 +11647,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBoundsTestEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBoundsTestEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
     }
     DispatchCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBoundsTestEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
     }
 }
@@ -11664,17 +11668,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilTestEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilTestEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
     }
     DispatchCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilTestEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
     }
 }
@@ -11689,17 +11693,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOpEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilOpEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetStencilOpEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
     DispatchCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetStencilOpEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
     }
 }
@@ -11714,17 +11718,17 @@ VKAPI_ATTR void VKAPI_CALL GetGeneratedCommandsMemoryRequirementsNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetGeneratedCommandsMemoryRequirementsNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetGeneratedCommandsMemoryRequirementsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
     DispatchGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetGeneratedCommandsMemoryRequirementsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
     }
 }
@@ -11735,17 +11739,17 @@ VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPreprocessGeneratedCommandsNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdPreprocessGeneratedCommandsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
     }
     DispatchCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdPreprocessGeneratedCommandsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
     }
 }
@@ -11757,17 +11761,17 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteGeneratedCommandsNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdExecuteGeneratedCommandsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
     }
     DispatchCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdExecuteGeneratedCommandsNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
     }
 }
@@ -11780,17 +11784,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipelineShaderGroupNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipelineShaderGroupNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindPipelineShaderGroupNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
     }
     DispatchCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindPipelineShaderGroupNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
     }
 }
@@ -11803,17 +11807,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateIndirectCommandsLayoutNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateIndirectCommandsLayoutNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     }
     VkResult result = DispatchCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateIndirectCommandsLayoutNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout, result);
     }
     return result;
@@ -11826,17 +11830,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyIndirectCommandsLayoutNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyIndirectCommandsLayoutNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     }
     DispatchDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyIndirectCommandsLayoutNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     }
 }
@@ -11853,17 +11857,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireDrmDisplayEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireDrmDisplayEXT(physicalDevice, drmFd, display);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordAcquireDrmDisplayEXT(physicalDevice, drmFd, display);
     }
     VkResult result = DispatchAcquireDrmDisplayEXT(physicalDevice, drmFd, display);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordAcquireDrmDisplayEXT(physicalDevice, drmFd, display, result);
     }
     return result;
@@ -11877,17 +11881,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDrmDisplayEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDrmDisplayEXT(physicalDevice, drmFd, connectorId, display);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDrmDisplayEXT(physicalDevice, drmFd, connectorId, display);
     }
     VkResult result = DispatchGetDrmDisplayEXT(physicalDevice, drmFd, connectorId, display);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDrmDisplayEXT(physicalDevice, drmFd, connectorId, display, result);
     }
     return result;
@@ -11906,17 +11910,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlotEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePrivateDataSlotEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreatePrivateDataSlotEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
     }
     VkResult result = DispatchCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePrivateDataSlotEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot, result);
     }
     return result;
@@ -11929,17 +11933,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlotEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPrivateDataSlotEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyPrivateDataSlotEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     }
     DispatchDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyPrivateDataSlotEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     }
 }
@@ -11953,17 +11957,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetPrivateDataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetPrivateDataEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetPrivateDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
     }
     VkResult result = DispatchSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetPrivateDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data, result);
     }
     return result;
@@ -11978,17 +11982,17 @@ VKAPI_ATTR void VKAPI_CALL GetPrivateDataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPrivateDataEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPrivateDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
     }
     DispatchGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPrivateDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
     }
 }
@@ -12004,17 +12008,17 @@ VKAPI_ATTR void VKAPI_CALL ExportMetalObjectsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateExportMetalObjectsEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateExportMetalObjectsEXT(device, pMetalObjectsInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordExportMetalObjectsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordExportMetalObjectsEXT(device, pMetalObjectsInfo);
     }
     DispatchExportMetalObjectsEXT(device, pMetalObjectsInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordExportMetalObjectsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordExportMetalObjectsEXT(device, pMetalObjectsInfo);
     }
 }
@@ -12028,17 +12032,17 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSizeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutSizeEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutSizeEXT(device, layout, pLayoutSizeInBytes);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutSizeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDescriptorSetLayoutSizeEXT(device, layout, pLayoutSizeInBytes);
     }
     DispatchGetDescriptorSetLayoutSizeEXT(device, layout, pLayoutSizeInBytes);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutSizeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDescriptorSetLayoutSizeEXT(device, layout, pLayoutSizeInBytes);
     }
 }
@@ -12051,17 +12055,17 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutBindingOffsetEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutBindingOffsetEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutBindingOffsetEXT(device, layout, binding, pOffset);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutBindingOffsetEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDescriptorSetLayoutBindingOffsetEXT(device, layout, binding, pOffset);
     }
     DispatchGetDescriptorSetLayoutBindingOffsetEXT(device, layout, binding, pOffset);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutBindingOffsetEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDescriptorSetLayoutBindingOffsetEXT(device, layout, binding, pOffset);
     }
 }
@@ -12074,17 +12078,17 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorEXT(device, pDescriptorInfo, dataSize, pDescriptor);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDescriptorEXT(device, pDescriptorInfo, dataSize, pDescriptor);
     }
     DispatchGetDescriptorEXT(device, pDescriptorInfo, dataSize, pDescriptor);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDescriptorEXT(device, pDescriptorInfo, dataSize, pDescriptor);
     }
 }
@@ -12096,17 +12100,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBuffersEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorBuffersEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindDescriptorBuffersEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos);
     }
     DispatchCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindDescriptorBuffersEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos);
     }
 }
@@ -12122,17 +12126,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDescriptorBufferOffsetsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDescriptorBufferOffsetsEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDescriptorBufferOffsetsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
     }
     DispatchCmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDescriptorBufferOffsetsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
     }
 }
@@ -12145,17 +12149,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBufferEmbeddedSamplersEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorBufferEmbeddedSamplersEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout, set);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout, set);
     }
     DispatchCmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout, set);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout, set);
     }
 }
@@ -12167,17 +12171,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetBufferOpaqueCaptureDescriptorDataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetBufferOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
     }
     VkResult result = DispatchGetBufferOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetBufferOpaqueCaptureDescriptorDataEXT(device, pInfo, pData, result);
     }
     return result;
@@ -12190,17 +12194,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageOpaqueCaptureDescriptorDataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetImageOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
     }
     VkResult result = DispatchGetImageOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetImageOpaqueCaptureDescriptorDataEXT(device, pInfo, pData, result);
     }
     return result;
@@ -12213,17 +12217,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageViewOpaqueCaptureDescriptorDataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageViewOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageViewOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetImageViewOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
     }
     VkResult result = DispatchGetImageViewOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageViewOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetImageViewOpaqueCaptureDescriptorDataEXT(device, pInfo, pData, result);
     }
     return result;
@@ -12236,17 +12240,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSamplerOpaqueCaptureDescriptorDataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSamplerOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSamplerOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSamplerOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetSamplerOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
     }
     VkResult result = DispatchGetSamplerOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSamplerOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetSamplerOpaqueCaptureDescriptorDataEXT(device, pInfo, pData, result);
     }
     return result;
@@ -12259,17 +12263,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureOpaqueCaptureDescriptorDa
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetAccelerationStructureOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
     }
     VkResult result = DispatchGetAccelerationStructureOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureOpaqueCaptureDescriptorDataEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetAccelerationStructureOpaqueCaptureDescriptorDataEXT(device, pInfo, pData, result);
     }
     return result;
@@ -12285,17 +12289,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateEnumNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFragmentShadingRateEnumNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetFragmentShadingRateEnumNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
     }
     DispatchCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetFragmentShadingRateEnumNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
     }
 }
@@ -12314,17 +12318,17 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout2EXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSubresourceLayout2EXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetImageSubresourceLayout2EXT(device, image, pSubresource, pLayout);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetImageSubresourceLayout2EXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetImageSubresourceLayout2EXT(device, image, pSubresource, pLayout);
     }
     DispatchGetImageSubresourceLayout2EXT(device, image, pSubresource, pLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetImageSubresourceLayout2EXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetImageSubresourceLayout2EXT(device, image, pSubresource, pLayout);
     }
 }
@@ -12339,17 +12343,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceFaultInfoEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceFaultInfoEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceFaultInfoEXT(device, pFaultCounts, pFaultInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceFaultInfoEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceFaultInfoEXT(device, pFaultCounts, pFaultInfo);
     }
     VkResult result = DispatchGetDeviceFaultInfoEXT(device, pFaultCounts, pFaultInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceFaultInfoEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceFaultInfoEXT(device, pFaultCounts, pFaultInfo, result);
     }
     return result;
@@ -12365,17 +12369,17 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireWinrtDisplayNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAcquireWinrtDisplayNV(physicalDevice, display);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordAcquireWinrtDisplayNV(physicalDevice, display);
     }
     VkResult result = DispatchAcquireWinrtDisplayNV(physicalDevice, display);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordAcquireWinrtDisplayNV(physicalDevice, display, result);
     }
     return result;
@@ -12388,17 +12392,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetWinrtDisplayNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetWinrtDisplayNV(physicalDevice, deviceRelativeId, pDisplay);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetWinrtDisplayNV(physicalDevice, deviceRelativeId, pDisplay);
     }
     VkResult result = DispatchGetWinrtDisplayNV(physicalDevice, deviceRelativeId, pDisplay);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetWinrtDisplayNV(physicalDevice, deviceRelativeId, pDisplay, result);
     }
     return result;
@@ -12415,17 +12419,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDirectFBSurfaceEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDirectFBSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateDirectFBSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateDirectFBSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateDirectFBSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -12438,17 +12442,17 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceDirectFBPresentationSupportEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceDirectFBPresentationSupportEXT(physicalDevice, queueFamilyIndex, dfb);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceDirectFBPresentationSupportEXT(physicalDevice, queueFamilyIndex, dfb);
     }
     VkBool32 result = DispatchGetPhysicalDeviceDirectFBPresentationSupportEXT(physicalDevice, queueFamilyIndex, dfb);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceDirectFBPresentationSupportEXT(physicalDevice, queueFamilyIndex, dfb);
     }
     return result;
@@ -12466,17 +12470,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetVertexInputEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetVertexInputEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetVertexInputEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
     }
     DispatchCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetVertexInputEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
     }
 }
@@ -12494,17 +12498,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryZirconHandleFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryZirconHandleFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryZirconHandleFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
     }
     VkResult result = DispatchGetMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryZirconHandleFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle, result);
     }
     return result;
@@ -12518,17 +12522,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryZirconHandlePropertiesFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryZirconHandlePropertiesFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryZirconHandlePropertiesFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
     }
     VkResult result = DispatchGetMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryZirconHandlePropertiesFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle, pMemoryZirconHandleProperties, result);
     }
     return result;
@@ -12543,17 +12547,17 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreZirconHandleFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreZirconHandleFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateImportSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordImportSemaphoreZirconHandleFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordImportSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo);
     }
     VkResult result = DispatchImportSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordImportSemaphoreZirconHandleFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordImportSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo, result);
     }
     return result;
@@ -12566,17 +12570,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreZirconHandleFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreZirconHandleFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetSemaphoreZirconHandleFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
     }
     VkResult result = DispatchGetSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetSemaphoreZirconHandleFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle, result);
     }
     return result;
@@ -12593,17 +12597,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferCollectionFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateBufferCollectionFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateBufferCollectionFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection);
     }
     VkResult result = DispatchCreateBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateBufferCollectionFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection, result);
     }
     return result;
@@ -12616,17 +12620,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionImageConstraintsFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetBufferCollectionImageConstraintsFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetBufferCollectionImageConstraintsFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordSetBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo);
     }
     VkResult result = DispatchSetBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetBufferCollectionImageConstraintsFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordSetBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo, result);
     }
     return result;
@@ -12639,17 +12643,17 @@ VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionBufferConstraintsFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetBufferCollectionBufferConstraintsFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetBufferCollectionBufferConstraintsFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordSetBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo);
     }
     VkResult result = DispatchSetBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetBufferCollectionBufferConstraintsFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordSetBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo, result);
     }
     return result;
@@ -12662,17 +12666,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferCollectionFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBufferCollectionFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyBufferCollectionFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
     }
     DispatchDestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyBufferCollectionFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
     }
 }
@@ -12684,17 +12688,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetBufferCollectionPropertiesFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferCollectionPropertiesFUCHSIA]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetBufferCollectionPropertiesFUCHSIA(device, collection, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetBufferCollectionPropertiesFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetBufferCollectionPropertiesFUCHSIA(device, collection, pProperties);
     }
     VkResult result = DispatchGetBufferCollectionPropertiesFUCHSIA(device, collection, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetBufferCollectionPropertiesFUCHSIA]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetBufferCollectionPropertiesFUCHSIA(device, collection, pProperties, result);
     }
     return result;
@@ -12709,17 +12713,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize);
     }
     VkResult result = DispatchGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize, result);
     }
     return result;
@@ -12730,17 +12734,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSubpassShadingHUAWEI(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSubpassShadingHUAWEI]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSubpassShadingHUAWEI(commandBuffer);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSubpassShadingHUAWEI]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSubpassShadingHUAWEI(commandBuffer);
     }
     DispatchCmdSubpassShadingHUAWEI(commandBuffer);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSubpassShadingHUAWEI]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSubpassShadingHUAWEI(commandBuffer);
     }
 }
@@ -12753,17 +12757,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBindInvocationMaskHUAWEI(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindInvocationMaskHUAWEI]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBindInvocationMaskHUAWEI]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
     }
     DispatchCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBindInvocationMaskHUAWEI]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
     }
 }
@@ -12776,17 +12780,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryRemoteAddressNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryRemoteAddressNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMemoryRemoteAddressNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress);
     }
     VkResult result = DispatchGetMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMemoryRemoteAddressNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress, result);
     }
     return result;
@@ -12800,17 +12804,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelinePropertiesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelinePropertiesEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPipelinePropertiesEXT(device, pPipelineInfo, pPipelineProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetPipelinePropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPipelinePropertiesEXT(device, pPipelineInfo, pPipelineProperties);
     }
     VkResult result = DispatchGetPipelinePropertiesEXT(device, pPipelineInfo, pPipelineProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetPipelinePropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPipelinePropertiesEXT(device, pPipelineInfo, pPipelineProperties, result);
     }
     return result;
@@ -12824,17 +12828,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPatchControlPointsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPatchControlPointsEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPatchControlPointsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
     }
     DispatchCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPatchControlPointsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
     }
 }
@@ -12845,17 +12849,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRasterizerDiscardEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRasterizerDiscardEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
     }
     DispatchCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRasterizerDiscardEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
     }
 }
@@ -12866,17 +12870,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBiasEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthBiasEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
     }
     DispatchCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthBiasEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
     }
 }
@@ -12887,17 +12891,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLogicOpEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLogicOpEXT(commandBuffer, logicOp);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLogicOpEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetLogicOpEXT(commandBuffer, logicOp);
     }
     DispatchCmdSetLogicOpEXT(commandBuffer, logicOp);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLogicOpEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetLogicOpEXT(commandBuffer, logicOp);
     }
 }
@@ -12908,17 +12912,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveRestartEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPrimitiveRestartEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
     }
     DispatchCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPrimitiveRestartEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
     }
 }
@@ -12933,17 +12937,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateScreenSurfaceQNX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateScreenSurfaceQNX(instance, pCreateInfo, pAllocator, pSurface);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateScreenSurfaceQNX(instance, pCreateInfo, pAllocator, pSurface);
     }
     VkResult result = DispatchCreateScreenSurfaceQNX(instance, pCreateInfo, pAllocator, pSurface);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateScreenSurfaceQNX(instance, pCreateInfo, pAllocator, pSurface, result);
     }
     return result;
@@ -12956,17 +12960,17 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceScreenPresentationSupportQNX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceScreenPresentationSupportQNX(physicalDevice, queueFamilyIndex, window);
         if (skip) return VK_FALSE;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceScreenPresentationSupportQNX(physicalDevice, queueFamilyIndex, window);
     }
     VkBool32 result = DispatchGetPhysicalDeviceScreenPresentationSupportQNX(physicalDevice, queueFamilyIndex, window);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceScreenPresentationSupportQNX(physicalDevice, queueFamilyIndex, window);
     }
     return result;
@@ -12981,17 +12985,17 @@ VKAPI_ATTR void                                    VKAPI_CALL CmdSetColorWriteEn
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorWriteEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetColorWriteEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
     }
     DispatchCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetColorWriteEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
     }
 }
@@ -13010,17 +13014,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMultiEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMultiEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
     }
     DispatchCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMultiEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
     }
 }
@@ -13036,17 +13040,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiIndexedEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMultiIndexedEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMultiIndexedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
     }
     DispatchCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMultiIndexedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
     }
 }
@@ -13061,17 +13065,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMicromapEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateMicromapEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateMicromapEXT(device, pCreateInfo, pAllocator, pMicromap);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateMicromapEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateMicromapEXT(device, pCreateInfo, pAllocator, pMicromap);
     }
     VkResult result = DispatchCreateMicromapEXT(device, pCreateInfo, pAllocator, pMicromap);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateMicromapEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateMicromapEXT(device, pCreateInfo, pAllocator, pMicromap, result);
     }
     return result;
@@ -13084,17 +13088,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyMicromapEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyMicromapEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyMicromapEXT(device, micromap, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyMicromapEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyMicromapEXT(device, micromap, pAllocator);
     }
     DispatchDestroyMicromapEXT(device, micromap, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyMicromapEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyMicromapEXT(device, micromap, pAllocator);
     }
 }
@@ -13106,17 +13110,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildMicromapsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildMicromapsEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildMicromapsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos);
     }
     DispatchCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildMicromapsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos);
     }
 }
@@ -13129,17 +13133,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BuildMicromapsEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBuildMicromapsEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBuildMicromapsEXT(device, deferredOperation, infoCount, pInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBuildMicromapsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordBuildMicromapsEXT(device, deferredOperation, infoCount, pInfos);
     }
     VkResult result = DispatchBuildMicromapsEXT(device, deferredOperation, infoCount, pInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBuildMicromapsEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordBuildMicromapsEXT(device, deferredOperation, infoCount, pInfos, result);
     }
     return result;
@@ -13152,17 +13156,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMicromapEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMicromapEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyMicromapEXT(device, deferredOperation, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyMicromapEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCopyMicromapEXT(device, deferredOperation, pInfo);
     }
     VkResult result = DispatchCopyMicromapEXT(device, deferredOperation, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyMicromapEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCopyMicromapEXT(device, deferredOperation, pInfo, result);
     }
     return result;
@@ -13175,17 +13179,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMicromapToMemoryEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMicromapToMemoryEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyMicromapToMemoryEXT(device, deferredOperation, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyMicromapToMemoryEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCopyMicromapToMemoryEXT(device, deferredOperation, pInfo);
     }
     VkResult result = DispatchCopyMicromapToMemoryEXT(device, deferredOperation, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyMicromapToMemoryEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCopyMicromapToMemoryEXT(device, deferredOperation, pInfo, result);
     }
     return result;
@@ -13198,17 +13202,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToMicromapEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMemoryToMicromapEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyMemoryToMicromapEXT(device, deferredOperation, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyMemoryToMicromapEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCopyMemoryToMicromapEXT(device, deferredOperation, pInfo);
     }
     VkResult result = DispatchCopyMemoryToMicromapEXT(device, deferredOperation, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyMemoryToMicromapEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCopyMemoryToMicromapEXT(device, deferredOperation, pInfo, result);
     }
     return result;
@@ -13225,17 +13229,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WriteMicromapsPropertiesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWriteMicromapsPropertiesEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWriteMicromapsPropertiesEXT(device, micromapCount, pMicromaps, queryType, dataSize, pData, stride);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWriteMicromapsPropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordWriteMicromapsPropertiesEXT(device, micromapCount, pMicromaps, queryType, dataSize, pData, stride);
     }
     VkResult result = DispatchWriteMicromapsPropertiesEXT(device, micromapCount, pMicromaps, queryType, dataSize, pData, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWriteMicromapsPropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordWriteMicromapsPropertiesEXT(device, micromapCount, pMicromaps, queryType, dataSize, pData, stride, result);
     }
     return result;
@@ -13247,17 +13251,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMicromapEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyMicromapEXT(commandBuffer, pInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMicromapEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyMicromapEXT(commandBuffer, pInfo);
     }
     DispatchCmdCopyMicromapEXT(commandBuffer, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMicromapEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyMicromapEXT(commandBuffer, pInfo);
     }
 }
@@ -13268,17 +13272,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapToMemoryEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMicromapToMemoryEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMicromapToMemoryEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo);
     }
     DispatchCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMicromapToMemoryEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo);
     }
 }
@@ -13289,17 +13293,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToMicromapEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryToMicromapEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMemoryToMicromapEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo);
     }
     DispatchCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMemoryToMicromapEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo);
     }
 }
@@ -13314,17 +13318,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteMicromapsPropertiesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteMicromapsPropertiesEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteMicromapsPropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
     }
     DispatchCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteMicromapsPropertiesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
     }
 }
@@ -13336,17 +13340,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceMicromapCompatibilityEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMicromapCompatibilityEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceMicromapCompatibilityEXT(device, pVersionInfo, pCompatibility);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceMicromapCompatibilityEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceMicromapCompatibilityEXT(device, pVersionInfo, pCompatibility);
     }
     DispatchGetDeviceMicromapCompatibilityEXT(device, pVersionInfo, pCompatibility);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceMicromapCompatibilityEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceMicromapCompatibilityEXT(device, pVersionInfo, pCompatibility);
     }
 }
@@ -13359,17 +13363,17 @@ VKAPI_ATTR void VKAPI_CALL GetMicromapBuildSizesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMicromapBuildSizesEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetMicromapBuildSizesEXT(device, buildType, pBuildInfo, pSizeInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetMicromapBuildSizesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetMicromapBuildSizesEXT(device, buildType, pBuildInfo, pSizeInfo);
     }
     DispatchGetMicromapBuildSizesEXT(device, buildType, pBuildInfo, pSizeInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetMicromapBuildSizesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetMicromapBuildSizesEXT(device, buildType, pBuildInfo, pSizeInfo);
     }
 }
@@ -13384,17 +13388,17 @@ VKAPI_ATTR void VKAPI_CALL SetDeviceMemoryPriorityEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDeviceMemoryPriorityEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateSetDeviceMemoryPriorityEXT(device, memory, priority);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordSetDeviceMemoryPriorityEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordSetDeviceMemoryPriorityEXT(device, memory, priority);
     }
     DispatchSetDeviceMemoryPriorityEXT(device, memory, priority);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordSetDeviceMemoryPriorityEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordSetDeviceMemoryPriorityEXT(device, memory, priority);
     }
 }
@@ -13407,17 +13411,17 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutHostMappingInfoVALVE(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetLayoutHostMappingInfoVALVE]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetLayoutHostMappingInfoVALVE(device, pBindingReference, pHostMapping);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE(device, pBindingReference, pHostMapping);
     }
     DispatchGetDescriptorSetLayoutHostMappingInfoVALVE(device, pBindingReference, pHostMapping);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE(device, pBindingReference, pHostMapping);
     }
 }
@@ -13429,17 +13433,17 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetHostMappingVALVE(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorSetHostMappingVALVE]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDescriptorSetHostMappingVALVE(device, descriptorSet, ppData);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDescriptorSetHostMappingVALVE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDescriptorSetHostMappingVALVE(device, descriptorSet, ppData);
     }
     DispatchGetDescriptorSetHostMappingVALVE(device, descriptorSet, ppData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDescriptorSetHostMappingVALVE]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDescriptorSetHostMappingVALVE(device, descriptorSet, ppData);
     }
 }
@@ -13456,17 +13460,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryIndirectNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryIndirectNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMemoryIndirectNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride);
     }
     DispatchCmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMemoryIndirectNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride);
     }
 }
@@ -13482,17 +13486,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToImageIndirectNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryToImageIndirectNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyMemoryToImageIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, dstImage, dstImageLayout, pImageSubresources);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMemoryToImageIndirectNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyMemoryToImageIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, dstImage, dstImageLayout, pImageSubresources);
     }
     DispatchCmdCopyMemoryToImageIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, dstImage, dstImageLayout, pImageSubresources);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMemoryToImageIndirectNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyMemoryToImageIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, dstImage, dstImageLayout, pImageSubresources);
     }
 }
@@ -13505,17 +13509,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDecompressMemoryNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDecompressMemoryNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
     }
     DispatchCmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDecompressMemoryNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
     }
 }
@@ -13528,17 +13532,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryIndirectCountNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDecompressMemoryIndirectCountNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDecompressMemoryIndirectCountNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress, stride);
     }
     DispatchCmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDecompressMemoryIndirectCountNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress, stride);
     }
 }
@@ -13554,17 +13558,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetTessellationDomainOriginEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetTessellationDomainOriginEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetTessellationDomainOriginEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin);
     }
     DispatchCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetTessellationDomainOriginEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin);
     }
 }
@@ -13575,17 +13579,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClampEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthClampEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthClampEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable);
     }
     DispatchCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthClampEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable);
     }
 }
@@ -13596,17 +13600,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPolygonModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPolygonModeEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetPolygonModeEXT(commandBuffer, polygonMode);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetPolygonModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetPolygonModeEXT(commandBuffer, polygonMode);
     }
     DispatchCmdSetPolygonModeEXT(commandBuffer, polygonMode);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetPolygonModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetPolygonModeEXT(commandBuffer, polygonMode);
     }
 }
@@ -13617,17 +13621,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationSamplesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRasterizationSamplesEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRasterizationSamplesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples);
     }
     DispatchCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRasterizationSamplesEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples);
     }
 }
@@ -13639,17 +13643,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleMaskEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleMaskEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetSampleMaskEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask);
     }
     DispatchCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetSampleMaskEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask);
     }
 }
@@ -13660,17 +13664,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToCoverageEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetAlphaToCoverageEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetAlphaToCoverageEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable);
     }
     DispatchCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetAlphaToCoverageEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable);
     }
 }
@@ -13681,17 +13685,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToOneEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetAlphaToOneEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetAlphaToOneEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable);
     }
     DispatchCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetAlphaToOneEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable);
     }
 }
@@ -13702,17 +13706,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLogicOpEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLogicOpEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable);
     }
     DispatchCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLogicOpEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable);
     }
 }
@@ -13725,17 +13729,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorBlendEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetColorBlendEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
     }
     DispatchCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetColorBlendEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
     }
 }
@@ -13748,17 +13752,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEquationEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorBlendEquationEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetColorBlendEquationEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
     }
     DispatchCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetColorBlendEquationEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
     }
 }
@@ -13771,17 +13775,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteMaskEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorWriteMaskEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetColorWriteMaskEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
     }
     DispatchCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetColorWriteMaskEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
     }
 }
@@ -13792,17 +13796,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationStreamEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRasterizationStreamEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRasterizationStreamEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream);
     }
     DispatchCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRasterizationStreamEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream);
     }
 }
@@ -13813,17 +13817,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetConservativeRasterizationModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetConservativeRasterizationModeEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetConservativeRasterizationModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode);
     }
     DispatchCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetConservativeRasterizationModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode);
     }
 }
@@ -13834,17 +13838,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExtraPrimitiveOverestimationSizeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetExtraPrimitiveOverestimationSizeEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize);
     }
     DispatchCmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize);
     }
 }
@@ -13855,17 +13859,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthClipEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthClipEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable);
     }
     DispatchCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthClipEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable);
     }
 }
@@ -13876,17 +13880,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleLocationsEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetSampleLocationsEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable);
     }
     DispatchCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetSampleLocationsEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable);
     }
 }
@@ -13899,17 +13903,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendAdvancedEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorBlendAdvancedEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetColorBlendAdvancedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
     }
     DispatchCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetColorBlendAdvancedEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
     }
 }
@@ -13920,17 +13924,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetProvokingVertexModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetProvokingVertexModeEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetProvokingVertexModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode);
     }
     DispatchCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetProvokingVertexModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode);
     }
 }
@@ -13941,17 +13945,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineRasterizationModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineRasterizationModeEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineRasterizationModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode);
     }
     DispatchCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineRasterizationModeEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode);
     }
 }
@@ -13962,17 +13966,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEnableEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineStippleEnableEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetLineStippleEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable);
     }
     DispatchCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetLineStippleEnableEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable);
     }
 }
@@ -13983,17 +13987,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipNegativeOneToOneEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthClipNegativeOneToOneEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetDepthClipNegativeOneToOneEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne);
     }
     DispatchCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetDepthClipNegativeOneToOneEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne);
     }
 }
@@ -14004,17 +14008,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingEnableNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWScalingEnableNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportWScalingEnableNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable);
     }
     DispatchCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportWScalingEnableNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable);
     }
 }
@@ -14027,17 +14031,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportSwizzleNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportSwizzleNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetViewportSwizzleNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
     }
     DispatchCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetViewportSwizzleNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
     }
 }
@@ -14048,17 +14052,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorEnableNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoverageToColorEnableNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoverageToColorEnableNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable);
     }
     DispatchCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoverageToColorEnableNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable);
     }
 }
@@ -14069,17 +14073,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorLocationNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoverageToColorLocationNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoverageToColorLocationNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation);
     }
     DispatchCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoverageToColorLocationNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation);
     }
 }
@@ -14090,17 +14094,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationModeNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoverageModulationModeNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoverageModulationModeNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode);
     }
     DispatchCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoverageModulationModeNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode);
     }
 }
@@ -14111,17 +14115,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableEnableNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoverageModulationTableEnableNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoverageModulationTableEnableNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable);
     }
     DispatchCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoverageModulationTableEnableNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable);
     }
 }
@@ -14133,17 +14137,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoverageModulationTableNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoverageModulationTableNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
     }
     DispatchCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoverageModulationTableNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
     }
 }
@@ -14154,17 +14158,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetShadingRateImageEnableNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetShadingRateImageEnableNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetShadingRateImageEnableNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable);
     }
     DispatchCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetShadingRateImageEnableNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable);
     }
 }
@@ -14175,17 +14179,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRepresentativeFragmentTestEnableNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRepresentativeFragmentTestEnableNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRepresentativeFragmentTestEnableNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable);
     }
     DispatchCmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRepresentativeFragmentTestEnableNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable);
     }
 }
@@ -14196,17 +14200,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageReductionModeNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoverageReductionModeNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetCoverageReductionModeNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode);
     }
     DispatchCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetCoverageReductionModeNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode);
     }
 }
@@ -14221,17 +14225,17 @@ VKAPI_ATTR void VKAPI_CALL GetShaderModuleIdentifierEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetShaderModuleIdentifierEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetShaderModuleIdentifierEXT(device, shaderModule, pIdentifier);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetShaderModuleIdentifierEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetShaderModuleIdentifierEXT(device, shaderModule, pIdentifier);
     }
     DispatchGetShaderModuleIdentifierEXT(device, shaderModule, pIdentifier);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetShaderModuleIdentifierEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetShaderModuleIdentifierEXT(device, shaderModule, pIdentifier);
     }
 }
@@ -14243,17 +14247,17 @@ VKAPI_ATTR void VKAPI_CALL GetShaderModuleCreateInfoIdentifierEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetShaderModuleCreateInfoIdentifierEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetShaderModuleCreateInfoIdentifierEXT(device, pCreateInfo, pIdentifier);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetShaderModuleCreateInfoIdentifierEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetShaderModuleCreateInfoIdentifierEXT(device, pCreateInfo, pIdentifier);
     }
     DispatchGetShaderModuleCreateInfoIdentifierEXT(device, pCreateInfo, pIdentifier);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetShaderModuleCreateInfoIdentifierEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetShaderModuleCreateInfoIdentifierEXT(device, pCreateInfo, pIdentifier);
     }
 }
@@ -14268,17 +14272,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceOpticalFlowImageFormatsNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceOpticalFlowImageFormatsNV(physicalDevice, pOpticalFlowImageFormatInfo, pFormatCount, pImageFormatProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceOpticalFlowImageFormatsNV(physicalDevice, pOpticalFlowImageFormatInfo, pFormatCount, pImageFormatProperties);
     }
     VkResult result = DispatchGetPhysicalDeviceOpticalFlowImageFormatsNV(physicalDevice, pOpticalFlowImageFormatInfo, pFormatCount, pImageFormatProperties);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceOpticalFlowImageFormatsNV(physicalDevice, pOpticalFlowImageFormatInfo, pFormatCount, pImageFormatProperties, result);
     }
     return result;
@@ -14292,17 +14296,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateOpticalFlowSessionNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateOpticalFlowSessionNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateOpticalFlowSessionNV(device, pCreateInfo, pAllocator, pSession);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateOpticalFlowSessionNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateOpticalFlowSessionNV(device, pCreateInfo, pAllocator, pSession);
     }
     VkResult result = DispatchCreateOpticalFlowSessionNV(device, pCreateInfo, pAllocator, pSession);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateOpticalFlowSessionNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateOpticalFlowSessionNV(device, pCreateInfo, pAllocator, pSession, result);
     }
     return result;
@@ -14315,17 +14319,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyOpticalFlowSessionNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyOpticalFlowSessionNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyOpticalFlowSessionNV(device, session, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyOpticalFlowSessionNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyOpticalFlowSessionNV(device, session, pAllocator);
     }
     DispatchDestroyOpticalFlowSessionNV(device, session, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyOpticalFlowSessionNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyOpticalFlowSessionNV(device, session, pAllocator);
     }
 }
@@ -14339,17 +14343,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BindOpticalFlowSessionImageNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindOpticalFlowSessionImageNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBindOpticalFlowSessionImageNV(device, session, bindingPoint, view, layout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBindOpticalFlowSessionImageNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordBindOpticalFlowSessionImageNV(device, session, bindingPoint, view, layout);
     }
     VkResult result = DispatchBindOpticalFlowSessionImageNV(device, session, bindingPoint, view, layout);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBindOpticalFlowSessionImageNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordBindOpticalFlowSessionImageNV(device, session, bindingPoint, view, layout, result);
     }
     return result;
@@ -14362,17 +14366,17 @@ VKAPI_ATTR void VKAPI_CALL CmdOpticalFlowExecuteNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdOpticalFlowExecuteNV]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdOpticalFlowExecuteNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo);
     }
     DispatchCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdOpticalFlowExecuteNV]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo);
     }
 }
@@ -14388,17 +14392,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFramebufferTilePropertiesQCOM(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFramebufferTilePropertiesQCOM]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetFramebufferTilePropertiesQCOM(device, framebuffer, pPropertiesCount, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetFramebufferTilePropertiesQCOM]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetFramebufferTilePropertiesQCOM(device, framebuffer, pPropertiesCount, pProperties);
     }
     VkResult result = DispatchGetFramebufferTilePropertiesQCOM(device, framebuffer, pPropertiesCount, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetFramebufferTilePropertiesQCOM]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetFramebufferTilePropertiesQCOM(device, framebuffer, pPropertiesCount, pProperties, result);
     }
     return result;
@@ -14411,17 +14415,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDynamicRenderingTilePropertiesQCOM(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDynamicRenderingTilePropertiesQCOM]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDynamicRenderingTilePropertiesQCOM(device, pRenderingInfo, pProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDynamicRenderingTilePropertiesQCOM]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDynamicRenderingTilePropertiesQCOM(device, pRenderingInfo, pProperties);
     }
     VkResult result = DispatchGetDynamicRenderingTilePropertiesQCOM(device, pRenderingInfo, pProperties);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDynamicRenderingTilePropertiesQCOM]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDynamicRenderingTilePropertiesQCOM(device, pRenderingInfo, pProperties, result);
     }
     return result;
@@ -14441,17 +14445,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateAccelerationStructureKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
     }
     VkResult result = DispatchCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure, result);
     }
     return result;
@@ -14464,17 +14468,17 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyAccelerationStructureKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordDestroyAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     }
     DispatchDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordDestroyAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     }
 }
@@ -14487,17 +14491,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructuresKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructuresKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
     }
     DispatchCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructuresKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
     }
 }
@@ -14512,17 +14516,17 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresIndirectKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildAccelerationStructuresIndirectKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdBuildAccelerationStructuresIndirectKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
     }
     DispatchCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdBuildAccelerationStructuresIndirectKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
     }
 }
@@ -14536,17 +14540,17 @@ VKAPI_ATTR VkResult VKAPI_CALL BuildAccelerationStructuresKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBuildAccelerationStructuresKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBuildAccelerationStructuresKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
     }
     VkResult result = DispatchBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBuildAccelerationStructuresKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos, result);
     }
     return result;
@@ -14559,17 +14563,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyAccelerationStructureKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyAccelerationStructureKHR(device, deferredOperation, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCopyAccelerationStructureKHR(device, deferredOperation, pInfo);
     }
     VkResult result = DispatchCopyAccelerationStructureKHR(device, deferredOperation, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCopyAccelerationStructureKHR(device, deferredOperation, pInfo, result);
     }
     return result;
@@ -14582,17 +14586,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureToMemoryKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyAccelerationStructureToMemoryKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyAccelerationStructureToMemoryKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
     }
     VkResult result = DispatchCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyAccelerationStructureToMemoryKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo, result);
     }
     return result;
@@ -14605,17 +14609,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMemoryToAccelerationStructureKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCopyMemoryToAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
     }
     VkResult result = DispatchCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCopyMemoryToAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo, result);
     }
     return result;
@@ -14632,17 +14636,17 @@ VKAPI_ATTR VkResult VKAPI_CALL WriteAccelerationStructuresPropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWriteAccelerationStructuresPropertiesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordWriteAccelerationStructuresPropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
     }
     VkResult result = DispatchWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordWriteAccelerationStructuresPropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride, result);
     }
     return result;
@@ -14654,17 +14658,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
     }
 }
@@ -14675,17 +14679,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyAccelerationStructureToMemoryKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyAccelerationStructureToMemoryKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyAccelerationStructureToMemoryKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
     }
 }
@@ -14696,17 +14700,17 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryToAccelerationStructureKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdCopyMemoryToAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
     }
     DispatchCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdCopyMemoryToAccelerationStructureKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
     }
 }
@@ -14717,17 +14721,17 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetAccelerationStructureDeviceAddressKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureDeviceAddressKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureDeviceAddressKHR(device, pInfo);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureDeviceAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetAccelerationStructureDeviceAddressKHR(device, pInfo);
     }
     VkDeviceAddress result = DispatchGetAccelerationStructureDeviceAddressKHR(device, pInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureDeviceAddressKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetAccelerationStructureDeviceAddressKHR(device, pInfo, result);
     }
     return result;
@@ -14743,17 +14747,17 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
     DispatchCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
     }
 }
@@ -14765,17 +14769,17 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceAccelerationStructureCompatibilityKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceAccelerationStructureCompatibilityKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetDeviceAccelerationStructureCompatibilityKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
     }
     DispatchGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetDeviceAccelerationStructureCompatibilityKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
     }
 }
@@ -14789,17 +14793,17 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureBuildSizesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetAccelerationStructureBuildSizesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetAccelerationStructureBuildSizesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
     }
     DispatchGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetAccelerationStructureBuildSizesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
     }
 }
@@ -14817,17 +14821,17 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
     }
     DispatchCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
     }
 }
@@ -14842,17 +14846,17 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingCaptureReplayShaderGroupHandlesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     }
     VkResult result = DispatchGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData, result);
     }
     return result;
@@ -14868,17 +14872,17 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysIndirectKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdTraceRaysIndirectKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
     }
     DispatchCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdTraceRaysIndirectKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
     }
 }
@@ -14891,17 +14895,17 @@ VKAPI_ATTR VkDeviceSize VKAPI_CALL GetRayTracingShaderGroupStackSizeKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRayTracingShaderGroupStackSizeKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
         if (skip) return 0;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordGetRayTracingShaderGroupStackSizeKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
     }
     VkDeviceSize result = DispatchGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordGetRayTracingShaderGroupStackSizeKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
     }
     return result;
@@ -14913,17 +14917,17 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRayTracingPipelineStackSizeKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetRayTracingPipelineStackSizeKHR]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdSetRayTracingPipelineStackSizeKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
     }
     DispatchCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdSetRayTracingPipelineStackSizeKHR]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
     }
 }
@@ -14938,17 +14942,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
     DispatchCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ);
     }
 }
@@ -14962,17 +14966,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride);
     }
 }
@@ -14988,17 +14992,17 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     bool skip = false;
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountEXT]) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
         if (skip) return;
     }
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCmdDrawMeshTasksIndirectCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
     DispatchCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountEXT]) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     }
 }
@@ -51,22 +51,9 @@
 #include "vk_typemap_helper.h"
 
 
-extern std::atomic<uint64_t> global_unique_id;
-
-// To avoid re-hashing unique ids on each use, we precompute the hash and store the
-// hash's LSBs in the high 24 bits.
-struct HashedUint64 {
-    static const int HASHED_UINT64_SHIFT = 40;
-    size_t operator()(const uint64_t &t) const { return t >> HASHED_UINT64_SHIFT; }
-
-    static uint64_t hash(uint64_t id) {
-        uint64_t h = (uint64_t)layer_data::hash<uint64_t>()(id);
-        id |= h << HASHED_UINT64_SHIFT;
-        return id;
-    }
-};
-
-extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+// Map of unique (wrapped) ids to actual object handles. The ids are allocated by the table itself, see
+// vl_concurrent_id_table.
+extern vl_concurrent_id_table unique_id_mapping;
 
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(
@@ -3959,6 +3946,8 @@ class ValidationObject {
 
         std::vector<ValidationObject*> object_dispatch;
         LayerObjectTypeId container_type;
+        // Device validation objects indexed by container type, used by a statically dispatched chassis
+        std::array<ValidationObject*, LayerObjectTypeMaxEnum> static_dispatch_objects{};
 
         vl_concurrent_unordered_map<VkDeferredOperationKHR, std::vector<std::function<void()>>, 0> deferred_operation_post_completion;
         vl_concurrent_unordered_map<VkDeferredOperationKHR, std::vector<std::function<void(const std::vector<VkPipeline>&)>>, 0> deferred_operation_post_check;
@@ -3981,6 +3970,17 @@ class ValidationObject {
             return WriteLockGuard(validation_object_mutex);
         }
 
+        // Locks taken by the chassis around each hook. An object whose ReadLock()/WriteLock() only return deferred guards
+        // (fine grained locking, or no shared state) has chassis_locking cleared at CreateDevice, which skips the virtual
+        // calls entirely.
+        bool chassis_locking{true};
+        ReadLockGuard ChassisReadLock() {
+            return chassis_locking ? ReadLock() : ReadLockGuard();
+        }
+        WriteLockGuard ChassisWriteLock() {
+            return chassis_locking ? WriteLock() : WriteLockGuard();
+        }
+
         void RegisterValidationObject(bool vo_enabled, uint32_t instance_api_version,
             debug_report_data* instance_report_data, std::vector<ValidationObject*> &dispatch_list) {
             if (vo_enabled) {
@@ -4201,17 +4201,13 @@ class ValidationObject {
         // Wrap a newly created handle with a new unique ID, and return the new ID.
         template <typename HandleType>
         HandleType WrapNew(HandleType newlyCreatedHandle) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.add(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             return (HandleType)unique_id;
         }
 
         // Specialized handling for VkDisplayKHR. Adds an entry to enable reverse-lookup.
         VkDisplayKHR WrapDisplay(VkDisplayKHR newlyCreatedHandle, ValidationObject *map_data) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.add(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             map_data->display_id_reverse_mapping.insert_or_assign(newlyCreatedHandle, unique_id);
             return (VkDisplayKHR)unique_id;
         }
@@ -26,6 +26,9 @@
 #include "thread_safety.h"
 
 
+std::atomic<uint64_t> ThreadSafety::command_buffer_use_generation{1};
+std::atomic<uint64_t> ThreadSafety::next_command_buffer_use_owner_id{1};
+
 ReadLockGuard ThreadSafety::ReadLock() {
     return ReadLockGuard(validation_object_mutex, std::defer_lock);
 }
@@ -20,11 +20,15 @@
 #include "gpu_utils.h"
 #include "descriptor_sets.h"
 #include "sync_utils.h"
+#include "xxhash.h"
 #include "spirv-tools/libspirv.h"
 #include "spirv-tools/optimizer.hpp"
 #include "spirv-tools/instrument.hpp"
 #include <spirv/unified1/spirv.hpp>
 #include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <random>
 #include <regex>
 
 #ifdef _MSC_VER
@@ -42,8 +46,18 @@
 #endif
 
 // Implementation for Descriptor Set Manager class
-UtilDescriptorSetManager::UtilDescriptorSetManager(VkDevice device, uint32_t num_bindings_in_set)
-    : device(device), num_bindings_in_set(num_bindings_in_set) {}
+UtilDescriptorSetManager::UtilDescriptorSetManager(VkDevice device, const std::vector<VkDescriptorSetLayoutBinding> &bindings)
+    : device(device) {
+    for (const auto &binding : bindings) {
+        auto size = std::find_if(set_sizes_.begin(), set_sizes_.end(),
+                                 [&binding](const VkDescriptorPoolSize &size) { return size.type == binding.descriptorType; });
+        if (size == set_sizes_.end()) {
+            set_sizes_.push_back({binding.descriptorType, binding.descriptorCount});
+        } else {
+            size->descriptorCount += binding.descriptorCount;
+        }
+    }
+}
 
 UtilDescriptorSetManager::~UtilDescriptorSetManager() {
     for (auto &pool : desc_pool_map_) {
@@ -88,15 +102,15 @@ VkResult UtilDescriptorSetManager::GetDescriptorSets(uint32_t count, VkDescripto
         if (count > default_pool_size) {
             pool_count = count;
         }
-        const VkDescriptorPoolSize size_counts = {
-            VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
-            pool_count * num_bindings_in_set,
-        };
+        std::vector<VkDescriptorPoolSize> size_counts = set_sizes_;
+        for (auto &size : size_counts) {
+            size.descriptorCount *= pool_count;
+        }
         auto desc_pool_info = LvlInitStruct<VkDescriptorPoolCreateInfo>();
         desc_pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
         desc_pool_info.maxSets = pool_count;
-        desc_pool_info.poolSizeCount = 1;
-        desc_pool_info.pPoolSizes = &size_counts;
+        desc_pool_info.poolSizeCount = static_cast<uint32_t>(size_counts.size());
+        desc_pool_info.pPoolSizes = size_counts.data();
         result = DispatchCreateDescriptorPool(device, &desc_pool_info, NULL, &pool_to_use);
         assert(result == VK_SUCCESS);
         if (result != VK_SUCCESS) {
@@ -138,6 +152,195 @@ void UtilDescriptorSetManager::PutBackDescriptorSet(VkDescriptorPool desc_pool,
     return;
 }
 
+// Header of the instrumentation cache file: magic, format version and the hash of the SPIRV-Tools commit ID in two words
+static constexpr uint32_t kInstrumentationCacheMagic = 0x43494c56;  // "VLIC"
+static constexpr uint32_t kInstrumentationCacheVersion = 2;
+static constexpr size_t kInstrumentationCacheHeaderWords = 4;
+// Each entry is the hash, check hash and options (two words each), input size, patch count and program size, then the patches
+// and program
+static constexpr size_t kInstrumentationCacheEntryWords = 9;
+// Seed of the check hash, mixed with the options so that it is independent of the key hash
+static constexpr uint64_t kInstrumentationCacheCheckSeed = 0x9e3779b97f4a7c15ULL;
+
+static uint64_t SpirvToolsCommitHash() { return XXH64(SPIRV_TOOLS_COMMIT_ID, strlen(SPIRV_TOOLS_COMMIT_ID), 0); }
+
+// Calls func(word_index, words) for every instruction of the SPIR-V module
+template <typename Func>
+static void ForEachSpirvInstruction(const uint32_t *code, size_t size, Func &&func) {
+    for (size_t i = 5; i < size;) {
+        const uint32_t word_count = code[i] >> 16;
+        if (word_count == 0 || i + word_count > size) {
+            break;
+        }
+        func(&code[i], word_count);
+        i += word_count;
+    }
+}
+
+uint64_t UtilInstrumentationCache::Hash(const layer_data::span<const uint32_t> &input, uint64_t options) {
+    return XXH64(input.data(), input.size() * sizeof(uint32_t), options);
+}
+
+uint64_t UtilInstrumentationCache::CheckHash(const layer_data::span<const uint32_t> &input, uint64_t options) {
+    return XXH64(input.data(), input.size() * sizeof(uint32_t), options ^ kInstrumentationCacheCheckSeed);
+}
+
+bool UtilInstrumentationCache::CanCache(const layer_data::span<const uint32_t> &input) {
+    bool can_cache = true;
+    ForEachSpirvInstruction(input.data(), input.size(), [&can_cache](const uint32_t *insn, uint32_t word_count) {
+        const uint32_t opcode = insn[0] & 0xffff;
+        if ((opcode == spv::OpConstant || opcode == spv::OpSpecConstant) && word_count == 4 && insn[3] == kPlaceholderShaderId) {
+            can_cache = false;
+        }
+    });
+    return can_cache;
+}
+
+void UtilInstrumentationCache::Load(const std::string &path) {
+    std::lock_guard<std::mutex> guard(lock_);
+    path_ = path;
+    std::ifstream read_file(path_.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+    if (!read_file) {
+        return;
+    }
+    const auto file_size = static_cast<size_t>(read_file.tellg());
+    std::vector<uint32_t> data(file_size / sizeof(uint32_t));
+    read_file.seekg(0);
+    read_file.read(reinterpret_cast<char *>(data.data()), data.size() * sizeof(uint32_t));
+    if (!read_file || data.size() < kInstrumentationCacheHeaderWords || data[0] != kInstrumentationCacheMagic ||
+        data[1] != kInstrumentationCacheVersion) {
+        return;
+    }
+    const uint64_t commit_hash = SpirvToolsCommitHash();
+    if (data[2] != static_cast<uint32_t>(commit_hash) || data[3] != static_cast<uint32_t>(commit_hash >> 32)) {
+        return;  // instrumented by a different version of SPIRV-Tools
+    }
+
+    size_t pos = kInstrumentationCacheHeaderWords;
+    while (pos + kInstrumentationCacheEntryWords <= data.size()) {
+        const uint32_t *words = &data[pos];
+        const uint64_t hash = words[0] | (static_cast<uint64_t>(words[1]) << 32);
+        Entry entry;
+        entry.check = words[2] | (static_cast<uint64_t>(words[3]) << 32);
+        entry.options = words[4] | (static_cast<uint64_t>(words[5]) << 32);
+        entry.input_size = words[6];
+        entry.used = false;
+        const size_t patch_count = words[7];
+        const size_t pgm_size = words[8];
+        pos += kInstrumentationCacheEntryWords;
+        if (pos + patch_count + pgm_size > data.size()) {
+            break;  // truncated file
+        }
+        entry.patches.assign(&data[pos], &data[pos] + patch_count);
+        pos += patch_count;
+        entry.pgm.assign(&data[pos], &data[pos] + pgm_size);
+        pos += pgm_size;
+        if (std::any_of(entry.patches.begin(), entry.patches.end(), [pgm_size](uint32_t patch) { return patch >= pgm_size; })) {
+            continue;
+        }
+        entries_.emplace(hash, std::move(entry));
+    }
+}
+
+void UtilInstrumentationCache::Save() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (path_.empty() || !dirty_) {
+        return;
+    }
+    const uint64_t commit_hash = SpirvToolsCommitHash();
+    std::vector<uint32_t> data = {kInstrumentationCacheMagic, kInstrumentationCacheVersion, static_cast<uint32_t>(commit_hash),
+                                  static_cast<uint32_t>(commit_hash >> 32)};
+    // Entries used by this process go first, so that they are the ones kept if the file reaches its maximum size
+    for (const bool used : {true, false}) {
+        for (const auto &item : entries_) {
+            const auto &entry = item.second;
+            const size_t entry_words = kInstrumentationCacheEntryWords + entry.patches.size() + entry.pgm.size();
+            if (entry.used != used || data.size() + entry_words > kMaxFileWords) {
+                continue;
+            }
+            data.insert(data.end(), {static_cast<uint32_t>(item.first), static_cast<uint32_t>(item.first >> 32),
+                                     static_cast<uint32_t>(entry.check), static_cast<uint32_t>(entry.check >> 32),
+                                     static_cast<uint32_t>(entry.options), static_cast<uint32_t>(entry.options >> 32),
+                                     entry.input_size, static_cast<uint32_t>(entry.patches.size()),
+                                     static_cast<uint32_t>(entry.pgm.size())});
+            data.insert(data.end(), entry.patches.begin(), entry.patches.end());
+            data.insert(data.end(), entry.pgm.begin(), entry.pgm.end());
+        }
+    }
+    // Write to a temporary file that replaces the cache once complete, so that another process loading the cache while it
+    // is written never reads a partial file
+    const std::string temp_path = path_ + "." + std::to_string(std::random_device{}()) + ".tmp";
+    std::ofstream write_file(temp_path.c_str(), std::ios::out | std::ios::binary);
+    if (!write_file) {
+        return;
+    }
+    write_file.write(reinterpret_cast<const char *>(data.data()), data.size() * sizeof(uint32_t));
+    write_file.close();
+    if (!write_file) {
+        std::remove(temp_path.c_str());
+        return;
+    }
+    if (std::rename(temp_path.c_str(), path_.c_str()) != 0) {
+        // rename does not replace an existing file on all platforms
+        std::remove(path_.c_str());
+        if (std::rename(temp_path.c_str(), path_.c_str()) != 0) {
+            std::remove(temp_path.c_str());
+            return;
+        }
+    }
+    dirty_ = false;
+}
+
+bool UtilInstrumentationCache::Find(const layer_data::span<const uint32_t> &input, uint64_t options, uint32_t shader_id,
+                                    std::vector<uint32_t> &new_pgm) {
+    const uint64_t hash = Hash(input, options);
+    const uint64_t check = CheckHash(input, options);
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = entries_.find(hash);
+    if (it == entries_.end() || it->second.options != options || it->second.input_size != input.size() ||
+        it->second.check != check) {
+        return false;
+    }
+    auto &entry = it->second;
+    if (!entry.used) {
+        entry.used = true;
+        dirty_ = true;
+    }
+    new_pgm = entry.pgm;
+    for (const uint32_t patch : entry.patches) {
+        new_pgm[patch] = shader_id;
+    }
+    return true;
+}
+
+void UtilInstrumentationCache::Insert(const layer_data::span<const uint32_t> &input, uint64_t options,
+                                      std::vector<uint32_t> &new_pgm, uint32_t shader_id) {
+    // Find the 32-bit integer constants holding the placeholder shader ID
+    Entry entry;
+    entry.check = CheckHash(input, options);
+    entry.options = options;
+    entry.input_size = static_cast<uint32_t>(input.size());
+    entry.used = true;
+    layer_data::unordered_set<uint32_t> int32_types;
+    ForEachSpirvInstruction(new_pgm.data(), new_pgm.size(), [&](const uint32_t *insn, uint32_t word_count) {
+        const uint32_t opcode = insn[0] & 0xffff;
+        if (opcode == spv::OpTypeInt && word_count == 4 && insn[2] == 32) {
+            int32_types.insert(insn[1]);
+        } else if (opcode == spv::OpConstant && word_count == 4 && insn[3] == kPlaceholderShaderId && int32_types.count(insn[1])) {
+            entry.patches.push_back(static_cast<uint32_t>(&insn[3] - new_pgm.data()));
+        }
+    });
+    entry.pgm = new_pgm;
+    for (const uint32_t patch : entry.patches) {
+        new_pgm[patch] = shader_id;
+    }
+
+    const uint64_t hash = Hash(input, options);
+    std::lock_guard<std::mutex> guard(lock_);
+    entries_[hash] = std::move(entry);
+    dirty_ = true;
+}
+
 // Trampolines to make VMA call Dispatch for Vulkan calls
 static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL gpuVkGetInstanceProcAddr(VkInstance inst, const char *name) {
     return DispatchGetInstanceProcAddr(inst, name);
@@ -322,10 +525,15 @@ void GpuAssistedBase::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
         return;
     }
     desc_set_bind_index = adjusted_max_desc_sets - 1;
+    for (const auto &binding : bindings_) {
+        if (binding.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC) {
+            debug_desc_storage_buffers_dynamic += binding.descriptorCount;
+        }
+    }
 
     VkResult result1 = UtilInitializeVma(instance, physical_device, device, &vmaAllocator);
     assert(result1 == VK_SUCCESS);
-    desc_set_manager = std::make_unique<UtilDescriptorSetManager>(device, static_cast<uint32_t>(bindings_.size()));
+    desc_set_manager = std::make_unique<UtilDescriptorSetManager>(device, bindings_);
 
     const VkDescriptorSetLayoutCreateInfo debug_desc_layout_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, NULL, 0,
                                                                     static_cast<uint32_t>(bindings_.size()), bindings_.data()};
@@ -355,6 +563,7 @@ void GpuAssistedBase::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
 }
 
 void GpuAssistedBase::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    DrainReadbacks();
     if (debug_desc_layout) {
         DispatchDestroyDescriptorSetLayout(device, debug_desc_layout, NULL);
         debug_desc_layout = VK_NULL_HANDLE;
@@ -372,12 +581,14 @@ void GpuAssistedBase::PreCallRecordDestroyDevice(VkDevice device, const VkAlloca
         vmaDestroyAllocator(vmaAllocator);
     }
     desc_set_manager.reset();
+    instrumentation_cache.Save();
 }
 
 gpu_utils_state::Queue::Queue(GpuAssistedBase &state, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags, const VkQueueFamilyProperties &queueFamilyProperties)
     : QUEUE_STATE(state, q, index, flags, queueFamilyProperties), state_(state) {}
 
 gpu_utils_state::Queue::~Queue() {
+    Destroy();
     if (barrier_command_buffer_) {
         DispatchFreeCommandBuffers(state_.device, barrier_command_pool_, 1, &barrier_command_buffer_);
         barrier_command_buffer_ = VK_NULL_HANDLE;
@@ -388,54 +599,171 @@ gpu_utils_state::Queue::~Queue() {
     }
 }
 
-// Submit a memory barrier on graphics queues.
-// Lazy-create and record the needed command buffer.
-void gpu_utils_state::Queue::SubmitBarrier() {
-    if (barrier_command_pool_ == VK_NULL_HANDLE) {
-        VkResult result = VK_SUCCESS;
+void gpu_utils_state::Queue::Destroy() {
+    // Stop the queue thread first, so that it can't race with reading back what is left
+    QUEUE_STATE::Destroy();
+    ProcessReadbacks(UINT64_MAX);
+    for (auto fence : free_fences_) {
+        DispatchDestroyFence(state_.device, fence, nullptr);
+    }
+    free_fences_.clear();
+}
 
-        auto pool_create_info = LvlInitStruct<VkCommandPoolCreateInfo>();
-        pool_create_info.queueFamilyIndex = queueFamilyIndex;
-        result = DispatchCreateCommandPool(state_.device, &pool_create_info, nullptr, &barrier_command_pool_);
-        if (result != VK_SUCCESS) {
-            state_.ReportSetupProblem(state_.device, "Unable to create command pool for barrier CB.");
-            barrier_command_pool_ = VK_NULL_HANDLE;
-            return;
-        }
+// Lazy-create and record the command buffer holding the barrier.
+bool gpu_utils_state::Queue::InitBarrierCommandBuffer() {
+    if (barrier_command_pool_ != VK_NULL_HANDLE) {
+        return barrier_command_buffer_ != VK_NULL_HANDLE;
+    }
+    VkResult result = VK_SUCCESS;
 
-        auto buffer_alloc_info = LvlInitStruct<VkCommandBufferAllocateInfo>();
-        buffer_alloc_info.commandPool = barrier_command_pool_;
-        buffer_alloc_info.commandBufferCount = 1;
-        buffer_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        result = DispatchAllocateCommandBuffers(state_.device, &buffer_alloc_info, &barrier_command_buffer_);
-        if (result != VK_SUCCESS) {
-            state_.ReportSetupProblem(state_.device, "Unable to create barrier command buffer.");
-            DispatchDestroyCommandPool(state_.device, barrier_command_pool_, nullptr);
-            barrier_command_pool_ = VK_NULL_HANDLE;
-            barrier_command_buffer_ = VK_NULL_HANDLE;
-            return;
-        }
+    auto pool_create_info = LvlInitStruct<VkCommandPoolCreateInfo>();
+    pool_create_info.queueFamilyIndex = queueFamilyIndex;
+    result = DispatchCreateCommandPool(state_.device, &pool_create_info, nullptr, &barrier_command_pool_);
+    if (result != VK_SUCCESS) {
+        state_.ReportSetupProblem(state_.device, "Unable to create command pool for barrier CB.");
+        barrier_command_pool_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    auto buffer_alloc_info = LvlInitStruct<VkCommandBufferAllocateInfo>();
+    buffer_alloc_info.commandPool = barrier_command_pool_;
+    buffer_alloc_info.commandBufferCount = 1;
+    buffer_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    result = DispatchAllocateCommandBuffers(state_.device, &buffer_alloc_info, &barrier_command_buffer_);
+    if (result != VK_SUCCESS) {
+        state_.ReportSetupProblem(state_.device, "Unable to create barrier command buffer.");
+        DispatchDestroyCommandPool(state_.device, barrier_command_pool_, nullptr);
+        barrier_command_pool_ = VK_NULL_HANDLE;
+        barrier_command_buffer_ = VK_NULL_HANDLE;
+        return false;
+    }
+
+    // Hook up command buffer dispatch
+    state_.vkSetDeviceLoaderData(state_.device, barrier_command_buffer_);
+
+    // Record a global memory barrier to force availability of device memory operations to the host domain.
+    // The queue is no longer drained after each submit, so the barrier can be pending more than once.
+    auto command_buffer_begin_info = LvlInitStruct<VkCommandBufferBeginInfo>();
+    command_buffer_begin_info.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+    result = DispatchBeginCommandBuffer(barrier_command_buffer_, &command_buffer_begin_info);
+    if (result == VK_SUCCESS) {
+        auto memory_barrier = LvlInitStruct<VkMemoryBarrier>();
+        memory_barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        memory_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        DispatchCmdPipelineBarrier(barrier_command_buffer_, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1,
+                                   &memory_barrier, 0, nullptr, 0, nullptr);
+        DispatchEndCommandBuffer(barrier_command_buffer_);
+    }
+    return true;
+}
 
-        // Hook up command buffer dispatch
-        state_.vkSetDeviceLoaderData(state_.device, barrier_command_buffer_);
-
-        // Record a global memory barrier to force availability of device memory operations to the host domain.
-        auto command_buffer_begin_info = LvlInitStruct<VkCommandBufferBeginInfo>();
-        result = DispatchBeginCommandBuffer(barrier_command_buffer_, &command_buffer_begin_info);
-        if (result == VK_SUCCESS) {
-            auto memory_barrier = LvlInitStruct<VkMemoryBarrier>();
-            memory_barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
-            memory_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
-            DispatchCmdPipelineBarrier(barrier_command_buffer_, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0,
-                                       1, &memory_barrier, 0, nullptr, 0, nullptr);
-            DispatchEndCommandBuffer(barrier_command_buffer_);
+VkFence gpu_utils_state::Queue::GetBarrierFence() {
+    {
+        std::lock_guard<std::mutex> guard(readback_lock_);
+        if (!free_fences_.empty()) {
+            VkFence fence = free_fences_.back();
+            free_fences_.pop_back();
+            return fence;
         }
     }
-    if (barrier_command_buffer_ != VK_NULL_HANDLE) {
+    VkFence fence = VK_NULL_HANDLE;
+    auto fence_create_info = LvlInitStruct<VkFenceCreateInfo>();
+    if (DispatchCreateFence(state_.device, &fence_create_info, nullptr, &fence) != VK_SUCCESS) {
+        state_.ReportSetupProblem(state_.device, "Unable to create fence for barrier CB.");
+        return VK_NULL_HANDLE;
+    }
+    return fence;
+}
+
+// Submit a memory barrier on graphics queues, signaling a fence that the queue thread waits on before reading the output
+// buffers of the command buffers of submissions.
+void gpu_utils_state::Queue::SubmitBarrier(std::vector<Submission> &&submissions) {
+    VkFence fence = VK_NULL_HANDLE;
+    if (InitBarrierCommandBuffer()) {
+        fence = GetBarrierFence();
         auto submit_info = LvlInitStruct<VkSubmitInfo>();
         submit_info.commandBufferCount = 1;
         submit_info.pCommandBuffers = &barrier_command_buffer_;
-        DispatchQueueSubmit(QUEUE_STATE::Queue(), 1, &submit_info, VK_NULL_HANDLE);
+        if (DispatchQueueSubmit(QUEUE_STATE::Queue(), 1, &submit_info, fence) != VK_SUCCESS && fence != VK_NULL_HANDLE) {
+            std::lock_guard<std::mutex> guard(readback_lock_);
+            free_fences_.push_back(fence);
+            fence = VK_NULL_HANDLE;
+        }
+    }
+    uint64_t retired_seq = 0;
+    {
+        std::lock_guard<std::mutex> guard(readback_lock_);
+        for (auto &submission : submissions) {
+            const bool last_in_batch = &submission == &submissions.back();
+            pending_readbacks_.emplace_back(
+                PendingReadback{submission.seq, fence, last_in_batch, std::move(submission.command_buffers)});
+        }
+        retired_seq = retired_seq_;
+    }
+    // The state tracker made these submissions retirable before this point, so another thread waiting on a fence or timeline
+    // semaphore may already have retired them on the queue thread without finding them here. Read those back now.
+    if (retired_seq >= submissions.front().seq) {
+        ProcessReadbacks(retired_seq);
+    }
+}
+
+static void ProcessCommandBuffer(VkQueue queue, gpu_utils_state::CommandBuffer &cb_node) {
+    auto guard = cb_node.WriteLock();
+    cb_node.Process(queue);
+    for (auto *secondary_cmd_base : cb_node.linkedCommandBuffers) {
+        auto *secondary_cb_node = static_cast<gpu_utils_state::CommandBuffer *>(secondary_cmd_base);
+        auto secondary_guard = secondary_cb_node->WriteLock();
+        secondary_cb_node->Process(queue);
+    }
+}
+
+// Check the debug buffers of the submissions up to until_seq, oldest first, so that messages are reported in submission
+// order.
+void gpu_utils_state::Queue::ProcessReadbacks(uint64_t until_seq) {
+    std::lock_guard<std::mutex> process_guard(process_lock_);
+    while (true) {
+        PendingReadback readback;
+        {
+            std::lock_guard<std::mutex> guard(readback_lock_);
+            if (pending_readbacks_.empty() || pending_readbacks_.front().seq > until_seq) {
+                break;
+            }
+            readback = std::move(pending_readbacks_.front());
+            pending_readbacks_.pop_front();
+        }
+        if (readback.fence != VK_NULL_HANDLE) {
+            // The barrier follows the batch of a submission the application has seen complete, so this wait is short.
+            DispatchWaitForFences(state_.device, 1, &readback.fence, VK_TRUE, UINT64_MAX);
+            if (readback.last_in_batch) {
+                DispatchResetFences(state_.device, 1, &readback.fence);
+            }
+        }
+        for (auto &cb_node : readback.command_buffers) {
+            ProcessCommandBuffer(QUEUE_STATE::Queue(), *cb_node);
+        }
+        if (readback.fence != VK_NULL_HANDLE && readback.last_in_batch) {
+            std::lock_guard<std::mutex> guard(readback_lock_);
+            free_fences_.push_back(readback.fence);
+        }
+    }
+}
+
+void gpu_utils_state::Queue::Retire(CB_SUBMISSION &submission) {
+    {
+        // Published before looking for readbacks, so that SubmitBarrier() reads back whatever it enqueues after this
+        std::lock_guard<std::mutex> guard(readback_lock_);
+        retired_seq_ = submission.seq;
+    }
+    ProcessReadbacks(submission.seq);
+    QUEUE_STATE::Retire(submission);
+}
+
+// Read back the submissions the application never waited for, while the command buffers still hold their output buffers:
+// the command pools are destroyed, resetting their command buffers, before the queues are.
+void GpuAssistedBase::DrainReadbacks() {
+    for (auto &entry : queue_map_.snapshot()) {
+        // Stopping the queue thread first, so the queue can be destroyed again by the state tracker
+        std::static_pointer_cast<gpu_utils_state::Queue>(entry.second)->Destroy();
     }
 }
 
@@ -454,70 +782,61 @@ bool GpuAssistedBase::CommandBufferNeedsProcessing(VkCommandBuffer command_buffe
     return false;
 }
 
-void GpuAssistedBase::ProcessCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer) {
-    auto cb_node = GetWrite<gpu_utils_state::CommandBuffer>(command_buffer);
-
-    cb_node->Process(queue);
-    for (auto *secondary_cmd_base : cb_node->linkedCommandBuffers) {
-        auto *secondary_cb_node = static_cast<gpu_utils_state::CommandBuffer *>(secondary_cmd_base);
-        auto guard = secondary_cb_node->WriteLock();
-        secondary_cb_node->Process(queue);
-    }
-}
-
 // Issue a memory barrier to make GPU-written data available to host.
-// Wait for the queue to complete execution.
-// Check the debug buffers for all the command buffers that were submitted.
+// The debug buffers of the submitted command buffers are checked on the queue thread once the application has waited
+// for the submission, through a fence, semaphore, vkQueueWaitIdle or vkDeviceWaitIdle.
 void GpuAssistedBase::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
                                                 VkResult result) {
     ValidationStateTracker::PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
 
     if (aborted || (result != VK_SUCCESS)) return;
-    bool buffers_present = false;
-    // Don't QueueWaitIdle if there's nothing to process
+    auto queue_state = Get<gpu_utils_state::Queue>(queue);
+    if (!queue_state) return;
+    // The state tracker gave each VkSubmitInfo a sequence number of its own, the last one being the most recent of the queue
+    const uint64_t first_seq = queue_state->SubmittedSeq() - submitCount + 1;
+    std::vector<gpu_utils_state::Queue::Submission> submissions;
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
+        std::vector<std::shared_ptr<gpu_utils_state::CommandBuffer>> command_buffers;
         for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
-            buffers_present |= CommandBufferNeedsProcessing(submit->pCommandBuffers[i]);
+            if (CommandBufferNeedsProcessing(submit->pCommandBuffers[i])) {
+                command_buffers.emplace_back(Get<gpu_utils_state::CommandBuffer>(submit->pCommandBuffers[i]));
+            }
         }
-    }
-    if (!buffers_present) return;
-
-    SubmitBarrier(queue);
-
-    DispatchQueueWaitIdle(queue);
-
-    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
-        const VkSubmitInfo *submit = &pSubmits[submit_idx];
-        for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
-            ProcessCommandBuffer(queue, submit->pCommandBuffers[i]);
+        if (!command_buffers.empty()) {
+            submissions.emplace_back(gpu_utils_state::Queue::Submission{first_seq + submit_idx, std::move(command_buffers)});
         }
     }
+    // Don't submit a barrier if there's nothing to process
+    if (submissions.empty()) return;
+
+    queue_state->SubmitBarrier(std::move(submissions));
 }
 
 void GpuAssistedBase::RecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
                                          VkResult result) {
     if (aborted || (result != VK_SUCCESS)) return;
-    bool buffers_present = false;
-    // Don't QueueWaitIdle if there's nothing to process
+    auto queue_state = Get<gpu_utils_state::Queue>(queue);
+    if (!queue_state) return;
+    // The state tracker gave each VkSubmitInfo2 a sequence number of its own, the last one being the most recent of the queue
+    const uint64_t first_seq = queue_state->SubmittedSeq() - submitCount + 1;
+    std::vector<gpu_utils_state::Queue::Submission> submissions;
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
+        std::vector<std::shared_ptr<gpu_utils_state::CommandBuffer>> command_buffers;
         for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
-            buffers_present |= CommandBufferNeedsProcessing(submit->pCommandBufferInfos[i].commandBuffer);
+            if (CommandBufferNeedsProcessing(submit->pCommandBufferInfos[i].commandBuffer)) {
+                command_buffers.emplace_back(Get<gpu_utils_state::CommandBuffer>(submit->pCommandBufferInfos[i].commandBuffer));
+            }
         }
-    }
-    if (!buffers_present) return;
-
-    SubmitBarrier(queue);
-
-    DispatchQueueWaitIdle(queue);
-
-    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
-        const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
-        for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
-            ProcessCommandBuffer(queue, submit->pCommandBufferInfos[i].commandBuffer);
+        if (!command_buffers.empty()) {
+            submissions.emplace_back(gpu_utils_state::Queue::Submission{first_seq + submit_idx, std::move(command_buffers)});
         }
     }
+    // Don't submit a barrier if there's nothing to process
+    if (submissions.empty()) return;
+
+    queue_state->SubmitBarrier(std::move(submissions));
 }
 
 void GpuAssistedBase::PostCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
@@ -584,6 +903,31 @@ bool GpuAssistedBase::PreCallValidateCmdWaitEvents2(VkCommandBuffer commandBuffe
     return ValidateCmdWaitEvents(commandBuffer, src_stage_mask, CMD_WAITEVENTS2);
 }
 
+// The validation descriptor set counts against the application's dynamic storage buffer limit. The limit reported to the
+// application is lowered accordingly, but the application may not have queried it.
+bool GpuAssistedBase::TooManyStorageBuffersDynamic(const PIPELINE_LAYOUT_STATE::SetLayoutVector &set_layouts) const {
+    if (debug_desc_storage_buffers_dynamic == 0) {
+        return false;
+    }
+    uint32_t storage_buffers_dynamic = debug_desc_storage_buffers_dynamic;
+    for (const auto &set_layout : set_layouts) {
+        if (!set_layout) {
+            continue;
+        }
+        for (const auto &binding : set_layout->GetBindings()) {
+            if (binding.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC) {
+                storage_buffers_dynamic += binding.descriptorCount;
+            }
+        }
+    }
+    return storage_buffers_dynamic > phys_dev_props.limits.maxDescriptorSetStorageBuffersDynamic;
+}
+
+bool GpuAssistedBase::PipelineLayoutConflicts(const PIPELINE_LAYOUT_STATE &pipeline_layout) const {
+    return pipeline_layout.set_layouts.size() >= adjusted_max_desc_sets ||
+           TooManyStorageBuffersDynamic(pipeline_layout.set_layouts);
+}
+
 void GpuAssistedBase::PreCallRecordCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo *pCreateInfo,
                                                         const VkAllocationCallbacks *pAllocator, VkPipelineLayout *pPipelineLayout,
                                                         void *cpl_state_data) {
@@ -591,6 +935,13 @@ void GpuAssistedBase::PreCallRecordCreatePipelineLayout(VkDevice device, const V
         return;
     }
     auto cpl_state = static_cast<create_pipeline_layout_api_state *>(cpl_state_data);
+    PIPELINE_LAYOUT_STATE::SetLayoutVector set_layouts;
+    if (debug_desc_storage_buffers_dynamic > 0) {
+        set_layouts.reserve(pCreateInfo->setLayoutCount);
+        for (uint32_t i = 0; i < pCreateInfo->setLayoutCount; ++i) {
+            set_layouts.emplace_back(Get<cvdescriptorset::DescriptorSetLayout>(pCreateInfo->pSetLayouts[i]));
+        }
+    }
     if (cpl_state->modified_create_info.setLayoutCount >= adjusted_max_desc_sets) {
         std::ostringstream strm;
         strm << "Pipeline Layout conflict with validation's descriptor set at slot " << desc_set_bind_index << ". "
@@ -598,6 +949,13 @@ void GpuAssistedBase::PreCallRecordCreatePipelineLayout(VkDevice device, const V
              << "Validation is not modifying the pipeline layout. "
              << "Instrumented shaders are replaced with non-instrumented shaders.";
         ReportSetupProblem(device, strm.str().c_str());
+    } else if (TooManyStorageBuffersDynamic(set_layouts)) {
+        std::ostringstream strm;
+        strm << "Pipeline Layout conflict with validation's descriptor set at slot " << desc_set_bind_index << ". "
+             << "Application uses too many dynamic storage buffers in the pipeline layout to continue with gpu validation. "
+             << "Validation is not modifying the pipeline layout. "
+             << "Instrumented shaders are replaced with non-instrumented shaders.";
+        ReportSetupProblem(device, strm.str().c_str());
     } else {
         // Modify the pipeline layout by:
         // 1. Copying the caller's descriptor set desc_layouts
@@ -815,6 +1173,16 @@ void GpuAssistedBase::PreCallRecordPipelineCreations(uint32_t count, const Creat
         return;
     }
 
+    // Shaders defined inline in pipeline libraries are instrumented here, rather than when their shader module is created
+    struct PipelineInstrumentationJob {
+        uint32_t pipeline;
+        VkShaderStageFlagBits stage_flag;
+        SHADER_MODULE_STATE *module_state;
+        create_shader_module_api_state *csm_state;
+    };
+    std::vector<PipelineInstrumentationJob> instrumentation_jobs;
+    const size_t first_new_ci = new_pipeline_create_infos->size();
+
     // Walk through all the pipelines, make a copy of each and flag each pipeline that contains a shader that uses the debug
     // descriptor set index.
     for (uint32_t pipeline = 0; pipeline < count; ++pipeline) {
@@ -826,10 +1194,10 @@ void GpuAssistedBase::PreCallRecordPipelineCreations(uint32_t count, const Creat
         if (pipe->active_slots.find(desc_set_bind_index) != pipe->active_slots.end()) {
             replace_shaders = true;
         }
-        // If the app requests all available sets, the pipeline layout was not modified at pipeline layout creation and the
-        // already instrumented shaders need to be replaced with uninstrumented shaders
+        // If the app requests all available sets or dynamic storage buffers, the pipeline layout was not modified at pipeline
+        // layout creation and the already instrumented shaders need to be replaced with uninstrumented shaders
         const auto pipeline_layout = pipe->PipelineLayoutState();
-        if (pipeline_layout && pipeline_layout->set_layouts.size() >= adjusted_max_desc_sets) {
+        if (pipeline_layout && PipelineLayoutConflicts(*pipeline_layout)) {
             replace_shaders = true;
         }
 
@@ -856,37 +1224,68 @@ void GpuAssistedBase::PreCallRecordPipelineCreations(uint32_t count, const Creat
             // library created with pre-raster or fragment shader state, it contains shaders that have not yet been instrumented
             if (!pipe->HasFullState() && (pipe->pre_raster_state || pipe->fragment_shader_state)) {
                 for (const auto &stage : pipe->stage_state) {
-                    auto module_state = std::const_pointer_cast<SHADER_MODULE_STATE>(stage.module_state);
-                    if (!module_state->Handle()) {
-                        // If the shader module's handle is non-null, then it was defined with CreateShaderModule and covered by the
-                        // case above. Otherwise, it is being defined during CGPL time
-                        if (cgpl_state.shader_states.size() <= pipeline) {
-                            cgpl_state.shader_states.resize(pipeline + 1);
-                        }
-                        auto &csm_state = cgpl_state.shader_states[pipeline][stage.stage_flag];
-                        const auto pass =
-                            InstrumentShader(module_state->words_, csm_state.instrumented_pgm, &csm_state.unique_shader_id);
-                        if (pass) {
-                            module_state->gpu_validation_shader_id = csm_state.unique_shader_id;
-
-                            // Now we need to find the corresponding VkShaderModuleCreateInfo and update its shader code
-                            auto &stage_ci = GetShaderStageCI<SafeCreateInfo, safe_VkPipelineShaderStageCreateInfo>(
-                                new_pipeline_ci, stage.stage_flag);
-                            // We're modifying the copied, safe create info, which is ok to be non-const
-                            auto sm_ci =
-                                const_cast<safe_VkShaderModuleCreateInfo *>(reinterpret_cast<const safe_VkShaderModuleCreateInfo *>(
-                                    LvlFindInChain<VkShaderModuleCreateInfo>(stage_ci.pNext)));
-                            // module_state->Handle() == VK_NULL_HANDLE should imply sm_ci != nullptr, but checking here anyway
-                            if (sm_ci) {
-                                sm_ci->SetCode(csm_state.instrumented_pgm);
-                            }
-                        }
+                    // If the shader module's handle is non-null, then it was defined with CreateShaderModule and covered by the
+                    // case above. Otherwise, it is being defined during CGPL time
+                    if (!stage.module_state->Handle()) {
+                        auto module_state = std::const_pointer_cast<SHADER_MODULE_STATE>(stage.module_state);
+                        instrumentation_jobs.emplace_back(
+                            PipelineInstrumentationJob{pipeline, stage.stage_flag, module_state.get(), nullptr});
                     }
                 }
             }
         }
         new_pipeline_create_infos->push_back(std::move(new_pipeline_ci));
     }
+    if (instrumentation_jobs.empty()) {
+        return;
+    }
+
+    // Shader IDs are handed out in pipeline and stage order, so that they do not depend on how the work is scheduled
+    for (auto &job : instrumentation_jobs) {
+        if (cgpl_state.shader_states.size() <= job.pipeline) {
+            cgpl_state.shader_states.resize(job.pipeline + 1);
+        }
+        job.csm_state = &cgpl_state.shader_states[job.pipeline][job.stage_flag];
+        job.csm_state->unique_shader_id = unique_shader_module_id++;
+    }
+
+    // Instrumenting a stage only reads its own SPIR-V, so the stages of the whole batch are instrumented in parallel. Messages
+    // are captured per stage and reported afterwards in stage order, as they would be by serial instrumentation.
+    std::vector<uint8_t> passed(instrumentation_jobs.size(), 0);
+    std::vector<LogMessageCapture> captures(instrumentation_jobs.size());
+    const auto instrument = [&](size_t i) {
+        LogMessageCapture::Scope scope(captures[i]);
+        const auto &job = instrumentation_jobs[i];
+        passed[i] = InstrumentShader(job.module_state->words_, job.csm_state->instrumented_pgm, job.csm_state->unique_shader_id);
+    };
+    auto *pool = GetWorkerPool();
+    if (pool) {
+        pool->ParallelFor(instrumentation_jobs.size(), instrument);
+    } else {
+        for (size_t i = 0; i < instrumentation_jobs.size(); ++i) {
+            instrument(i);
+        }
+    }
+
+    for (size_t i = 0; i < instrumentation_jobs.size(); ++i) {
+        captures[i].Report(report_data);
+        if (!passed[i]) {
+            continue;
+        }
+        const auto &job = instrumentation_jobs[i];
+        job.module_state->gpu_validation_shader_id = job.csm_state->unique_shader_id;
+
+        // Now we need to find the corresponding VkShaderModuleCreateInfo and update its shader code
+        auto &stage_ci = GetShaderStageCI<SafeCreateInfo, safe_VkPipelineShaderStageCreateInfo>(
+            (*new_pipeline_create_infos)[first_new_ci + job.pipeline], job.stage_flag);
+        // We're modifying the copied, safe create info, which is ok to be non-const
+        auto sm_ci = const_cast<safe_VkShaderModuleCreateInfo *>(
+            reinterpret_cast<const safe_VkShaderModuleCreateInfo *>(LvlFindInChain<VkShaderModuleCreateInfo>(stage_ci.pNext)));
+        // module_state->Handle() == VK_NULL_HANDLE should imply sm_ci != nullptr, but checking here anyway
+        if (sm_ci) {
+            sm_ci->SetCode(job.csm_state->instrumented_pgm);
+        }
+    }
 }
 // For every pipeline:
 // - For every shader in a pipeline:
@@ -914,7 +1313,7 @@ void GpuAssistedBase::PostCallRecordPipelineCreations(const uint32_t count, cons
                 const auto shader_module = module_state->Handle();
 
                 if (pipeline_state->active_slots.find(desc_set_bind_index) != pipeline_state->active_slots.end() ||
-                    (pipeline_layout->set_layouts.size() >= adjusted_max_desc_sets)) {
+                    PipelineLayoutConflicts(*pipeline_layout)) {
                     auto *modified_ci = reinterpret_cast<const CreateInfo *>(modified_create_infos[pipeline].ptr());
                     auto uninstrumented_module = GetShaderModule(*modified_ci, stage.stage_flag);
                     assert(uninstrumented_module != shader_module.Cast<VkShaderModule>());
@@ -929,7 +1328,8 @@ void GpuAssistedBase::PostCallRecordPipelineCreations(const uint32_t count, cons
                 if (module_state && module_state->has_valid_spirv) code = module_state->words_;
 
                 shader_map.insert_or_assign(module_state->gpu_validation_shader_id, pipeline_state->pipeline(),
-                                            shader_module.Cast<VkShaderModule>(), std::move(code));
+                                            shader_module.Cast<VkShaderModule>(),
+                                            std::make_shared<UtilShaderDebugInfo>(std::move(code)));
             }
         }
     }
@@ -1049,25 +1449,67 @@ void UtilGenerateCommonMessage(const debug_report_data *report_data, const VkCom
     msg = strm.str();
 }
 
+UtilShaderDebugInfo::UtilShaderDebugInfo(std::vector<uint32_t> &&pgm) : pgm_(std::move(pgm)) {
+    // Instruction indices count from the first instruction after the header, as in the instrumentation passes
+    uint32_t instruction_index = 0;
+    for (size_t offset = 5; offset < pgm_.size(); ++instruction_index) {
+        const uint32_t len = pgm_[offset] >> 16;
+        if (len == 0 || offset + len > pgm_.size()) break;
+        switch (pgm_[offset] & 0xffff) {
+            case spv::OpLine:
+                if (len >= 4) lines_.emplace_back(LinePosition{instruction_index, static_cast<uint32_t>(offset)});
+                break;
+            case spv::OpString:
+                if (len >= 3) strings_.emplace(pgm_[offset + 1], static_cast<uint32_t>(offset));
+                break;
+            case spv::OpSource:
+                if (len >= 5) sources_.emplace(pgm_[offset + 3], static_cast<uint32_t>(offset));
+                break;
+            default:
+                break;
+        }
+        offset += len;
+    }
+}
+
+uint32_t UtilShaderDebugInfo::FindLine(uint32_t instruction_index) const {
+    auto it = std::upper_bound(lines_.begin(), lines_.end(), instruction_index,
+                               [](uint32_t index, const LinePosition &line) { return index < line.instruction_index; });
+    return (it == lines_.begin()) ? 0 : std::prev(it)->offset;
+}
+
+uint32_t UtilShaderDebugInfo::FindString(uint32_t string_id) const {
+    auto it = strings_.find(string_id);
+    return (it == strings_.end()) ? 0 : it->second;
+}
+
+uint32_t UtilShaderDebugInfo::FindSource(uint32_t file_id) const {
+    auto it = sources_.find(file_id);
+    return (it == sources_.end()) ? 0 : it->second;
+}
+
 // Read the contents of the SPIR-V OpSource instruction and any following continuation instructions.
 // Split the single string into a vector of strings, one for each line, for easier processing.
-void ReadOpSource(const SHADER_MODULE_STATE &module_state, const uint32_t reported_file_id,
+void ReadOpSource(const UtilShaderDebugInfo &debug_info, const uint32_t reported_file_id,
                   std::vector<std::string> &opsource_lines) {
-    for (auto insn : module_state) {
-        if ((insn.opcode() == spv::OpSource) && (insn.len() >= 5) && (insn.word(3) == reported_file_id)) {
-            std::istringstream in_stream;
-            std::string cur_line;
-            in_stream.str((char *)&insn.word(4));
-            while (std::getline(in_stream, cur_line)) {
-                opsource_lines.push_back(cur_line);
-            }
-            while ((++insn).opcode() == spv::OpSourceContinued) {
-                in_stream.str((char *)&insn.word(1));
-                while (std::getline(in_stream, cur_line)) {
-                    opsource_lines.push_back(cur_line);
-                }
-            }
-            break;
+    const uint32_t source_offset = debug_info.FindSource(reported_file_id);
+    if (source_offset == 0) {
+        return;
+    }
+    const auto &pgm = debug_info.Pgm();
+    std::istringstream in_stream;
+    std::string cur_line;
+    in_stream.str(reinterpret_cast<const char *>(&pgm[source_offset + 4]));
+    while (std::getline(in_stream, cur_line)) {
+        opsource_lines.push_back(cur_line);
+    }
+    for (size_t offset = source_offset + (pgm[source_offset] >> 16); offset < pgm.size() && (pgm[offset] >> 16) != 0;
+         offset += pgm[offset] >> 16) {
+        if ((pgm[offset] & 0xffff) != spv::OpSourceContinued) break;
+        in_stream.clear();
+        in_stream.str(reinterpret_cast<const char *>(&pgm[offset + 1]));
+        while (std::getline(in_stream, cur_line)) {
+            opsource_lines.push_back(cur_line);
         }
     }
 }
@@ -1149,30 +1591,21 @@ bool GetLineAndFilename(const std::string &string, uint32_t *linenumber, std::st
 
 // Extract the filename, line number, and column number from the correct OpLine and build a message string from it.
 // Scan the source (from OpSource) to find the line of source at the reported line number and place it in another message string.
-void UtilGenerateSourceMessages(const std::vector<uint32_t> &pgm, const uint32_t *debug_record, bool from_printf,
+void UtilGenerateSourceMessages(const UtilShaderDebugInfo *debug_info, const uint32_t *debug_record, bool from_printf,
                                 std::string &filename_msg, std::string &source_msg) {
     using namespace spvtools;
     std::ostringstream filename_stream;
     std::ostringstream source_stream;
-    SHADER_MODULE_STATE module_state(pgm);
     // Find the OpLine just before the failing instruction indicated by the debug info.
-    // SPIR-V can only be iterated in the forward direction due to its opcode/length encoding.
-    uint32_t instruction_index = 0;
     uint32_t reported_file_id = 0;
     uint32_t reported_line_number = 0;
     uint32_t reported_column_number = 0;
-    if (module_state.words_.size() > 0) {
-        for (const auto &insn : module_state) {
-            if (insn.opcode() == spv::OpLine) {
-                reported_file_id = insn.word(1);
-                reported_line_number = insn.word(2);
-                reported_column_number = insn.word(3);
-            }
-            if (instruction_index == debug_record[kInstCommonOutInstructionIdx]) {
-                break;
-            }
-            instruction_index++;
-        }
+    const uint32_t line_offset = debug_info ? debug_info->FindLine(debug_record[kInstCommonOutInstructionIdx]) : 0;
+    if (line_offset != 0) {
+        const auto &pgm = debug_info->Pgm();
+        reported_file_id = pgm[line_offset + 1];
+        reported_line_number = pgm[line_offset + 2];
+        reported_column_number = pgm[line_offset + 3];
     }
     // Create message with file information obtained from the OpString pointed to by the discovered OpLine.
     std::string reported_filename;
@@ -1187,21 +1620,19 @@ void UtilGenerateSourceMessages(const std::vector<uint32_t> &pgm, const uint32_t
         } else {
             prefix = "Shader validation error occurred ";
         }
-        for (const auto &insn : module_state) {
-            if ((insn.opcode() == spv::OpString) && (insn.len() >= 3) && (insn.word(1) == reported_file_id)) {
-                found_opstring = true;
-                reported_filename = (char *)&insn.word(2);
-                if (reported_filename.empty()) {
-                    filename_stream << prefix << "at line " << reported_line_number;
-                } else {
-                    filename_stream << prefix << "in file " << reported_filename << " at line " << reported_line_number;
-                }
-                if (reported_column_number > 0) {
-                    filename_stream << ", column " << reported_column_number;
-                }
-                filename_stream << ".";
-                break;
+        const uint32_t string_offset = debug_info->FindString(reported_file_id);
+        if (string_offset != 0) {
+            found_opstring = true;
+            reported_filename = reinterpret_cast<const char *>(&debug_info->Pgm()[string_offset + 2]);
+            if (reported_filename.empty()) {
+                filename_stream << prefix << "at line " << reported_line_number;
+            } else {
+                filename_stream << prefix << "in file " << reported_filename << " at line " << reported_line_number;
+            }
+            if (reported_column_number > 0) {
+                filename_stream << ", column " << reported_column_number;
             }
+            filename_stream << ".";
         }
         if (!found_opstring) {
             filename_stream << "Unable to find SPIR-V OpString for file id " << reported_file_id << " from OpLine instruction."
@@ -1216,7 +1647,7 @@ void UtilGenerateSourceMessages(const std::vector<uint32_t> &pgm, const uint32_t
     if ((reported_file_id != 0)) {
         // Read the source code and split it up into separate lines.
         std::vector<std::string> opsource_lines;
-        ReadOpSource(module_state, reported_file_id, opsource_lines);
+        ReadOpSource(*debug_info, reported_file_id, opsource_lines);
         // Find the line in the OpSource content that corresponds to the reported error file and line.
         if (!opsource_lines.empty()) {
             uint32_t saved_line_number = 0;
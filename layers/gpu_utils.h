@@ -33,7 +33,9 @@ static const VkShaderStageFlags kShaderStageAllRayTracing =
 
 class UtilDescriptorSetManager {
   public:
-    UtilDescriptorSetManager(VkDevice device, uint32_t num_bindings_in_set);
+    // Pools are sized for sets of the given bindings, so any other layout allocated from them must not use more descriptors
+    // of any type than those bindings do.
+    UtilDescriptorSetManager(VkDevice device, const std::vector<VkDescriptorSetLayoutBinding> &bindings);
     ~UtilDescriptorSetManager();
 
     VkResult GetDescriptorSet(VkDescriptorPool *desc_pool, VkDescriptorSetLayout ds_layout, VkDescriptorSet *desc_sets);
@@ -50,22 +52,104 @@ class UtilDescriptorSetManager {
         uint32_t used;
     };
     VkDevice device;
-    uint32_t num_bindings_in_set;
+    // Descriptor count of each type in a single set
+    std::vector<VkDescriptorPoolSize> set_sizes_;
     layer_data::unordered_map<VkDescriptorPool, struct PoolTracker> desc_pool_map_;
     mutable std::mutex lock_;
 };
 
+// Instrumented SPIR-V, kept on disk across runs so that shaders are only instrumented once per set of instrumentation
+// options and SPIRV-Tools version. Entries are keyed by a hash of the original SPIR-V and of the options, which must include
+// everything the instrumentation depends on, such as the descriptor set bind index, and checked against a second hash with
+// another seed before use. As the shader ID is baked into the instrumented code, shaders are instrumented with a placeholder
+// ID and the words holding it are patched for each use.
+class UtilInstrumentationCache {
+  public:
+    static constexpr uint32_t kPlaceholderShaderId = 0x7a3b9c15;
+
+    // Read the entries of the file at path, which is also where Save() writes them
+    void Load(const std::string &path);
+    void Save();
+    bool Enabled() const { return !path_.empty(); }
+
+    // False if the SPIR-V has a constant that could be mistaken for the placeholder shader ID
+    static bool CanCache(const layer_data::span<const uint32_t> &input);
+    // Copy the cached instrumentation of input to new_pgm with shader_id as shader ID. Returns false on a cache miss.
+    bool Find(const layer_data::span<const uint32_t> &input, uint64_t options, uint32_t shader_id,
+              std::vector<uint32_t> &new_pgm);
+    // Store new_pgm, instrumented with kPlaceholderShaderId, and patch new_pgm to use shader_id instead
+    void Insert(const layer_data::span<const uint32_t> &input, uint64_t options, std::vector<uint32_t> &new_pgm,
+                uint32_t shader_id);
+
+  private:
+    // Upper bound of the size of the cache file, entries used by this process are written first
+    static constexpr size_t kMaxFileWords = 64 * 1024 * 1024 / sizeof(uint32_t);
+
+    struct Entry {
+        uint64_t check;  // second hash of the input, so that a collision of the key alone is not taken for a hit
+        uint64_t options;
+        uint32_t input_size;
+        bool used;
+        std::vector<uint32_t> patches;
+        std::vector<uint32_t> pgm;
+    };
+
+    static uint64_t Hash(const layer_data::span<const uint32_t> &input, uint64_t options);
+    static uint64_t CheckHash(const layer_data::span<const uint32_t> &input, uint64_t options);
+
+    std::mutex lock_;
+    std::string path_;
+    bool dirty_ = false;
+    layer_data::unordered_map<uint64_t, Entry> entries_;
+};
+
 namespace gpu_utils_state {
+class CommandBuffer;
+
 class Queue : public QUEUE_STATE {
   public:
     Queue(GpuAssistedBase &state, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags, const VkQueueFamilyProperties &queueFamilyProperties);
     virtual ~Queue();
-    void SubmitBarrier();
+    void Destroy() override;
+
+    // Command buffers of the submission with sequence number seq that need their output read back
+    struct Submission {
+        uint64_t seq;
+        std::vector<std::shared_ptr<CommandBuffer>> command_buffers;
+    };
+
+    // Submit a barrier making the output of a batch of submissions available to the host. The command buffers of each
+    // submission are processed on the queue thread once that submission retires, instead of waiting for the queue to go idle.
+    void SubmitBarrier(std::vector<Submission> &&submissions);
+
+  protected:
+    void Retire(CB_SUBMISSION &submission) override;
 
   private:
+    // The submissions of a batch share the fence of the barrier following the batch, the last one recycles it
+    struct PendingReadback {
+        uint64_t seq;
+        VkFence fence;
+        bool last_in_batch;
+        std::vector<std::shared_ptr<CommandBuffer>> command_buffers;
+    };
+
+    bool InitBarrierCommandBuffer();
+    VkFence GetBarrierFence();
+    void ProcessReadbacks(uint64_t until_seq);
+
     GpuAssistedBase &state_;
     VkCommandPool barrier_command_pool_{VK_NULL_HANDLE};
     VkCommandBuffer barrier_command_buffer_{VK_NULL_HANDLE};
+
+    // Submissions waiting to be read back, in submission order, the unused barrier fences and the sequence number of the
+    // most recently retired submission. Accessed by both the submitting thread and the queue thread, with readback_lock_ held.
+    std::mutex readback_lock_;
+    std::deque<PendingReadback> pending_readbacks_;
+    std::vector<VkFence> free_fences_;
+    uint64_t retired_seq_{0};
+    // Held while reading back, so that the submitting thread and the queue thread report messages in submission order
+    std::mutex process_lock_;
 };
 
 class CommandBuffer : public CMD_BUFFER_STATE {
@@ -87,13 +171,41 @@ void UtilGenerateCommonMessage(const debug_report_data *report_data, const VkCom
                                const uint32_t *debug_record, const VkShaderModule shader_module_handle,
                                const VkPipeline pipeline_handle, const VkPipelineBindPoint pipeline_bind_point,
                                const uint32_t operation_index, std::string &msg);
-void UtilGenerateSourceMessages(const std::vector<uint32_t> &pgm, const uint32_t *debug_record, bool from_printf,
+
+// SPIR-V of a tracked shader along with the positions of its debug instructions, indexed once when the shader is tracked so
+// that reporting an error record does not walk the whole program.
+class UtilShaderDebugInfo {
+  public:
+    explicit UtilShaderDebugInfo(std::vector<uint32_t> &&pgm);
+
+    const std::vector<uint32_t> &Pgm() const { return pgm_; }
+    // Word offset of the last OpLine at or before the instruction with the given index, or 0 if there is none
+    uint32_t FindLine(uint32_t instruction_index) const;
+    // Word offset of the first OpString or OpSource for the given id, or 0 if there is none
+    uint32_t FindString(uint32_t string_id) const;
+    uint32_t FindSource(uint32_t file_id) const;
+
+  private:
+    struct LinePosition {
+        uint32_t instruction_index;
+        uint32_t offset;
+    };
+
+    std::vector<uint32_t> pgm_;
+    // Sorted by instruction index
+    std::vector<LinePosition> lines_;
+    layer_data::unordered_map<uint32_t, uint32_t> strings_;
+    layer_data::unordered_map<uint32_t, uint32_t> sources_;
+};
+
+void UtilGenerateSourceMessages(const UtilShaderDebugInfo *debug_info, const uint32_t *debug_record, bool from_printf,
                                 std::string &filename_msg, std::string &source_msg);
 
 struct GpuAssistedShaderTracker {
     VkPipeline pipeline;
     VkShaderModule shader_module;
-    std::vector<uint32_t> pgm;
+    // Shared, since shader_map lookups return a copy of the tracker
+    std::shared_ptr<const UtilShaderDebugInfo> debug_info;
 };
 
 class GpuAssistedBase : public ValidationStateTracker {
@@ -186,14 +298,8 @@ class GpuAssistedBase : public ValidationStateTracker {
 
   protected:
     bool CommandBufferNeedsProcessing(VkCommandBuffer command_buffer) const;
-    void ProcessCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer);
 
-    void SubmitBarrier(VkQueue queue) {
-        auto queue_state = Get<gpu_utils_state::Queue>(queue);
-        if (queue_state) {
-            queue_state->SubmitBarrier();
-        }
-    }
+    void DrainReadbacks();
 
     std::shared_ptr<QUEUE_STATE> CreateQueue(VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags, const VkQueueFamilyProperties &queueFamilyProperties) override {
         return std::static_pointer_cast<QUEUE_STATE>(std::make_shared<gpu_utils_state::Queue>(*this, q, index, flags, queueFamilyProperties));
@@ -210,23 +316,30 @@ class GpuAssistedBase : public ValidationStateTracker {
                                          const VkPipelineBindPoint bind_point, const SafeCreateInfo &modified_create_infos);
 
     virtual bool InstrumentShader(const layer_data::span<const uint32_t> &input, std::vector<uint32_t> &new_pgm,
-                                  uint32_t *unique_shader_id) = 0;
+                                  uint32_t unique_shader_id) = 0;
+    // True if the validation descriptor set was not added to a pipeline layout, whose pipelines then use uninstrumented shaders
+    bool PipelineLayoutConflicts(const PIPELINE_LAYOUT_STATE &pipeline_layout) const;
+    bool TooManyStorageBuffersDynamic(const PIPELINE_LAYOUT_STATE::SetLayoutVector &set_layouts) const;
 
   public:
-    bool aborted = false;
+    // Read by the worker pool threads instrumenting the shaders of a pipeline batch, and set from any thread
+    std::atomic<bool> aborted{false};
     PFN_vkSetDeviceLoaderData vkSetDeviceLoaderData;
     const char *setup_vuid;
     VkPhysicalDeviceFeatures supported_features{};
     VkPhysicalDeviceFeatures desired_features{};
     uint32_t adjusted_max_desc_sets = 0;
-    uint32_t unique_shader_module_id = 0;
+    std::atomic<uint32_t> unique_shader_module_id{0};
     uint32_t output_buffer_size = 0;
     VkDescriptorSetLayout debug_desc_layout = VK_NULL_HANDLE;
     VkDescriptorSetLayout dummy_desc_layout = VK_NULL_HANDLE;
     uint32_t desc_set_bind_index = 0;
+    // Dynamic storage buffers in debug_desc_layout
+    uint32_t debug_desc_storage_buffers_dynamic = 0;
     VmaAllocator vmaAllocator = {};
     VmaPool output_buffer_pool = VK_NULL_HANDLE;
     std::unique_ptr<UtilDescriptorSetManager> desc_set_manager;
+    UtilInstrumentationCache instrumentation_cache;
     vl_concurrent_unordered_map<uint32_t, GpuAssistedShaderTracker> shader_map;
     std::vector<VkDescriptorSetLayoutBinding> bindings_;
 };
@@ -93,12 +93,15 @@ void GpuAssisted::PreCallRecordCreateBuffer(VkDevice device, const VkBufferCreat
 // Perform initializations that can be done at Create Device time.
 void GpuAssisted::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     // GpuAssistedBase::CreateDevice will set up bindings
-    VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1,
+    // The output buffer is dynamic, so that the draws of a command buffer can share a descriptor set and only differ in the
+    // offset of their output record.
+    VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1,
                                             VK_SHADER_STAGE_ALL_GRAPHICS | VK_SHADER_STAGE_COMPUTE_BIT |
                                                 VK_SHADER_STAGE_MESH_BIT_NV | VK_SHADER_STAGE_TASK_BIT_NV |
                                                 kShaderStageAllRayTracing,
                                             NULL};
     bindings_.push_back(binding);
+    binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
     for (auto i = 1; i < 3; i++) {
         binding.binding = i;
         bindings_.push_back(binding);
@@ -142,6 +145,9 @@ void GpuAssisted::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     if (validate_descriptor_indexing) {
         descriptor_indexing = CheckForDescriptorIndexing(enabled_features);
     }
+    if (GpuGetOption("khronos_validation.instrumented_shader_cache", true)) {
+        instrumentation_cache.Load(GetLayerCacheFilePath("gpuav_shader_cache"));
+    }
     bool use_linear_output_pool = GpuGetOption("khronos_validation.vma_linear_output", true);
     if (use_linear_output_pool) {
         auto output_buffer_create_info = LvlInitStruct<VkBufferCreateInfo>();
@@ -211,6 +217,7 @@ void GpuAssisted::PreCallRecordDestroyDevice(VkDevice device, const VkAllocation
     acceleration_structure_validation_state.Destroy(device, vmaAllocator);
     pre_draw_validation_state.Destroy(device);
     pre_dispatch_validation_state.Destroy(device);
+    bda_table_.reset();
     GpuAssistedBase::PreCallRecordDestroyDevice(device, pAllocator);
 }
 
@@ -589,7 +596,7 @@ struct GPUAV_RESTORABLE_PIPELINE_STATE {
             }
             const auto &pipeline_layout = last_bound.pipeline_state->PipelineLayoutState();
             if (pipeline_layout->push_constant_ranges == cb_state->push_constant_data_ranges) {
-                push_constants_data = cb_state->push_constant_data;
+                push_constants_data.assign(cb_state->push_constant_data.begin(), cb_state->push_constant_data.end());
                 push_constants_ranges = pipeline_layout->push_constant_ranges;
             }
         }
@@ -744,7 +751,7 @@ void GpuAssisted::PreCallRecordCmdBuildAccelerationStructureNV(VkCommandBuffer c
     descriptor_set_writes[0].dstSet = as_validation_buffer_info.descriptor_set;
     descriptor_set_writes[0].dstBinding = 0;
     descriptor_set_writes[0].descriptorCount = 1;
-    descriptor_set_writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    descriptor_set_writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
     descriptor_set_writes[0].pBufferInfo = &descriptor_buffer_infos[0];
     descriptor_set_writes[1].dstSet = as_validation_buffer_info.descriptor_set;
     descriptor_set_writes[1].dstBinding = 1;
@@ -767,8 +774,9 @@ void GpuAssisted::PreCallRecordCmdBuildAccelerationStructureNV(VkCommandBuffer c
 
     // Switch to and launch the validation compute shader to find, replace, and report invalid acceleration structure handles.
     DispatchCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, as_validation_state.pipeline);
+    const uint32_t instance_dynamic_offset = 0;
     DispatchCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, as_validation_state.pipeline_layout, 0, 1,
-                                  &as_validation_buffer_info.descriptor_set, 0, nullptr);
+                                  &as_validation_buffer_info.descriptor_set, 1, &instance_dynamic_offset);
     DispatchCmdDispatch(commandBuffer, 1, 1, 1);
 
     // Issue a buffer memory barrier to make sure that any invalid bottom level acceleration structure handles
@@ -834,13 +842,7 @@ void GpuAssisted::PostCallRecordBindAccelerationStructureMemoryNV(VkDevice devic
 
 // Free the device memory and descriptor set(s) associated with a command buffer.
 void GpuAssisted::DestroyBuffer(GpuAssistedBufferInfo &buffer_info) {
-    vmaDestroyBuffer(vmaAllocator, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
-    if (buffer_info.bda_input_mem_block.buffer) {
-        vmaDestroyBuffer(vmaAllocator, buffer_info.bda_input_mem_block.buffer, buffer_info.bda_input_mem_block.allocation);
-    }
-    if (buffer_info.desc_set != VK_NULL_HANDLE) {
-        desc_set_manager->PutBackDescriptorSet(buffer_info.desc_pool, buffer_info.desc_set);
-    }
+    buffer_info.bda_table.reset();
     if (buffer_info.pre_draw_resources.desc_set != VK_NULL_HANDLE) {
         desc_set_manager->PutBackDescriptorSet(buffer_info.pre_draw_resources.desc_pool, buffer_info.pre_draw_resources.desc_set);
     }
@@ -858,6 +860,14 @@ void GpuAssisted::DestroyBuffer(GpuAssistedAccelerationStructureBuildValidationB
     }
 }
 
+// The output binding of the descriptor set appended to every pipeline layout is a dynamic storage buffer, so take it out of
+// the per pipeline layout limits the application sees
+static void ReserveStorageBufferDynamic(uint32_t &limit) {
+    if (limit > 0) {
+        limit -= 1;
+    }
+}
+
 void GpuAssisted::PostCallRecordGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice,
                                                             VkPhysicalDeviceProperties *pPhysicalDeviceProperties) {
     // There is an implicit layer that can cause this call to return 0 for maxBoundDescriptorSets - Ignore such calls
@@ -869,6 +879,7 @@ void GpuAssisted::PostCallRecordGetPhysicalDeviceProperties(VkPhysicalDevice phy
                        "Unable to reserve descriptor binding slot on a device with only one slot.");
         }
     }
+    ReserveStorageBufferDynamic(pPhysicalDeviceProperties->limits.maxDescriptorSetStorageBuffersDynamic);
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceProperties(physicalDevice, pPhysicalDeviceProperties);
 }
 
@@ -883,6 +894,16 @@ void GpuAssisted::PostCallRecordGetPhysicalDeviceProperties2(VkPhysicalDevice ph
                        "Unable to reserve descriptor binding slot on a device with only one slot.");
         }
     }
+    ReserveStorageBufferDynamic(pPhysicalDeviceProperties2->properties.limits.maxDescriptorSetStorageBuffersDynamic);
+    // The update after bind limits count the descriptors of all sets in the layout, update after bind or not
+    auto *indexing_props = LvlFindModInChain<VkPhysicalDeviceDescriptorIndexingProperties>(pPhysicalDeviceProperties2->pNext);
+    if (indexing_props) {
+        ReserveStorageBufferDynamic(indexing_props->maxDescriptorSetUpdateAfterBindStorageBuffersDynamic);
+    }
+    auto *vk12_props = LvlFindModInChain<VkPhysicalDeviceVulkan12Properties>(pPhysicalDeviceProperties2->pNext);
+    if (vk12_props) {
+        ReserveStorageBufferDynamic(vk12_props->maxDescriptorSetUpdateAfterBindStorageBuffersDynamic);
+    }
     ValidationStateTracker::PostCallRecordGetPhysicalDeviceProperties2(physicalDevice, pPhysicalDeviceProperties2);
 }
 
@@ -897,7 +918,7 @@ void GpuAssisted::PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass r
 
 // Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
 bool GpuAssisted::InstrumentShader(const layer_data::span<const uint32_t> &input, std::vector<uint32_t> &new_pgm,
-                                   uint32_t *unique_shader_id) {
+                                   uint32_t unique_shader_id) {
     if (aborted) return false;
     if (input[0] != spv::MagicNumber) return false;
 
@@ -915,16 +936,30 @@ bool GpuAssisted::InstrumentShader(const layer_data::span<const uint32_t> &input
         }
     };
 
+    using namespace spvtools;
+    spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+    const bool buffer_address_check = (IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
+                                       IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
+                                      shaderInt64 && enabled_features.core12.bufferDeviceAddress;
+
+    // Everything but the shader ID that the instrumented code depends on
+    const uint64_t cache_options = (static_cast<uint64_t>(desc_set_bind_index) << 32) | (static_cast<uint64_t>(target_env) << 8) |
+                                   (descriptor_indexing ? 1 : 0) | (buffer_oob_enabled ? 2 : 0) | (buffer_address_check ? 4 : 0);
+    const bool use_cache = instrumentation_cache.Enabled() && UtilInstrumentationCache::CanCache(input);
+    if (use_cache && instrumentation_cache.Find(input, cache_options, unique_shader_id, new_pgm)) {
+        return true;
+    }
+
     // Load original shader SPIR-V
     new_pgm.clear();
     new_pgm.reserve(input.size());
     new_pgm.insert(new_pgm.end(), &input.front(), &input.back() + 1);
 
     // Call the optimizer to instrument the shader.
-    // Use the unique_shader_module_id as a shader ID so we can look up its handle later in the shader_map.
+    // Use the unique_shader_id as a shader ID so we can look up its handle later in the shader_map. Cached shaders use a
+    // placeholder instead, which is patched to the unique_shader_id.
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
-    using namespace spvtools;
-    spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+    const uint32_t shader_id = use_cache ? UtilInstrumentationCache::kPlaceholderShaderId : unique_shader_id;
     spvtools::ValidatorOptions val_options;
     AdjustValidatorOptions(device_extensions, enabled_features, val_options);
     spvtools::OptimizerOptions opt_options;
@@ -932,20 +967,19 @@ bool GpuAssisted::InstrumentShader(const layer_data::span<const uint32_t> &input
     opt_options.set_validator_options(val_options);
     Optimizer optimizer(target_env);
     optimizer.SetMessageConsumer(gpu_console_message_consumer);
-    optimizer.RegisterPass(CreateInstBindlessCheckPass(desc_set_bind_index, unique_shader_module_id, descriptor_indexing,
-                                                       descriptor_indexing, buffer_oob_enabled, buffer_oob_enabled));
+    optimizer.RegisterPass(CreateInstBindlessCheckPass(desc_set_bind_index, shader_id, descriptor_indexing, descriptor_indexing,
+                                                       buffer_oob_enabled, buffer_oob_enabled));
     // Call CreateAggressiveDCEPass with preserve_interface == true
     optimizer.RegisterPass(CreateAggressiveDCEPass(true));
-    if ((IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
-         IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
-        shaderInt64 && enabled_features.core12.bufferDeviceAddress) {
-        optimizer.RegisterPass(CreateInstBuffAddrCheckPass(desc_set_bind_index, unique_shader_module_id));
+    if (buffer_address_check) {
+        optimizer.RegisterPass(CreateInstBuffAddrCheckPass(desc_set_bind_index, shader_id));
     }
     bool pass = optimizer.Run(new_pgm.data(), new_pgm.size(), &new_pgm, opt_options);
     if (!pass) {
         ReportSetupProblem(device, "Failure to instrument shader.  Proceeding with non-instrumented shader.");
+    } else if (use_cache) {
+        instrumentation_cache.Insert(input, cache_options, new_pgm, unique_shader_id);
     }
-    *unique_shader_id = unique_shader_module_id++;
     return pass;
 }
 // Create the instrumented shader data to provide to the driver.
@@ -953,8 +987,9 @@ void GpuAssisted::PreCallRecordCreateShaderModule(VkDevice device, const VkShade
                                                   const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                   void *csm_state_data) {
     create_shader_module_api_state *csm_state = reinterpret_cast<create_shader_module_api_state *>(csm_state_data);
+    csm_state->unique_shader_id = unique_shader_module_id++;
     bool pass = InstrumentShader(layer_data::make_span(pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t)),
-                                 csm_state->instrumented_pgm, &csm_state->unique_shader_id);
+                                 csm_state->instrumented_pgm, csm_state->unique_shader_id);
     if (pass) {
         csm_state->instrumented_create_info.pCode = csm_state->instrumented_pgm.data();
         csm_state->instrumented_create_info.codeSize = csm_state->instrumented_pgm.size() * sizeof(uint32_t);
@@ -1122,7 +1157,7 @@ void GpuAssisted::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQ
     std::string vuid_msg;
     VkShaderModule shader_module_handle = VK_NULL_HANDLE;
     VkPipeline pipeline_handle = VK_NULL_HANDLE;
-    std::vector<uint32_t> pgm;
+    std::shared_ptr<const UtilShaderDebugInfo> debug_info;
     // The first record starts at this offset after the total_words.
     const uint32_t *debug_record = &debug_output_buffer[kDebugOutputDataOffset];
     // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
@@ -1131,14 +1166,14 @@ void GpuAssisted::AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQ
     if (it != shader_map.end()) {
         shader_module_handle = it->second.shader_module;
         pipeline_handle = it->second.pipeline;
-        pgm = it->second.pgm;
+        debug_info = it->second.debug_info;
     }
     bool gen_full_message = GenerateValidationMessage(debug_record, validation_message, vuid_msg, oob_access, buffer_info, this);
     if (gen_full_message) {
         UtilGenerateStageMessage(debug_record, stage_message);
         UtilGenerateCommonMessage(report_data, command_buffer, debug_record, shader_module_handle, pipeline_handle,
             buffer_info.pipeline_bind_point, operation_index, common_message);
-        UtilGenerateSourceMessages(pgm, debug_record, false, filename_message, source_message);
+        UtilGenerateSourceMessages(debug_info.get(), debug_record, false, filename_message, source_message);
         if (buffer_info.uses_robustness && oob_access) {
             if (warn_on_robust_oob) {
                 LogWarning(queue, vuid_msg.c_str(), "%s %s %s %s%s", validation_message.c_str(), common_message.c_str(),
@@ -1169,8 +1204,6 @@ void gpuav_state::CommandBuffer::Process(VkQueue queue) {
         uint32_t ray_trace_index = 0;
 
         for (auto &buffer_info : gpu_buffer_list) {
-            char *data;
-
             uint32_t operation_index = 0;
             if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
                 operation_index = draw_index;
@@ -1185,11 +1218,8 @@ void gpuav_state::CommandBuffer::Process(VkQueue queue) {
                 assert(false);
             }
 
-            VkResult result = vmaMapMemory(device_state->vmaAllocator, buffer_info.output_mem_block.allocation, (void **)&data);
-            if (result == VK_SUCCESS) {
-                device_state->AnalyzeAndGenerateMessages(commandBuffer(), queue, buffer_info, operation_index, (uint32_t *)data);
-                vmaUnmapMemory(device_state->vmaAllocator, buffer_info.output_mem_block.allocation);
-            }
+            device_state->AnalyzeAndGenerateMessages(commandBuffer(), queue, buffer_info, operation_index,
+                                                     buffer_info.output_mem_block.data);
         }
     }
     ProcessAccelerationStructure(queue);
@@ -1264,19 +1294,11 @@ void GpuAssisted::SetBindingState(uint32_t *data, uint32_t index, const cvdescri
     }
 }
 
-// For the given command buffer, map its debug data buffers and update the status of any update after bind descriptors
+// For the given command buffer, update the status of any update after bind descriptors in its debug data buffers
 void GpuAssisted::UpdateInstrumentationBuffer(gpuav_state::CommandBuffer *cb_node) {
-    uint32_t *data;
     for (const auto &buffer_info : cb_node->di_input_buffer_list) {
-        if (buffer_info.update_at_submit.size() > 0) {
-            VkResult result =
-                vmaMapMemory(vmaAllocator, buffer_info.allocation, reinterpret_cast<void **>(&data));
-            if (result == VK_SUCCESS) {
-                for (const auto &update : buffer_info.update_at_submit) {
-                    SetBindingState(data, update.first, update.second);
-                }
-                vmaUnmapMemory(vmaAllocator, buffer_info.allocation);
-            }
+        for (const auto &update : buffer_info.update_at_submit) {
+            SetBindingState(buffer_info.data, update.first, update.second);
         }
     }
 }
@@ -1350,27 +1372,23 @@ void GpuAssisted::PostCallRecordCmdBindDescriptorSets(VkCommandBuffer commandBuf
             } else {
                 words_needed = 1 + number_of_sets + binding_count + descriptor_count;
             }
-            VkBufferCreateInfo buffer_info = LvlInitStruct<VkBufferCreateInfo>();
-            buffer_info.size = words_needed * 4;
-            buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-            VmaAllocationCreateInfo alloc_info = {};
-            alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-            alloc_info.pool = VK_NULL_HANDLE;
             GpuAssistedDeviceMemoryBlock di_input_block = {};
-            VkResult result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &di_input_block.buffer, &di_input_block.allocation,
-                                     nullptr);
+            VkResult result = cb_node->slab.Allocate(vmaAllocator, output_buffer_pool,
+                                                     phys_dev_props.limits.minStorageBufferOffsetAlignment, words_needed * 4,
+                                                     &di_input_block);
             if (result != VK_SUCCESS) {
                 ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.", true);
                 aborted = true;
                 return;
             }
-            uint32_t *data_ptr;
-            cb_node->current_input_buffer = di_input_block.buffer;
+            uint32_t *data_ptr = di_input_block.data;
+            cb_node->current_input.buffer = di_input_block.buffer;
+            cb_node->current_input.offset = di_input_block.offset;
+            cb_node->current_input.range = di_input_block.size;
             // Populate input buffer first with the sizes of every descriptor in every set, then with whether
             // each element of each descriptor has been written or not.  See gpu_validation.md for a more thourough
             // outline of the input buffer format
-            result = vmaMapMemory(vmaAllocator, di_input_block.allocation, reinterpret_cast<void **>(&data_ptr));
-            memset(data_ptr, 0, static_cast<size_t>(buffer_info.size));
+            memset(data_ptr, 0, static_cast<size_t>(di_input_block.size));
 
             // Descriptor indexing needs the number of descriptors at each binding.
             if (descriptor_indexing) {
@@ -1472,8 +1490,7 @@ void GpuAssisted::PostCallRecordCmdBindDescriptorSets(VkCommandBuffer commandBuf
                     }
                 }
             }
-            vmaUnmapMemory(vmaAllocator, di_input_block.allocation);
-            cb_node->di_input_buffer_list.emplace_back(di_input_block);
+            cb_node->di_input_buffer_list.emplace_back(std::move(di_input_block));
         }
     }
 }
@@ -1830,8 +1847,8 @@ void GpuAssisted::AllocatePreDrawValidationResources(const GpuAssistedDeviceMemo
     VkDescriptorBufferInfo buffer_infos[buffer_count] = {};
     // Error output buffer
     buffer_infos[0].buffer = output_block.buffer;
-    buffer_infos[0].offset = 0;
-    buffer_infos[0].range = VK_WHOLE_SIZE;
+    buffer_infos[0].offset = output_block.offset;
+    buffer_infos[0].range = output_block.size;
     if (indirect_state->count_buffer) {
         // Count buffer
         buffer_infos[1].buffer = indirect_state->count_buffer;
@@ -1929,8 +1946,8 @@ void GpuAssisted::AllocatePreDispatchValidationResources(const GpuAssistedDevice
     VkDescriptorBufferInfo buffer_infos[buffer_count] = {};
     // Error output buffer
     buffer_infos[0].buffer = output_block.buffer;
-    buffer_infos[0].offset = 0;
-    buffer_infos[0].range = VK_WHOLE_SIZE;
+    buffer_infos[0].offset = output_block.offset;
+    buffer_infos[0].range = output_block.size;
     buffer_infos[1].buffer = indirect_state->buffer;
     buffer_infos[1].offset = 0;
     buffer_infos[1].range = VK_WHOLE_SIZE;
@@ -1947,6 +1964,94 @@ void GpuAssisted::AllocatePreDispatchValidationResources(const GpuAssistedDevice
     DispatchUpdateDescriptorSets(device, buffer_count, desc_writes, 0, nullptr);
 }
 
+// Returns the table of buffer device address ranges for the current version of the state tracker's address map, building it
+// only when the map has changed since the last call. A table that is no longer referenced by any command buffer is rewritten
+// in place if it is large enough, otherwise a new one is allocated and the old one is freed with its last command buffer.
+std::shared_ptr<const GpuAssistedBdaTable> GpuAssisted::GetBdaTable() {
+    std::lock_guard<std::mutex> guard(bda_table_lock_);
+    if (bda_table_ && bda_table_->version == BufferAddressMapVersion()) {
+        return bda_table_;
+    }
+
+    uint64_t version = 0;
+    const auto address_ranges = GetBufferAddressRanges(&version);
+    if (address_ranges.empty()) {
+        bda_table_ = std::make_shared<GpuAssistedBdaTable>();
+        bda_table_->version = version;
+        return bda_table_;
+    }
+
+    // Example BDA input buffer assuming 2 buffers using BDA:
+    // Word 0 | Index of start of buffer sizes (in this case 5)
+    // Word 1 | 0x0000000000000000
+    // Word 2 | Device Address of first buffer  (Addresses sorted in ascending order)
+    // Word 3 | Device Address of second buffer
+    // Word 4 | 0xffffffffffffffff
+    // Word 5 | 0 (size of pretend buffer at word 1)
+    // Word 6 | Size in bytes of first buffer
+    // Word 7 | Size in bytes of second buffer
+    // Word 8 | 0 (size of pretend buffer in word 4)
+    const uint32_t num_buffers = static_cast<uint32_t>(address_ranges.size());
+    const uint32_t words_needed = (num_buffers + 3) + (num_buffers + 2);
+    const VkDeviceSize size = words_needed * 8;  // 64 bit words
+
+    std::shared_ptr<GpuAssistedBdaTable> table;
+    if (bda_table_ && bda_table_.use_count() == 1 && bda_table_->capacity >= size) {
+        table = bda_table_;
+    } else {
+        // Leave room for buffers created later, so that a growing application doesn't need a new table for every change
+        const VkDeviceSize capacity = size + size / 2;
+        VkBufferCreateInfo buffer_info = LvlInitStruct<VkBufferCreateInfo>();
+        buffer_info.size = capacity;
+        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        VmaAllocationCreateInfo alloc_info = {};
+        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VmaAllocation allocation = VK_NULL_HANDLE;
+        VkResult result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &buffer, &allocation, nullptr);
+        if (result != VK_SUCCESS) {
+            ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.", true);
+            aborted = true;
+            return nullptr;
+        }
+        VmaAllocator allocator = vmaAllocator;
+        table = std::shared_ptr<GpuAssistedBdaTable>(new GpuAssistedBdaTable, [allocator](GpuAssistedBdaTable *old_table) {
+            vmaDestroyBuffer(allocator, old_table->buffer, old_table->allocation);
+            delete old_table;
+        });
+        table->buffer = buffer;
+        table->allocation = allocation;
+        table->capacity = capacity;
+    }
+
+    uint64_t *bda_data;
+    VkResult result = vmaMapMemory(vmaAllocator, table->allocation, reinterpret_cast<void **>(&bda_data));
+    if (result != VK_SUCCESS) {
+        ReportSetupProblem(device, "Unable to map device memory.  Device could become unstable.", true);
+        aborted = true;
+        return nullptr;
+    }
+    uint32_t address_index = 1;
+    uint32_t size_index = 3 + num_buffers;
+    memset(bda_data, 0, static_cast<size_t>(size));
+    bda_data[0] = size_index;       // Start of buffer sizes
+    bda_data[address_index++] = 0;  // NULL address
+    bda_data[size_index++] = 0;
+
+    for (const auto &range : address_ranges) {
+        bda_data[address_index++] = range.begin;
+        bda_data[size_index++] = range.end - range.begin;
+    }
+    bda_data[address_index] = UINTPTR_MAX;
+    bda_data[size_index] = 0;
+    vmaUnmapMemory(vmaAllocator, table->allocation);
+
+    table->size = size;
+    table->version = version;
+    bda_table_ = std::move(table);
+    return bda_table_;
+}
+
 void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer, const VkPipelineBindPoint bind_point,
                                               CMD_TYPE cmd_type, const GpuAssistedCmdIndirectState *indirect_state) {
     if (bind_point != VK_PIPELINE_BIND_POINT_GRAPHICS && bind_point != VK_PIPELINE_BIND_POINT_COMPUTE &&
@@ -1968,54 +2073,26 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
     const auto *pipeline_state = last_bound.pipeline_state;
     bool uses_robustness = false;
 
-    std::vector<VkDescriptorSet> desc_sets;
-    VkDescriptorPool desc_pool = VK_NULL_HANDLE;
-    result = desc_set_manager->GetDescriptorSets(1, &desc_pool, debug_desc_layout, &desc_sets);
-    assert(result == VK_SUCCESS);
-    if (result != VK_SUCCESS) {
-        ReportSetupProblem(device, "Unable to allocate descriptor sets.  Device could become unstable.");
-        aborted = true;
-        return;
-    }
-
-    VkDescriptorBufferInfo output_desc_buffer_info = {};
-    output_desc_buffer_info.range = output_buffer_size;
-
-    // Allocate memory for the output block that the gpu will use to return any error information
+    // Sub-allocate the output record that the gpu will use to return any error information
     GpuAssistedDeviceMemoryBlock output_block = {};
-    VkBufferCreateInfo buffer_info = LvlInitStruct<VkBufferCreateInfo>();
-    buffer_info.size = output_buffer_size;
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo alloc_info = {};
-    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    alloc_info.pool = output_buffer_pool;
-    result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &output_block.buffer, &output_block.allocation, nullptr);
+    result = cb_node->slab.Allocate(vmaAllocator, output_buffer_pool, phys_dev_props.limits.minStorageBufferOffsetAlignment,
+                                    output_buffer_size, &output_block);
     if (result != VK_SUCCESS) {
         ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.", true);
         aborted = true;
         return;
     }
 
-    uint32_t *data_ptr;
-    result = vmaMapMemory(vmaAllocator, output_block.allocation, reinterpret_cast<void **>(&data_ptr));
-    if (result == VK_SUCCESS) {
-        memset(data_ptr, 0, output_buffer_size);
-        if (buffer_oob_enabled || buffer_device_address) {
-            uses_robustness =
-                (enabled_features.core.robustBufferAccess || enabled_features.robustness2_features.robustBufferAccess2 ||
-                 pipeline_state->uses_pipeline_robustness);
-            data_ptr[spvtools::kDebugOutputFlagsOffset] = spvtools::kInstBufferOOBEnable;;
-        }
-        vmaUnmapMemory(vmaAllocator, output_block.allocation);
+    uint32_t *data_ptr = output_block.data;
+    memset(data_ptr, 0, output_buffer_size);
+    if (buffer_oob_enabled || buffer_device_address) {
+        uses_robustness = (enabled_features.core.robustBufferAccess || enabled_features.robustness2_features.robustBufferAccess2 ||
+                           pipeline_state->uses_pipeline_robustness);
+        data_ptr[spvtools::kDebugOutputFlagsOffset] = spvtools::kInstBufferOOBEnable;
     }
 
-    GpuAssistedDeviceMemoryBlock bda_input_block = {};
-    VkDescriptorBufferInfo di_input_desc_buffer_info = {};
-    VkDescriptorBufferInfo bda_input_desc_buffer_info = {};
-    VkWriteDescriptorSet desc_writes[3] = {};
     GpuAssistedPreDrawResources pre_draw_resources = {};
     GpuAssistedPreDispatchResources pre_dispatch_resources = {};
-    uint32_t desc_count = 1;
 
     if (validate_draw_indirect && ((cmd_type == CMD_DRAWINDIRECTCOUNT || cmd_type == CMD_DRAWINDIRECTCOUNTKHR ||
                                     cmd_type == CMD_DRAWINDEXEDINDIRECTCOUNT || cmd_type == CMD_DRAWINDEXEDINDIRECTCOUNTKHR) ||
@@ -2136,86 +2213,22 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
         restorable_state.Restore(cmd_buffer);
     }
 
-    if (cb_node->current_input_buffer != VK_NULL_HANDLE) {
-        di_input_desc_buffer_info.range = VK_WHOLE_SIZE;
-        di_input_desc_buffer_info.buffer = cb_node->current_input_buffer;
-        di_input_desc_buffer_info.offset = 0;
-
-        desc_writes[desc_count] = LvlInitStruct<VkWriteDescriptorSet>();
-        desc_writes[desc_count].dstBinding = 1;
-        desc_writes[desc_count].descriptorCount = 1;
-        desc_writes[desc_count].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-        desc_writes[desc_count].pBufferInfo = &di_input_desc_buffer_info;
-        desc_writes[desc_count].dstSet = desc_sets[0];
-        desc_count++;
-    }
-
+    std::shared_ptr<const GpuAssistedBdaTable> bda_table;
+    VkDescriptorBufferInfo bda_input = {};
     if (buffer_device_address) {
-        auto address_ranges = GetBufferAddressRanges();
-        if (address_ranges.size() > 0) {
-            // Example BDA input buffer assuming 2 buffers using BDA:
-            // Word 0 | Index of start of buffer sizes (in this case 5)
-            // Word 1 | 0x0000000000000000
-            // Word 2 | Device Address of first buffer  (Addresses sorted in ascending order)
-            // Word 3 | Device Address of second buffer
-            // Word 4 | 0xffffffffffffffff
-            // Word 5 | 0 (size of pretend buffer at word 1)
-            // Word 6 | Size in bytes of first buffer
-            // Word 7 | Size in bytes of second buffer
-            // Word 8 | 0 (size of pretend buffer in word 4)
-
-            uint32_t num_buffers = static_cast<uint32_t>(address_ranges.size());
-            uint32_t words_needed = (num_buffers + 3) + (num_buffers + 2);
-            buffer_info.size = words_needed * 8;  // 64 bit words
-            alloc_info.pool = VK_NULL_HANDLE;
-            result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &bda_input_block.buffer, &bda_input_block.allocation,
-                                     nullptr);
-            if (result != VK_SUCCESS) {
-                ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.", true);
-                aborted = true;
-                return;
-            }
-            uint64_t *bda_data;
-            result = vmaMapMemory(vmaAllocator, bda_input_block.allocation, reinterpret_cast<void **>(&bda_data));
-            uint32_t address_index = 1;
-            uint32_t size_index = 3 + num_buffers;
-            memset(bda_data, 0, static_cast<size_t>(buffer_info.size));
-            bda_data[0] = size_index;       // Start of buffer sizes
-            bda_data[address_index++] = 0;  // NULL address
-            bda_data[size_index++] = 0;
-
-            for (const auto &range : address_ranges) {
-                bda_data[address_index++] = range.begin;
-                bda_data[size_index++] = range.end - range.begin;
-            }
-            bda_data[address_index] = UINTPTR_MAX;
-            bda_data[size_index] = 0;
-            vmaUnmapMemory(vmaAllocator, bda_input_block.allocation);
-
-            bda_input_desc_buffer_info.range = (words_needed * 8);
-            bda_input_desc_buffer_info.buffer = bda_input_block.buffer;
-            bda_input_desc_buffer_info.offset = 0;
-
-            desc_writes[desc_count] = LvlInitStruct<VkWriteDescriptorSet>();
-            desc_writes[desc_count].dstBinding = 2;
-            desc_writes[desc_count].descriptorCount = 1;
-            desc_writes[desc_count].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-            desc_writes[desc_count].pBufferInfo = &bda_input_desc_buffer_info;
-            desc_writes[desc_count].dstSet = desc_sets[0];
-            desc_count++;
+        bda_table = GetBdaTable();
+        if (aborted) return;
+        if (bda_table && bda_table->buffer != VK_NULL_HANDLE) {
+            bda_input.buffer = bda_table->buffer;
+            bda_input.offset = 0;
+            bda_input.range = bda_table->size;
         }
     }
 
-    // Write the descriptor
-    output_desc_buffer_info.buffer = output_block.buffer;
-    output_desc_buffer_info.offset = 0;
-
-    desc_writes[0] = LvlInitStruct<VkWriteDescriptorSet>();
-    desc_writes[0].descriptorCount = 1;
-    desc_writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    desc_writes[0].pBufferInfo = &output_desc_buffer_info;
-    desc_writes[0].dstSet = desc_sets[0];
-    DispatchUpdateDescriptorSets(device, desc_count, desc_writes, 0, NULL);
+    const auto *draw_desc_set = GetDrawDescriptorSet(*cb_node, output_block.buffer, bda_input);
+    if (!draw_desc_set) {
+        return;
+    }
 
     if (pipeline_state) {
         const auto pipeline_layout = pipeline_state->PipelineLayoutState();
@@ -2226,27 +2239,141 @@ void GpuAssisted::AllocateValidationResources(const VkCommandBuffer cmd_buffer,
         // null handle.
         const auto pipeline_layout_handle =
             (last_bound.pipeline_layout) ? last_bound.pipeline_layout : pipeline_state->PreRasterPipelineLayoutState()->layout();
-        if ((pipeline_layout->set_layouts.size() <= desc_set_bind_index) && !pipeline_layout->Destroyed()) {
-            DispatchCmdBindDescriptorSets(cmd_buffer, bind_point, pipeline_layout_handle, desc_set_bind_index, 1, desc_sets.data(),
-                                          0, nullptr);
+        if (!PipelineLayoutConflicts(*pipeline_layout) && !pipeline_layout->Destroyed()) {
+            const uint32_t output_offset = static_cast<uint32_t>(output_block.offset);
+            DispatchCmdBindDescriptorSets(cmd_buffer, bind_point, pipeline_layout_handle, desc_set_bind_index, 1,
+                                          &draw_desc_set->desc_set, 1, &output_offset);
         }
         if (pipeline_layout->Destroyed()) {
             ReportSetupProblem(device, "Pipeline layout has been destroyed, aborting GPU-AV");
             aborted = true;
         } else {
             // Record buffer and memory info in CB state tracking
-            cb_node->per_draw_buffer_list.emplace_back(output_block, bda_input_block, pre_draw_resources, pre_dispatch_resources,
-                                                       desc_sets[0], desc_pool, bind_point, uses_robustness, cmd_type);
+            cb_node->per_draw_buffer_list.emplace_back(std::move(output_block), std::move(bda_table), pre_draw_resources,
+                                                       pre_dispatch_resources, bind_point, uses_robustness, cmd_type);
         }
     } else {
         ReportSetupProblem(device, "Unable to find pipeline state");
         aborted = true;
     }
-    if (aborted) {
-        vmaDestroyBuffer(vmaAllocator, bda_input_block.buffer, bda_input_block.allocation);
-        vmaDestroyBuffer(vmaAllocator, output_block.buffer, output_block.allocation);
-        return;
+}
+
+// Returns the descriptor set of the instrumented shaders for a draw writing its output to output_buffer. The set of the
+// previous draw is reused if it refers to the same buffers, as only the dynamic offset of the output record differs.
+const GpuAssistedDrawDescriptorSet *GpuAssisted::GetDrawDescriptorSet(gpuav_state::CommandBuffer &cb_node, VkBuffer output_buffer,
+                                                                      const VkDescriptorBufferInfo &bda_input) {
+    const auto same_range = [](const VkDescriptorBufferInfo &a, const VkDescriptorBufferInfo &b) {
+        return a.buffer == b.buffer && a.offset == b.offset && a.range == b.range;
+    };
+    if (!cb_node.draw_desc_sets.empty()) {
+        const auto &last = cb_node.draw_desc_sets.back();
+        if (last.output_buffer == output_buffer && same_range(last.di_input, cb_node.current_input) &&
+            same_range(last.bda_input, bda_input)) {
+            return &last;
+        }
+    }
+
+    GpuAssistedDrawDescriptorSet draw_desc_set;
+    VkResult result = desc_set_manager->GetDescriptorSet(&draw_desc_set.desc_pool, debug_desc_layout, &draw_desc_set.desc_set);
+    if (result != VK_SUCCESS) {
+        ReportSetupProblem(device, "Unable to allocate descriptor sets.  Device could become unstable.");
+        aborted = true;
+        return nullptr;
+    }
+    draw_desc_set.output_buffer = output_buffer;
+    draw_desc_set.di_input = cb_node.current_input;
+    draw_desc_set.bda_input = bda_input;
+
+    VkDescriptorBufferInfo output_desc_buffer_info = {};
+    output_desc_buffer_info.buffer = output_buffer;
+    output_desc_buffer_info.offset = 0;
+    output_desc_buffer_info.range = output_buffer_size;
+
+    VkWriteDescriptorSet desc_writes[3] = {};
+    desc_writes[0] = LvlInitStruct<VkWriteDescriptorSet>();
+    desc_writes[0].dstBinding = 0;
+    desc_writes[0].descriptorCount = 1;
+    desc_writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+    desc_writes[0].pBufferInfo = &output_desc_buffer_info;
+    desc_writes[0].dstSet = draw_desc_set.desc_set;
+    uint32_t desc_count = 1;
+
+    if (draw_desc_set.di_input.buffer != VK_NULL_HANDLE) {
+        desc_writes[desc_count] = LvlInitStruct<VkWriteDescriptorSet>();
+        desc_writes[desc_count].dstBinding = 1;
+        desc_writes[desc_count].descriptorCount = 1;
+        desc_writes[desc_count].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        desc_writes[desc_count].pBufferInfo = &draw_desc_set.di_input;
+        desc_writes[desc_count].dstSet = draw_desc_set.desc_set;
+        desc_count++;
+    }
+    if (draw_desc_set.bda_input.buffer != VK_NULL_HANDLE) {
+        desc_writes[desc_count] = LvlInitStruct<VkWriteDescriptorSet>();
+        desc_writes[desc_count].dstBinding = 2;
+        desc_writes[desc_count].descriptorCount = 1;
+        desc_writes[desc_count].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        desc_writes[desc_count].pBufferInfo = &draw_desc_set.bda_input;
+        desc_writes[desc_count].dstSet = draw_desc_set.desc_set;
+        desc_count++;
+    }
+    DispatchUpdateDescriptorSets(device, desc_count, desc_writes, 0, nullptr);
+
+    cb_node.draw_desc_sets.emplace_back(draw_desc_set);
+    return &cb_node.draw_desc_sets.back();
+}
+
+VkResult GpuAssistedSlab::Allocate(VmaAllocator allocator, VmaPool pool, VkDeviceSize alignment, VkDeviceSize size,
+                                   GpuAssistedDeviceMemoryBlock *block) {
+    alignment = std::max<VkDeviceSize>(alignment, sizeof(uint32_t));
+    Chunk *chunk = nullptr;
+    VkDeviceSize offset = 0;
+    if (!chunks_.empty()) {
+        chunk = &chunks_.back();
+        offset = (chunk->used + alignment - 1) / alignment * alignment;
+        if (offset + size > chunk->size) {
+            chunk = nullptr;
+        }
+    }
+    if (!chunk) {
+        auto buffer_info = LvlInitStruct<VkBufferCreateInfo>();
+        buffer_info.size = std::max(size, kChunkSize);
+        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        VmaAllocationCreateInfo alloc_info = {};
+        alloc_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        alloc_info.pool = pool;
+        Chunk new_chunk = {};
+        VmaAllocationInfo allocation_info = {};
+        VkResult result =
+            vmaCreateBuffer(allocator, &buffer_info, &alloc_info, &new_chunk.buffer, &new_chunk.allocation, &allocation_info);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+        new_chunk.data = static_cast<uint8_t *>(allocation_info.pMappedData);
+        new_chunk.size = buffer_info.size;
+        new_chunk.used = 0;
+        if (size > kChunkSize && !chunks_.empty()) {
+            // Oversized allocations get a chunk of their own, keep allocating from the current one
+            chunk = &*chunks_.insert(chunks_.end() - 1, new_chunk);
+        } else {
+            chunks_.push_back(new_chunk);
+            chunk = &chunks_.back();
+        }
+        offset = 0;
+    }
+    chunk->used = offset + size;
+    block->buffer = chunk->buffer;
+    block->offset = offset;
+    block->size = size;
+    block->data = reinterpret_cast<uint32_t *>(chunk->data + offset);
+    return VK_SUCCESS;
+}
+
+void GpuAssistedSlab::Reset(VmaAllocator allocator) {
+    for (auto &chunk : chunks_) {
+        vmaDestroyBuffer(allocator, chunk.buffer, chunk.allocation);
     }
+    chunks_.clear();
 }
 
 std::shared_ptr<CMD_BUFFER_STATE> GpuAssisted::CreateCmdBufferState(VkCommandBuffer cb,
@@ -2271,11 +2398,14 @@ void gpuav_state::CommandBuffer::Reset() {
     }
     per_draw_buffer_list.clear();
 
-    for (auto &buffer_info : di_input_buffer_list) {
-        vmaDestroyBuffer(gpuav->vmaAllocator, buffer_info.buffer, buffer_info.allocation);
-    }
     di_input_buffer_list.clear();
-    current_input_buffer = VK_NULL_HANDLE;
+    current_input = {};
+
+    for (auto &draw_desc_set : draw_desc_sets) {
+        gpuav->desc_set_manager->PutBackDescriptorSet(draw_desc_set.desc_pool, draw_desc_set.desc_set);
+    }
+    draw_desc_sets.clear();
+    slab.Reset(gpuav->vmaAllocator);
 
     for (auto &as_validation_buffer_info : as_validation_buffers) {
         gpuav->DestroyBuffer(as_validation_buffer_info);
@@ -25,12 +25,49 @@
 
 class GpuAssisted;
 
+// Range of a command buffer's GpuAssistedSlab, persistently mapped at data
 struct GpuAssistedDeviceMemoryBlock {
-    VkBuffer buffer;
-    VmaAllocation allocation;
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+    uint32_t* data = nullptr;
     layer_data::unordered_map<uint32_t, const cvdescriptorset::DescriptorBinding*> update_at_submit;
 };
 
+// Host visible memory of a command buffer, from which the output records of its draws and its descriptor indexing input
+// blocks are sub-allocated. Memory is created in large persistently mapped chunks, so that recording a draw does not create,
+// map or free a buffer of its own. All chunks are freed when the command buffer is reset.
+class GpuAssistedSlab {
+  public:
+    static constexpr VkDeviceSize kChunkSize = 64 * 1024;
+
+    // Allocate size bytes at an offset that is a multiple of alignment
+    VkResult Allocate(VmaAllocator allocator, VmaPool pool, VkDeviceSize alignment, VkDeviceSize size,
+                      GpuAssistedDeviceMemoryBlock* block);
+    void Reset(VmaAllocator allocator);
+
+  private:
+    struct Chunk {
+        VkBuffer buffer;
+        VmaAllocation allocation;
+        uint8_t* data;
+        VkDeviceSize size;
+        VkDeviceSize used;
+    };
+    // The last chunk is the one being allocated from
+    std::vector<Chunk> chunks_;
+};
+
+// Descriptor set of the instrumented shaders. A set is shared by all consecutive draws of a command buffer that read the
+// same input buffers and write to the same output chunk, each draw selecting its output record with a dynamic offset.
+struct GpuAssistedDrawDescriptorSet {
+    VkDescriptorPool desc_pool = VK_NULL_HANDLE;
+    VkDescriptorSet desc_set = VK_NULL_HANDLE;
+    VkBuffer output_buffer = VK_NULL_HANDLE;
+    VkDescriptorBufferInfo di_input = {};
+    VkDescriptorBufferInfo bda_input = {};
+};
+
 struct GpuAssistedPreDrawResources {
     VkDescriptorPool desc_pool = VK_NULL_HANDLE;
     VkDescriptorSet desc_set = VK_NULL_HANDLE;
@@ -49,26 +86,31 @@ struct GpuAssistedPreDispatchResources {
     static const uint32_t push_constant_words = 4;
 };
 
+// Buffer Device Address input: the sorted address ranges of all buffers with a device address, as read by the instrumented
+// shaders. One table is shared by all draws recorded while the state tracker's buffer address map is unchanged.
+struct GpuAssistedBdaTable {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VmaAllocation allocation = VK_NULL_HANDLE;
+    VkDeviceSize size = 0;
+    VkDeviceSize capacity = 0;
+    uint64_t version = 0;
+};
+
 struct GpuAssistedBufferInfo {
     GpuAssistedDeviceMemoryBlock output_mem_block;
-    GpuAssistedDeviceMemoryBlock bda_input_mem_block;  // Buffer Device Address input
+    std::shared_ptr<const GpuAssistedBdaTable> bda_table;
     GpuAssistedPreDrawResources pre_draw_resources;
     GpuAssistedPreDispatchResources pre_dispatch_resources;
-    VkDescriptorSet desc_set;
-    VkDescriptorPool desc_pool;
     VkPipelineBindPoint pipeline_bind_point;
     bool uses_robustness;
     CMD_TYPE cmd_type;
-    GpuAssistedBufferInfo(GpuAssistedDeviceMemoryBlock output_mem_block,
-                          GpuAssistedDeviceMemoryBlock bda_input_mem_block, GpuAssistedPreDrawResources pre_draw_resources,
-                          GpuAssistedPreDispatchResources pre_dispatch_resources, VkDescriptorSet desc_set,
-                          VkDescriptorPool desc_pool, VkPipelineBindPoint pipeline_bind_point, bool uses_robustness, CMD_TYPE cmd_type)
+    GpuAssistedBufferInfo(GpuAssistedDeviceMemoryBlock output_mem_block, std::shared_ptr<const GpuAssistedBdaTable> bda_table,
+                          GpuAssistedPreDrawResources pre_draw_resources, GpuAssistedPreDispatchResources pre_dispatch_resources,
+                          VkPipelineBindPoint pipeline_bind_point, bool uses_robustness, CMD_TYPE cmd_type)
         : output_mem_block(output_mem_block),
-          bda_input_mem_block(bda_input_mem_block),
+          bda_table(std::move(bda_table)),
           pre_draw_resources(pre_draw_resources),
           pre_dispatch_resources(pre_dispatch_resources),
-          desc_set(desc_set),
-          desc_pool(desc_pool),
           pipeline_bind_point(pipeline_bind_point),
           uses_robustness(uses_robustness),
           cmd_type(cmd_type){};
@@ -154,7 +196,10 @@ class CommandBuffer : public gpu_utils_state::CommandBuffer {
     std::vector<GpuAssistedBufferInfo> per_draw_buffer_list;
     std::vector<GpuAssistedDeviceMemoryBlock> di_input_buffer_list;
     std::vector<GpuAssistedAccelerationStructureBuildValidationBufferInfo> as_validation_buffers;
-    VkBuffer current_input_buffer = VK_NULL_HANDLE;
+    std::vector<GpuAssistedDrawDescriptorSet> draw_desc_sets;
+    GpuAssistedSlab slab;
+    // Descriptor indexing input block of the descriptor sets bound last, buffer is VK_NULL_HANDLE if there is none
+    VkDescriptorBufferInfo current_input = {};
 
     CommandBuffer(GpuAssisted* ga, VkCommandBuffer cb, const VkCommandBufferAllocateInfo* pCreateInfo,
                   const COMMAND_POOL_STATE* pool);
@@ -197,7 +242,7 @@ class GpuAssisted : public GpuAssistedBase {
     void ProcessAccelerationStructureBuildValidationBuffer(VkQueue queue, gpuav_state::CommandBuffer* cb_node);
     void PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks *pAllocator) override;
     bool InstrumentShader(const layer_data::span<const uint32_t>& input, std::vector<uint32_t>& new_pgm,
-                          uint32_t* unique_shader_id) override;
+                          uint32_t unique_shader_id) override;
     void PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                          void* csm_state_data) override;
@@ -305,6 +350,9 @@ class GpuAssisted : public GpuAssistedBase {
   private:
     void PreRecordCommandBuffer(VkCommandBuffer command_buffer);
     VkPipeline GetValidationPipeline(VkRenderPass render_pass);
+    std::shared_ptr<const GpuAssistedBdaTable> GetBdaTable();
+    const GpuAssistedDrawDescriptorSet* GetDrawDescriptorSet(gpuav_state::CommandBuffer& cb_node, VkBuffer output_buffer,
+                                                             const VkDescriptorBufferInfo& bda_input);
 
     VkBool32 shaderInt64;
     bool buffer_oob_enabled;
@@ -317,4 +365,8 @@ class GpuAssisted : public GpuAssistedBase {
 
     bool descriptor_indexing = false;
     bool buffer_device_address;
+
+    // Table for the current BufferAddressMapVersion(), see GpuAssistedBdaTable
+    std::mutex bda_table_lock_;
+    std::shared_ptr<GpuAssistedBdaTable> bda_table_;
 };
@@ -109,6 +109,8 @@ class ObjectLifetimes : public ValidationObject {
     void CreateSwapchainImageObject(VkImage swapchain_image, VkSwapchainKHR swapchain);
     void DestroyLeakedInstanceObjects();
     void DestroyLeakedDeviceObjects();
+    // Logs the lock contention counters of the object maps, see vl_concurrent_map_config.
+    void ReportObjectMapContention() const;
     bool ValidateDeviceObject(const VulkanTypedHandle &device_typed, const char *invalid_handle_code,
                               const char *wrong_device_code) const;
     void DestroyQueueDataStructures();
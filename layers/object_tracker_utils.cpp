@@ -20,6 +20,8 @@
  * Author: Tobin Ehlis <tobin@lunarg.com>
  */
 
+#include <sstream>
+
 #include "chassis.h"
 
 #include "object_lifetime_validation.h"
@@ -49,6 +51,21 @@ void ObjectLifetimes::DestroyQueueDataStructures() {
     }
 }
 
+void ObjectLifetimes::ReportObjectMapContention() const {
+    if (!vl_concurrent_map_config::Get().collect_stats) return;
+
+    std::ostringstream report;
+    for (uint32_t object_type = kVulkanObjectTypeUnknown; object_type < kVulkanObjectTypeMax; ++object_type) {
+        object_map[object_type].ReportContention(object_string[object_type], report);
+    }
+    swapchainImageMap.ReportContention("swapchainImageMap", report);
+
+    const std::string text = report.str();
+    if (!text.empty()) {
+        LogInfo(device, "UNASSIGNED-concurrent-map-contention", "Object tracker map lock contention:\n%s", text.c_str());
+    }
+}
+
 void ObjectLifetimes::DestroyUndestroyedObjects(VulkanObjectType object_type) {
     auto snapshot = object_map[object_type].snapshot();
     for (const auto &item : snapshot) {
@@ -412,6 +429,7 @@ void ObjectLifetimes::PreCallRecordDestroyDevice(VkDevice device, const VkAlloca
     ValidationObject *validation_data = GetValidationObject(instance_data->object_dispatch, LayerObjectTypeObjectTracker);
     ObjectLifetimes *object_lifetimes = static_cast<ObjectLifetimes *>(validation_data);
     object_lifetimes->RecordDestroyObject(device, kVulkanObjectTypeDevice);
+    ReportObjectMapContention();
     DestroyLeakedDeviceObjects();
 
     // Clean up Queue's MemRef Linked Lists
@@ -106,13 +106,8 @@ struct QueryObject {
         : pool(pool_), query(query_), index(0), perf_pass(0), indexed(false), endCommandIndex(0) {}
     QueryObject(VkQueryPool pool_, uint32_t query_, uint32_t index_)
         : pool(pool_), query(query_), index(index_), perf_pass(0), indexed(true), endCommandIndex(0) {}
-    QueryObject(const QueryObject &obj)
-        : pool(obj.pool),
-          query(obj.query),
-          index(obj.index),
-          perf_pass(obj.perf_pass),
-          indexed(obj.indexed),
-          endCommandIndex(obj.endCommandIndex) {}
+    // Trivially copyable so that queries can be recorded into a DeferredCheckStream
+    QueryObject(const QueryObject &obj) = default;
     QueryObject(const QueryObject &obj, uint32_t perf_pass_)
         : pool(obj.pool),
           query(obj.query),
@@ -180,9 +180,7 @@ CB_SUBMISSION *QUEUE_STATE::NextSubmission() {
     return result;
 }
 
-void QUEUE_STATE::ThreadFunc() {
-    CB_SUBMISSION *submission = nullptr;
-
+void QUEUE_STATE::Retire(CB_SUBMISSION &submission) {
     auto is_query_updated_after = [this](const QueryObject &query_object) {
         auto guard = this->Lock();
         bool first = true;
@@ -204,26 +202,32 @@ void QUEUE_STATE::ThreadFunc() {
         return false;
     };
 
+    submission.EndUse();
+    for (auto &wait : submission.wait_semaphores) {
+        wait.semaphore->Retire(this, wait.payload);
+    }
+    for (auto &cb_state : submission.cbs) {
+        auto cb_guard = cb_state->WriteLock();
+        for (auto *secondary_cmd_buffer : cb_state->linkedCommandBuffers) {
+            auto secondary_guard = secondary_cmd_buffer->WriteLock();
+            secondary_cmd_buffer->Retire(submission.perf_submit_pass, is_query_updated_after);
+        }
+        cb_state->Retire(submission.perf_submit_pass, is_query_updated_after);
+    }
+    for (auto &signal : submission.signal_semaphores) {
+        signal.semaphore->Retire(this, signal.payload);
+    }
+    if (submission.fence) {
+        submission.fence->Retire();
+    }
+}
+
+void QUEUE_STATE::ThreadFunc() {
+    CB_SUBMISSION *submission = nullptr;
+
     // Roll this queue forward, one submission at a time.
     while ((submission = NextSubmission())) {
-        submission->EndUse();
-        for (auto &wait : submission->wait_semaphores) {
-            wait.semaphore->Retire(this, wait.payload);
-        }
-        for (auto &cb_state : submission->cbs) {
-            auto cb_guard = cb_state->WriteLock();
-            for (auto *secondary_cmd_buffer : cb_state->linkedCommandBuffers) {
-                auto secondary_guard = secondary_cmd_buffer->WriteLock();
-                secondary_cmd_buffer->Retire(submission->perf_submit_pass, is_query_updated_after);
-            }
-            cb_state->Retire(submission->perf_submit_pass, is_query_updated_after);
-        }
-        for (auto &signal : submission->signal_semaphores) {
-            signal.semaphore->Retire(this, signal.payload);
-        }
-        if (submission->fence) {
-            submission->fence->Retire();
-        }
+        Retire(*submission);
         // wake up anyone waiting for this submission to be retired
         {
             auto guard = Lock();
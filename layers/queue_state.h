@@ -323,10 +323,17 @@ class QUEUE_STATE : public BASE_NODE {
     void NotifyAndWait(uint64_t until_seq = UINT64_MAX);
     std::shared_future<void> Wait(uint64_t until_seq = UINT64_MAX);
 
+    // Sequence number of the most recent submission
+    uint64_t SubmittedSeq() const { return seq_.load(); }
+
     const uint32_t queueFamilyIndex;
     const VkDeviceQueueCreateFlags flags;
     const VkQueueFamilyProperties queueFamilyProperties;
 
+  protected:
+    // Called on the queue thread, in submission order, once a submission is known to have completed
+    virtual void Retire(CB_SUBMISSION &submission);
+
   private:
     using LockGuard = std::unique_lock<std::mutex>;
     void ThreadFunc();
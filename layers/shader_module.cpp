@@ -25,6 +25,7 @@
 #include "pipeline_state.h"
 #include "descriptor_sets.h"
 #include "spirv_grammar_helper.h"
+#include "xxhash.h"
 
 void DecorationSet::Add(uint32_t decoration, uint32_t value) {
     switch (decoration) {
@@ -242,8 +243,9 @@ layer_data::optional<VkPrimitiveTopology> SHADER_MODULE_STATE::GetTopology(const
     auto entrypoint_id = entrypoint.Word(2);
     bool is_point_mode = false;
 
-    auto it = static_data_.execution_mode_inst.find(entrypoint_id);
-    if (it != static_data_.execution_mode_inst.end()) {
+    const auto &execution_mode_inst = GetStaticData().execution_mode_inst;
+    auto it = execution_mode_inst.find(entrypoint_id);
+    if (it != execution_mode_inst.end()) {
         for (const Instruction* insn : it->second) {
             switch (insn->Word(2)) {
                 case spv::ExecutionModePointMode:
@@ -279,8 +281,9 @@ layer_data::optional<VkPrimitiveTopology> SHADER_MODULE_STATE::GetTopology(const
 }
 
 layer_data::optional<VkPrimitiveTopology> SHADER_MODULE_STATE::GetTopology() const {
-    if (static_data_.entry_points.size() > 0) {
-        return GetTopology(static_data_.entry_points[0].entrypoint_insn);
+    const auto &entry_point_inst = GetStaticData().entry_point_inst;
+    if (entry_point_inst.size() > 0) {
+        return GetTopology(*entry_point_inst[0]);
     }
     return {};
 }
@@ -292,7 +295,7 @@ static inline bool IsImageOperandsBiasOffset(uint32_t type) {
 
 SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_state) {
     // Parse the words first so we have instruction class objects to use
-    {
+    if (module_state.words_.size() >= 5) {
         std::vector<uint32_t>::const_iterator it = module_state.words_.cbegin();
         it += 5;  // skip first 5 word of header
         while (it != module_state.words_.cend()) {
@@ -312,10 +315,7 @@ SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_st
         instructions.shrink_to_fit();
     }
 
-    std::vector<const Instruction*> entry_point_instructions;
-
     // Loop through once and build up the static data
-    // Also process the entry points
     for (const Instruction& insn : instructions) {
         // Build definition list
         if (insn.ResultId() != 0) {
@@ -374,10 +374,32 @@ SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_st
 
             // Entry points
             case spv::OpEntryPoint: {
-                entry_point_instructions.push_back(&insn);
+                entry_point_inst.push_back(&insn);
                 break;
             }
 
+            default:
+                if (AtomicOperation(insn.Opcode()) == true) {
+                    atomic_inst.push_back(&insn);
+                }
+                // We don't care about any other defs for now.
+                break;
+        }
+    }
+}
+
+SHADER_MODULE_STATE::EntryPointData::EntryPointData(const SHADER_MODULE_STATE& module_state) {
+    // Uses the definitions table of the static data to look for which instructions each entry point uses
+    for (const Instruction* insn : module_state.GetStaticData().entry_point_inst) {
+        entry_points.emplace_back(EntryPoint{module_state, *insn});
+    }
+
+    SHADER_MODULE_STATE::SetPushConstantUsedInShader(module_state, entry_points);
+}
+
+SHADER_MODULE_STATE::AccessData::AccessData(const SHADER_MODULE_STATE& module_state) {
+    for (const Instruction& insn : module_state.GetInstructions()) {
+        switch (insn.Opcode()) {
             // Access operations
             case spv::OpImageSampleImplicitLod:
             case spv::OpImageSampleProjImplicitLod:
@@ -482,7 +504,6 @@ SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_st
 
             default:
                 if (AtomicOperation(insn.Opcode()) == true) {
-                    atomic_inst.push_back(&insn);
                     if (insn.Opcode() == spv::OpAtomicStore) {
                         atomic_store_pointer_ids.emplace_back(insn.Word(1));
                         atomic_pointer_ids.emplace_back(insn.Word(1));
@@ -490,37 +511,145 @@ SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_st
                         atomic_pointer_ids.emplace_back(insn.Word(3));
                     }
                 }
-                // We don't care about any other defs for now.
                 break;
         }
     }
+}
 
-    // Need to build the definitions table for FindDef before looking for which instructions each entry point uses
-    for (const auto& insn : entry_point_instructions) {
-        entry_points.emplace_back(EntryPoint{module_state, *insn});
+// Approximate heap usage of the containers making up the parsed module data
+template <typename T>
+static size_t ContainerMemoryUsage(const std::vector<T>& container) {
+    return container.capacity() * sizeof(T);
+}
+
+template <typename Map>
+static size_t ContainerMemoryUsage(const Map& container) {
+    // One node, or slot, per element plus its share of the bucket array
+    return container.size() * (sizeof(typename Map::value_type) + 2 * sizeof(void*));
+}
+
+size_t SHADER_MODULE_STATE::StaticData::MemoryUsage() const {
+    size_t usage = ContainerMemoryUsage(instructions) + ContainerMemoryUsage(definitions) + ContainerMemoryUsage(decorations) +
+                   ContainerMemoryUsage(spec_const_map) + ContainerMemoryUsage(decoration_inst) +
+                   ContainerMemoryUsage(member_decoration_inst) + ContainerMemoryUsage(variable_inst) +
+                   ContainerMemoryUsage(execution_mode_inst) + ContainerMemoryUsage(builtin_decoration_inst) +
+                   ContainerMemoryUsage(atomic_inst) + ContainerMemoryUsage(entry_point_inst) +
+                   ContainerMemoryUsage(capability_list);
+    for (const auto& entry : execution_mode_inst) {
+        usage += ContainerMemoryUsage(entry.second);
+    }
+    return usage;
+}
+
+size_t SHADER_MODULE_STATE::EntryPointData::MemoryUsage() const {
+    size_t usage = ContainerMemoryUsage(entry_points);
+    for (const auto& entry_point : entry_points) {
+        usage += ContainerMemoryUsage(entry_point.accessible_ids);
     }
+    return usage;
+}
 
-    SHADER_MODULE_STATE::SetPushConstantUsedInShader(module_state, entry_points);
+size_t SHADER_MODULE_STATE::AccessData::MemoryUsage() const {
+    return ContainerMemoryUsage(image_read_load_ids) + ContainerMemoryUsage(image_write_load_ids) +
+           ContainerMemoryUsage(image_write_load_id_map) + ContainerMemoryUsage(atomic_pointer_ids) +
+           ContainerMemoryUsage(store_pointer_ids) + ContainerMemoryUsage(atomic_store_pointer_ids) +
+           ContainerMemoryUsage(sampler_load_ids) + ContainerMemoryUsage(sampler_implicitLod_dref_proj_load_ids) +
+           ContainerMemoryUsage(sampler_bias_offset_load_ids) + ContainerMemoryUsage(image_dref_load_ids) +
+           ContainerMemoryUsage(sampled_image_load_ids) + ContainerMemoryUsage(load_members) +
+           ContainerMemoryUsage(accesschain_members) + ContainerMemoryUsage(image_texel_pointer_members);
+}
+
+SHADER_MODULE_STATE::MemoryUsage SHADER_MODULE_STATE::GetMemoryUsage() const {
+    MemoryUsage usage;
+    usage.words = ContainerMemoryUsage(words_);
+    if (const auto* data = spirv_data_->static_data.Peek()) usage.static_data = data->MemoryUsage();
+    if (const auto* data = spirv_data_->entry_point_data.Peek()) usage.entry_point_data = data->MemoryUsage();
+    if (const auto* data = spirv_data_->access_data.Peek()) usage.access_data = data->MemoryUsage();
+    return usage;
+}
+
+// Group decorations are only allowed in the annotation section, so there is no need to parse the module to look for them
+static bool HasGroupDecoration(const uint32_t* words, size_t word_count) {
+    for (size_t offset = 5; offset < word_count;) {
+        const uint32_t opcode = words[offset] & 0x0ffffu;
+        const uint32_t length = words[offset] >> 16;
+        if (opcode == spv::OpGroupDecorate || opcode == spv::OpDecorationGroup || opcode == spv::OpGroupMemberDecorate) {
+            return true;
+        } else if (opcode == spv::OpFunction || length == 0) {
+            break;
+        }
+        offset += length;
+    }
+    return false;
 }
 
-void SHADER_MODULE_STATE::PreprocessShaderBinary(const spv_target_env env) {
-    if (static_data_.has_group_decoration) {
+static std::vector<uint32_t> PreprocessShaderBinary(std::vector<uint32_t>&& words, const spv_target_env env) {
+    if (HasGroupDecoration(words.data(), words.size())) {
         spvtools::Optimizer optimizer(env);
         optimizer.RegisterPass(spvtools::CreateFlattenDecorationPass());
         std::vector<uint32_t> optimized_binary;
         // Run optimizer to flatten decorations only, set skip_validation so as to not re-run validator
-        auto result = optimizer.Run(words_.data(), words_.size(), &optimized_binary, spvtools::ValidatorOptions(), true);
+        auto result = optimizer.Run(words.data(), words.size(), &optimized_binary, spvtools::ValidatorOptions(), true);
 
         if (result) {
             // NOTE: We need to update words with the result from the spirv-tools optimizer.
             // **THIS ONLY HAPPENS ON INITIALIZATION**. words should remain const for the lifetime
-            // of the SHADER_MODULE_STATE instance.
-            *const_cast<std::vector<uint32_t>*>(&words_) = std::move(optimized_binary);
-            // Will need to update static data now the words have changed or else the def_index will not align
+            // of the SpirvData instance. The static data is only built on first use, so it is parsed from the flattened words.
             // It is really rare this will get here as Group Decorations have been deprecated and before this was added no one ever
             // raised an issue for a bug that would crash the layers that was around for many releases
-            StaticData new_static_data(*this);
-            *const_cast<StaticData*>(&static_data_) = std::move(new_static_data);
+            return optimized_binary;
+        }
+    }
+    return std::move(words);
+}
+
+SHADER_MODULE_STATE::SpirvData::SpirvData(std::vector<uint32_t>&& spirv, spv_target_env env)
+    : words(PreprocessShaderBinary(std::move(spirv), env)), hash(XXH64(words.data(), words.size() * sizeof(uint32_t), 0)) {}
+
+SHADER_MODULE_STATE::SpirvData::SpirvData(std::vector<uint32_t>&& spirv, spv_target_env env, uint64_t spirv_hash)
+    : words(PreprocessShaderBinary(std::move(spirv), env)), hash(spirv_hash) {
+    assert(hash == XXH64(words.data(), words.size() * sizeof(uint32_t), 0));
+}
+
+std::shared_ptr<const SHADER_MODULE_STATE::SpirvData> SpirvDataStore::Get(const uint32_t* code, size_t word_count,
+                                                                         spv_target_env env) {
+    // Flattening group decorations rewrites the words, so such modules would no longer compare equal to the code. They are rare
+    // enough to not be worth sharing.
+    if (HasGroupDecoration(code, word_count)) {
+        return std::make_shared<SpirvData>(std::vector<uint32_t>(code, code + word_count), env);
+    }
+
+    const uint64_t hash = XXH64(code, word_count * sizeof(uint32_t), 0);
+    std::lock_guard<std::mutex> guard(lock_);
+    auto& candidates = entries_[hash];
+    for (const auto& candidate : candidates) {
+        auto spirv_data = candidate.lock();
+        if (spirv_data && spirv_data->words.size() == word_count &&
+            std::equal(code, code + word_count, spirv_data->words.begin())) {
+            return spirv_data;
+        }
+    }
+    // Not allocated with make_shared, so that the memory is released with the last module rather than with the last weak_ptr
+    std::shared_ptr<const SpirvData> spirv_data(new SpirvData(std::vector<uint32_t>(code, code + word_count), env, hash));
+    candidates.emplace_back(spirv_data);
+
+    if (entries_.size() >= sweep_threshold_) {
+        SweepExpired();
+        sweep_threshold_ = std::max(kMinSweepThreshold, entries_.size() * 2);
+    }
+    return spirv_data;
+}
+
+void SpirvDataStore::SweepExpired() {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        auto& candidates = it->second;
+        candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                        [](const std::weak_ptr<const SpirvData>& candidate) { return candidate.expired(); }),
+                         candidates.end());
+        if (candidates.empty()) {
+            it = entries_.erase(it);
+        } else {
+            ++it;
         }
     }
 }
@@ -597,7 +726,7 @@ std::string SHADER_MODULE_STATE::DescribeType(uint32_t type) const {
 
 const SHADER_MODULE_STATE::StructInfo* SHADER_MODULE_STATE::FindEntrypointPushConstant(char const* name,
                                                                                        VkShaderStageFlagBits stageBits) const {
-    for (const auto& entry_point : static_data_.entry_points) {
+    for (const auto& entry_point : GetEntryPointData().entry_points) {
         if (entry_point.name.compare(name) == 0 && entry_point.stage == stageBits) {
             return &(entry_point.push_constant_used_in_shader);
         }
@@ -607,7 +736,7 @@ const SHADER_MODULE_STATE::StructInfo* SHADER_MODULE_STATE::FindEntrypointPushCo
 
 layer_data::optional<Instruction> SHADER_MODULE_STATE::FindEntrypoint(char const* name, VkShaderStageFlagBits stageBits) const {
     layer_data::optional<Instruction> result;
-    for (const auto& entry_point : static_data_.entry_points) {
+    for (const auto& entry_point : GetEntryPointData().entry_points) {
         if (entry_point.name.compare(name) == 0 && entry_point.stage == stageBits) {
             result.emplace(entry_point.entrypoint_insn);
         }
@@ -638,8 +767,9 @@ bool SHADER_MODULE_STATE::FindLocalSize(const Instruction& entrypoint, uint32_t&
     }
 
     auto entrypoint_id = entrypoint.Word(2);
-    auto it = static_data_.execution_mode_inst.find(entrypoint_id);
-    if (it != static_data_.execution_mode_inst.end()) {
+    const auto &execution_mode_inst = GetStaticData().execution_mode_inst;
+    auto it = execution_mode_inst.find(entrypoint_id);
+    if (it != execution_mode_inst.end()) {
         for (const Instruction* insn : it->second) {
             if (insn->Opcode() == spv::OpExecutionMode && insn->Word(2) == spv::ExecutionModeLocalSize) {
                 local_size_x = insn->Word(3);
@@ -1197,6 +1327,7 @@ static uint32_t CheckObjectIDFromOpLoad(
 // Takes a OpVariable and looks at the the descriptor type it uses. This will find things such as if the variable is writable, image
 // atomic operation, matching images to samplers, etc
 void SHADER_MODULE_STATE::FindVariableDescriptorType(bool is_storage_buffer, InterfaceVariable& interface_var) const {
+    const AccessData& access_data = GetAccessData();
     const Instruction* type = FindDef(interface_var.type_id);
 
     // Strip off any array or ptrs. Where we remove array levels, adjust the  descriptor count for each dimension.
@@ -1218,13 +1349,13 @@ void SHADER_MODULE_STATE::FindVariableDescriptorType(bool is_storage_buffer, Int
                 const bool is_image_without_format = ((type->Word(7) == 2) && (type->Word(8) == spv::ImageFormatUnknown));
 
                 const uint32_t image_write_load_id =
-                    CheckObjectIDFromOpLoad(interface_var.id, static_data_.image_write_load_ids, static_data_.load_members,
-                                            static_data_.accesschain_members);
+                    CheckObjectIDFromOpLoad(interface_var.id, access_data.image_write_load_ids, access_data.load_members,
+                                            access_data.accesschain_members);
                 if (image_write_load_id != 0) {
                     interface_var.is_writable = true;
                     if (is_image_without_format) {
                         interface_var.is_write_without_format = true;
-                        for (const auto& entry : static_data_.image_write_load_id_map) {
+                        for (const auto& entry : access_data.image_write_load_id_map) {
                             if (image_write_load_id == entry.second) {
                                 const uint32_t texel_component_count = GetTexelComponentCount(*entry.first);
                                 interface_var.write_without_formats_component_count_list.emplace_back(*entry.first,
@@ -1233,44 +1364,44 @@ void SHADER_MODULE_STATE::FindVariableDescriptorType(bool is_storage_buffer, Int
                         }
                     }
                 }
-                if (CheckObjectIDFromOpLoad(interface_var.id, static_data_.image_read_load_ids, static_data_.load_members,
-                                            static_data_.accesschain_members) != 0) {
+                if (CheckObjectIDFromOpLoad(interface_var.id, access_data.image_read_load_ids, access_data.load_members,
+                                            access_data.accesschain_members) != 0) {
                     interface_var.is_readable = true;
                     if (is_image_without_format) {
                         interface_var.is_read_without_format = true;
                     }
                 }
-                if (CheckObjectIDFromOpLoad(interface_var.id, static_data_.sampler_load_ids, static_data_.load_members,
-                                            static_data_.accesschain_members) != 0) {
+                if (CheckObjectIDFromOpLoad(interface_var.id, access_data.sampler_load_ids, access_data.load_members,
+                                            access_data.accesschain_members) != 0) {
                     interface_var.is_sampler_sampled = true;
                 }
-                if (CheckObjectIDFromOpLoad(interface_var.id, static_data_.sampler_implicitLod_dref_proj_load_ids,
-                                            static_data_.load_members, static_data_.accesschain_members) != 0) {
+                if (CheckObjectIDFromOpLoad(interface_var.id, access_data.sampler_implicitLod_dref_proj_load_ids,
+                                            access_data.load_members, access_data.accesschain_members) != 0) {
                     interface_var.is_sampler_implicitLod_dref_proj = true;
                 }
-                if (CheckObjectIDFromOpLoad(interface_var.id, static_data_.sampler_bias_offset_load_ids, static_data_.load_members,
-                                            static_data_.accesschain_members) != 0) {
+                if (CheckObjectIDFromOpLoad(interface_var.id, access_data.sampler_bias_offset_load_ids, access_data.load_members,
+                                            access_data.accesschain_members) != 0) {
                     interface_var.is_sampler_bias_offset = true;
                 }
-                if (CheckObjectIDFromOpLoad(interface_var.id, static_data_.atomic_pointer_ids,
-                                            static_data_.image_texel_pointer_members, static_data_.accesschain_members) != 0) {
+                if (CheckObjectIDFromOpLoad(interface_var.id, access_data.atomic_pointer_ids,
+                                            access_data.image_texel_pointer_members, access_data.accesschain_members) != 0) {
                     interface_var.is_atomic_operation = true;
                 }
-                if (CheckObjectIDFromOpLoad(interface_var.id, static_data_.image_dref_load_ids, static_data_.load_members,
-                                            static_data_.accesschain_members) != 0) {
+                if (CheckObjectIDFromOpLoad(interface_var.id, access_data.image_dref_load_ids, access_data.load_members,
+                                            access_data.accesschain_members) != 0) {
                     interface_var.is_dref_operation = true;
                 }
 
-                for (auto& itp_id : static_data_.sampled_image_load_ids) {
+                for (auto& itp_id : access_data.sampled_image_load_ids) {
                     // Find if image id match.
                     uint32_t image_index = 0;
-                    auto load_it = static_data_.load_members.find(itp_id.first);
-                    if (load_it == static_data_.load_members.end()) {
+                    auto load_it = access_data.load_members.find(itp_id.first);
+                    if (load_it == access_data.load_members.end()) {
                         continue;
                     } else {
                         if (load_it->second != interface_var.id) {
-                            auto accesschain_it = static_data_.accesschain_members.find(load_it->second);
-                            if (accesschain_it == static_data_.accesschain_members.end()) {
+                            auto accesschain_it = access_data.accesschain_members.find(load_it->second);
+                            if (accesschain_it == access_data.accesschain_members.end()) {
                                 continue;
                             } else {
                                 if (accesschain_it->second.first != interface_var.id) {
@@ -1287,15 +1418,15 @@ void SHADER_MODULE_STATE::FindVariableDescriptorType(bool is_storage_buffer, Int
                         }
                     }
                     // Find sampler's set binding.
-                    load_it = static_data_.load_members.find(itp_id.second);
-                    if (load_it == static_data_.load_members.end()) {
+                    load_it = access_data.load_members.find(itp_id.second);
+                    if (load_it == access_data.load_members.end()) {
                         continue;
                     } else {
                         uint32_t sampler_id = load_it->second;
                         uint32_t sampler_index = 0;
-                        auto accesschain_it = static_data_.accesschain_members.find(load_it->second);
+                        auto accesschain_it = access_data.accesschain_members.find(load_it->second);
 
-                        if (accesschain_it != static_data_.accesschain_members.end()) {
+                        if (accesschain_it != access_data.accesschain_members.end()) {
                             const Instruction* const_def = GetConstantDef(accesschain_it->second.second);
                             if (!const_def) {
                                 // access chain index representing sampler index is not a constant, skip.
@@ -1310,16 +1441,16 @@ void SHADER_MODULE_STATE::FindVariableDescriptorType(bool is_storage_buffer, Int
                         }
 
                         // Need to check again for these properties in case not using a combined image sampler
-                        if (CheckObjectIDFromOpLoad(sampler_id, static_data_.sampler_load_ids, static_data_.load_members,
-                                                    static_data_.accesschain_members) != 0) {
+                        if (CheckObjectIDFromOpLoad(sampler_id, access_data.sampler_load_ids, access_data.load_members,
+                                                    access_data.accesschain_members) != 0) {
                             interface_var.is_sampler_sampled = true;
                         }
-                        if (CheckObjectIDFromOpLoad(sampler_id, static_data_.sampler_implicitLod_dref_proj_load_ids,
-                                                    static_data_.load_members, static_data_.accesschain_members) != 0) {
+                        if (CheckObjectIDFromOpLoad(sampler_id, access_data.sampler_implicitLod_dref_proj_load_ids,
+                                                    access_data.load_members, access_data.accesschain_members) != 0) {
                             interface_var.is_sampler_implicitLod_dref_proj = true;
                         }
-                        if (CheckObjectIDFromOpLoad(sampler_id, static_data_.sampler_bias_offset_load_ids,
-                                                    static_data_.load_members, static_data_.accesschain_members) != 0) {
+                        if (CheckObjectIDFromOpLoad(sampler_id, access_data.sampler_bias_offset_load_ids,
+                                                    access_data.load_members, access_data.accesschain_members) != 0) {
                             interface_var.is_sampler_bias_offset = true;
                         }
 
@@ -1336,7 +1467,7 @@ void SHADER_MODULE_STATE::FindVariableDescriptorType(bool is_storage_buffer, Int
             if (GetDecorationSet(type->Word(1)).flags & DecorationSet::buffer_block_bit) {
                 is_storage_buffer = true;
             }
-            for (const Instruction* insn : static_data_.member_decoration_inst) {
+            for (const Instruction* insn : GetStaticData().member_decoration_inst) {
                 if (insn->Word(1) == type->Word(1) && insn->Word(3) == spv::DecorationNonWritable) {
                     nonwritable_members.insert(insn->Word(2));
                 }
@@ -1345,13 +1476,13 @@ void SHADER_MODULE_STATE::FindVariableDescriptorType(bool is_storage_buffer, Int
             // A buffer is writable if it's either flavor of storage buffer, and has any member not decorated
             // as nonwritable.
             if (is_storage_buffer && nonwritable_members.size() != type->Length() - 2) {
-                for (auto oid : static_data_.store_pointer_ids) {
+                for (auto oid : access_data.store_pointer_ids) {
                     if (interface_var.id == oid) {
                         interface_var.is_writable = true;
                         return;
                     }
-                    auto accesschain_it = static_data_.accesschain_members.find(oid);
-                    if (accesschain_it == static_data_.accesschain_members.end()) {
+                    auto accesschain_it = access_data.accesschain_members.find(oid);
+                    if (accesschain_it == access_data.accesschain_members.end()) {
                         continue;
                     }
                     if (accesschain_it->second.first == interface_var.id) {
@@ -1359,8 +1490,8 @@ void SHADER_MODULE_STATE::FindVariableDescriptorType(bool is_storage_buffer, Int
                         return;
                     }
                 }
-                if (CheckObjectIDFromOpLoad(interface_var.id, static_data_.atomic_store_pointer_ids,
-                                            static_data_.image_texel_pointer_members, static_data_.accesschain_members) != 0) {
+                if (CheckObjectIDFromOpLoad(interface_var.id, access_data.atomic_store_pointer_ids,
+                                            access_data.image_texel_pointer_members, access_data.accesschain_members) != 0) {
                     interface_var.is_writable = true;
                     return;
                 }
@@ -1466,7 +1597,7 @@ bool SHADER_MODULE_STATE::CollectInterfaceBlockMembers(std::map<location_t, Inte
     layer_data::unordered_map<uint32_t, uint32_t> member_patch;
 
     // Walk all the OpMemberDecorate for type's result id -- first pass, collect components.
-    for (const Instruction* insn : static_data_.member_decoration_inst) {
+    for (const Instruction* insn : GetStaticData().member_decoration_inst) {
         if (insn->Word(1) == type->Word(1)) {
             uint32_t member_index = insn->Word(2);
             uint32_t decoration = insn->Word(3);
@@ -1489,7 +1620,7 @@ bool SHADER_MODULE_STATE::CollectInterfaceBlockMembers(std::map<location_t, Inte
     // TODO: correctly handle location assignment from outside
 
     // Second pass -- produce the output, from Location decorations
-    for (const Instruction* insn : static_data_.member_decoration_inst) {
+    for (const Instruction* insn : GetStaticData().member_decoration_inst) {
         if (insn->Word(1) == type->Word(1)) {
             uint32_t member_index = insn->Word(2);
             uint32_t member_type_id = type->Word(2 + member_index);
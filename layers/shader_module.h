@@ -19,9 +19,12 @@
 #ifndef VULKAN_SHADER_MODULE_H
 #define VULKAN_SHADER_MODULE_H
 
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -230,13 +233,12 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         EntryPoint(const SHADER_MODULE_STATE &module_state, const Instruction &entrypoint);
     };
 
-    // Static/const data extracted from a SPIRV module at initialization time
-    // The goal of this struct is to move everything that is ready only into here
+    // Static/const data parsed from a SPIRV module the first time the module is inspected
     struct StaticData {
-        StaticData() = default;
         StaticData(const SHADER_MODULE_STATE &module_state);
-        StaticData &operator=(StaticData &&) = default;
-        StaticData(StaticData &&) = default;
+
+        // Approximate heap memory used, in bytes
+        size_t MemoryUsage() const;
 
         // List of all instructions in the order they appear in the binary
         std::vector<Instruction> instructions;
@@ -259,17 +261,32 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         // both OpDecorate and OpMemberDecorate builtin instructions
         std::vector<const Instruction *> builtin_decoration_inst;
         std::vector<const Instruction *> atomic_inst;
+        std::vector<const Instruction *> entry_point_inst;
         std::vector<spv::Capability> capability_list;
 
         bool has_specialization_constants{false};
         bool has_invocation_repack_instruction{false};
 
+        bool has_group_decoration{false};
+    };
+
+    // Entry points and the ids reachable from each of them, built the first time an entry point is looked up
+    struct EntryPointData {
+        EntryPointData(const SHADER_MODULE_STATE &module_state);
+
+        size_t MemoryUsage() const;
+
         std::vector<EntryPoint> entry_points;
+    };
 
-        bool has_group_decoration{false};
+    // Tracks accesses (load, store, atomic) to the instruction calling them, built the first time the descriptor types of the
+    // module's variables are needed
+    // Example: the OpLoad does the "access" but need to know if a OpImageRead uses that OpLoad later
+    struct AccessData {
+        AccessData(const SHADER_MODULE_STATE &module_state);
+
+        size_t MemoryUsage() const;
 
-        // Tracks accesses (load, store, atomic) to the instruction calling them
-        // Example: the OpLoad does the "access" but need to know if a OpImageRead uses that OpLoad later
         std::vector<uint32_t> image_read_load_ids;
         std::vector<uint32_t> image_write_load_ids;
         layer_data::unordered_map<const Instruction *, uint32_t> image_write_load_id_map;  // <OpImageWrite, load id>
@@ -286,50 +303,108 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         layer_data::unordered_map<uint32_t, uint32_t> image_texel_pointer_members;               // <result id, image>
     };
 
+    // Holds one of the above, built from the module at most once, on first use, by whichever thread gets there first.
+    // Modules created up front but never used by a pipeline never pay for parsing.
+    template <typename Data>
+    class LazyData {
+      public:
+        const Data &Get(const SHADER_MODULE_STATE &module_state) const {
+            if (!built_.load(std::memory_order_acquire)) {
+                std::call_once(once_, [this, &module_state]() {
+                    data_.reset(new Data(module_state));
+                    built_.store(true, std::memory_order_release);
+                });
+            }
+            return *data_;
+        }
+        // nullptr until built
+        const Data *Peek() const { return built_.load(std::memory_order_acquire) ? data_.get() : nullptr; }
+
+      private:
+        mutable std::once_flag once_;
+        mutable std::unique_ptr<Data> data_;
+        mutable std::atomic<bool> built_{false};
+    };
+
+    // SPIR-V words of a module and the data parsed from them. Nothing in here depends on the module handle, so modules created
+    // from identical code share a single instance, see SpirvDataStore.
+    struct SpirvData {
+        SpirvData() = default;
+        SpirvData(std::vector<uint32_t> &&spirv, spv_target_env env);
+        // For callers that already hashed spirv, which must not need preprocessing
+        SpirvData(std::vector<uint32_t> &&spirv, spv_target_env env, uint64_t spirv_hash);
+
+        const std::vector<uint32_t> words;
+        // XXH64 of words, so that caches keyed on the module content don't need to hash the words again
+        const uint64_t hash = 0;
+        LazyData<StaticData> static_data;
+        LazyData<EntryPointData> entry_point_data;
+        LazyData<AccessData> access_data;
+    };
+
+    // Approximate heap memory used by a module, in bytes. Data that has not been built is reported as zero.
+    struct MemoryUsage {
+        size_t words = 0;
+        size_t static_data = 0;
+        size_t entry_point_data = 0;
+        size_t access_data = 0;
+    };
+
+  private:
+    // Declared ahead of words_, which refers to it
+    const std::shared_ptr<const SpirvData> spirv_data_;
+
+  public:
     // This is the SPIR-V module data content
-    const std::vector<uint32_t> words_;
+    const std::vector<uint32_t> &words_;
 
     const bool has_valid_spirv{false};
-    const StaticData static_data_;
 
     uint32_t gpu_validation_shader_id{std::numeric_limits<uint32_t>::max()};
 
     SHADER_MODULE_STATE(const uint32_t *code, std::size_t count, spv_target_env env = SPV_ENV_VULKAN_1_0)
         : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
-          words_(code, code + (count / sizeof(uint32_t))),
-          static_data_(*this) {
-        PreprocessShaderBinary(env);
-    }
+          spirv_data_(std::make_shared<SpirvData>(std::vector<uint32_t>(code, code + (count / sizeof(uint32_t))), env)),
+          words_(spirv_data_->words) {}
 
     template <typename SpirvContainer>
     SHADER_MODULE_STATE(const SpirvContainer &spirv)
         : SHADER_MODULE_STATE(spirv.data(), spirv.size() * sizeof(typename SpirvContainer::value_type)) {}
 
-    SHADER_MODULE_STATE(const VkShaderModuleCreateInfo &create_info, VkShaderModule shaderModule, spv_target_env env,
-                        uint32_t unique_shader_id)
+    SHADER_MODULE_STATE(std::shared_ptr<const SpirvData> &&spirv_data, VkShaderModule shaderModule, uint32_t unique_shader_id)
         : BASE_NODE(shaderModule, kVulkanObjectTypeShaderModule),
-          words_(create_info.pCode, create_info.pCode + create_info.codeSize / sizeof(uint32_t)),
+          spirv_data_(std::move(spirv_data)),
+          words_(spirv_data_->words),
           has_valid_spirv(true),
-          static_data_(*this),
-          gpu_validation_shader_id(unique_shader_id) {
-        PreprocessShaderBinary(env);
-    }
+          gpu_validation_shader_id(unique_shader_id) {}
+
+    SHADER_MODULE_STATE()
+        : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
+          spirv_data_(std::make_shared<SpirvData>()),
+          words_(spirv_data_->words) {}
 
-    SHADER_MODULE_STATE() : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule) {}
+    const SpirvData &GetSpirvData() const { return *spirv_data_; }
+    const StaticData &GetStaticData() const { return spirv_data_->static_data.Get(*this); }
+    const EntryPointData &GetEntryPointData() const { return spirv_data_->entry_point_data.Get(*this); }
+    const AccessData &GetAccessData() const { return spirv_data_->access_data.Get(*this); }
+    MemoryUsage GetMemoryUsage() const;
 
     const Instruction *FindDef(uint32_t id) const {
-        auto it = static_data_.definitions.find(id);
-        if (it == static_data_.definitions.end()) return nullptr;
+        const auto &definitions = GetStaticData().definitions;
+        auto it = definitions.find(id);
+        if (it == definitions.end()) return nullptr;
         return it->second;
     }
 
-    const std::vector<Instruction> &GetInstructions() const { return static_data_.instructions; }
-    const std::vector<const Instruction *> &GetDecorationInstructions() const { return static_data_.decoration_inst; }
-    const std::vector<const Instruction *> &GetMemberDecorationInstructions() const { return static_data_.member_decoration_inst; }
-    const std::vector<const Instruction *> &GetAtomicInstructions() const { return static_data_.atomic_inst; }
-    const std::vector<const Instruction *> &GetVariableInstructions() const { return static_data_.variable_inst; }
+    const std::vector<Instruction> &GetInstructions() const { return GetStaticData().instructions; }
+    const std::vector<const Instruction *> &GetDecorationInstructions() const { return GetStaticData().decoration_inst; }
+    const std::vector<const Instruction *> &GetMemberDecorationInstructions() const {
+        return GetStaticData().member_decoration_inst;
+    }
+    const std::vector<const Instruction *> &GetAtomicInstructions() const { return GetStaticData().atomic_inst; }
+    const std::vector<const Instruction *> &GetVariableInstructions() const { return GetStaticData().variable_inst; }
     const layer_data::unordered_set<uint32_t> *GetAccessibleIds(const Instruction &entrypoint) const {
-        for (const auto &entry_point : static_data_.entry_points) {
+        for (const auto &entry_point : GetEntryPointData().entry_points) {
             if (entry_point.entrypoint_insn == entrypoint) {
                 return &entry_point.accessible_ids;
             }
@@ -338,24 +413,25 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
     }
 
     const layer_data::unordered_map<uint32_t, std::vector<const Instruction *>> &GetExecutionModeInstructions() const {
-        return static_data_.execution_mode_inst;
+        return GetStaticData().execution_mode_inst;
     }
 
-    const std::vector<const Instruction *> &GetBuiltinDecorationList() const { return static_data_.builtin_decoration_inst; }
+    const std::vector<const Instruction *> &GetBuiltinDecorationList() const { return GetStaticData().builtin_decoration_inst; }
 
-    const layer_data::unordered_map<uint32_t, uint32_t> &GetSpecConstMap() const { return static_data_.spec_const_map; }
+    const layer_data::unordered_map<uint32_t, uint32_t> &GetSpecConstMap() const { return GetStaticData().spec_const_map; }
 
-    bool HasSpecConstants() const { return static_data_.has_specialization_constants; }
-    bool HasInvocationRepackInstruction() const { return static_data_.has_invocation_repack_instruction; }
+    bool HasSpecConstants() const { return GetStaticData().has_specialization_constants; }
+    bool HasInvocationRepackInstruction() const { return GetStaticData().has_invocation_repack_instruction; }
 
-    bool HasMultipleEntryPoints() const { return static_data_.entry_points.size() > 1; }
+    bool HasMultipleEntryPoints() const { return GetStaticData().entry_point_inst.size() > 1; }
 
     VkShaderModule vk_shader_module() const { return handle_.Cast<VkShaderModule>(); }
 
     DecorationSet GetDecorationSet(uint32_t id) const {
         // return the actual decorations for this id, or a default set.
-        auto it = static_data_.decorations.find(id);
-        if (it != static_data_.decorations.end()) return it->second;
+        const auto &decorations = GetStaticData().decorations;
+        auto it = decorations.find(id);
+        if (it != decorations.end()) return it->second;
         return DecorationSet();
     }
 
@@ -409,12 +485,14 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
     uint32_t GetTexelComponentCount(const Instruction &insn) const;
 
     bool WritesToGlLayer() const {
-        return std::any_of(static_data_.builtin_decoration_inst.begin(), static_data_.builtin_decoration_inst.end(),
+        const auto &builtin_decoration_inst = GetStaticData().builtin_decoration_inst;
+        return std::any_of(builtin_decoration_inst.begin(), builtin_decoration_inst.end(),
                            [](const Instruction *insn) { return insn->GetBuiltIn() == spv::BuiltInLayer; });
     }
 
     bool HasInputAttachmentCapability() const {
-        return std::any_of(static_data_.capability_list.begin(), static_data_.capability_list.end(),
+        const auto &capability_list = GetStaticData().capability_list;
+        return std::any_of(capability_list.begin(), capability_list.end(),
                            [](const spv::Capability &capability) { return capability == spv::CapabilityInputAttachment; });
     }
 
@@ -423,10 +501,6 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
                                             std::vector<SHADER_MODULE_STATE::EntryPoint> &entry_points);
 
   private:
-    // Functions used for initialization only
-    // Used to populate the shader module object
-    void PreprocessShaderBinary(spv_target_env env);
-
     // The following are all helper functions to set the push constants values by tracking if the values are accessed in the entry
     // point functions and which offset in the structs are used
     uint32_t UpdateOffset(uint32_t offset, const std::vector<uint32_t> &array_indices, const StructInfo &data) const;
@@ -441,4 +515,22 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
                              const StructInfo &data) const;
 };
 
+// Device wide store of the SPIR-V given to vkCreateShaderModule and to shader stages created inline, keyed by a hash of the code.
+// Modules created from identical code share their words and parsed data. The store only holds weak references, so the data is
+// freed along with the last module using it.
+class SpirvDataStore {
+  public:
+    std::shared_ptr<const SHADER_MODULE_STATE::SpirvData> Get(const uint32_t *code, size_t word_count, spv_target_env env);
+
+  private:
+    using SpirvData = SHADER_MODULE_STATE::SpirvData;
+
+    void SweepExpired();
+
+    std::mutex lock_;
+    layer_data::unordered_map<uint64_t, std::vector<std::weak_ptr<const SpirvData>>> entries_;
+    size_t sweep_threshold_ = kMinSweepThreshold;
+    static constexpr size_t kMinSweepThreshold = 64;
+};
+
 #endif  // VULKAN_SHADER_MODULE_H
@@ -2810,6 +2810,164 @@ bool CoreChecks::ValidateImageWrite(const SHADER_MODULE_STATE &module_state, con
     return skip;
 }
 
+// Applies the specialization constant values to the module with spirv-opt, validates the specialized SPIR-V and gathers what
+// pipeline validation needs from the specialized module. Stages using the same module code with the same values share the result.
+std::shared_ptr<const SpecializedShaderResult> CoreChecks::SpecializeShaderModule(
+    const SHADER_MODULE_STATE &module_state, const std::unordered_map<uint32_t, std::vector<uint32_t>> &id_value_map) const {
+    // Hash the values in constant ID order, as the iteration order of the map depends on how it was filled
+    std::vector<uint32_t> constant_ids;
+    constant_ids.reserve(id_value_map.size());
+    for (const auto &entry : id_value_map) {
+        constant_ids.push_back(entry.first);
+    }
+    std::sort(constant_ids.begin(), constant_ids.end());
+    std::vector<uint32_t> specialization_words;
+    for (const uint32_t constant_id : constant_ids) {
+        const auto &value = id_value_map.at(constant_id);
+        specialization_words.push_back(constant_id);
+        specialization_words.push_back(static_cast<uint32_t>(value.size()));
+        specialization_words.insert(specialization_words.end(), value.begin(), value.end());
+    }
+    const SpecializedShaderCache::Key key{
+        XXH64(module_state.words_.data(), module_state.words_.size() * sizeof(uint32_t), 0),
+        XXH64(specialization_words.data(), specialization_words.size() * sizeof(uint32_t), 0)};
+    if (auto cached = specialized_shader_cache.Find(key)) {
+        return cached;
+    }
+
+    auto result = std::make_shared<SpecializedShaderResult>();
+
+    // both spirv-opt and spirv-val will use the same flags
+    spvtools::ValidatorOptions options;
+    AdjustValidatorOptions(device_extensions, enabled_features, options);
+
+    // setup the call back if the optimizer fails, the messages are logged by each stage using the result
+    spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+    spvtools::Optimizer optimizer(spirv_environment);
+    spvtools::MessageConsumer consumer = [&result](spv_message_level_t level, const char *source, const spv_position_t &position,
+                                                   const char *message) { result->optimizer_messages.emplace_back(message); };
+    optimizer.SetMessageConsumer(consumer);
+
+    if (!id_value_map.empty()) {
+        // This pass takes the runtime spec const values and applies it into the SPIR-V
+        // will turn a spec constant like
+        //     OpSpecConstant %uint 1
+        // to a use the value passed in instead (for example if the value is 32) so now it looks like
+        //     OpSpecConstant %uint 32
+        optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(id_value_map));
+    }
+
+    // This pass will turn OpSpecConstant into a OpConstant (also OpSpecConstantTrue/OpSpecConstantFalse)
+    optimizer.RegisterPass(spvtools::CreateFreezeSpecConstantValuePass());
+    // Using the new frozen OpConstant all OpSpecConstantComposite can be resolved turning them into OpConstantComposite
+    // This is need incase a shdaer looks like:
+    //
+    //     layout(constant_id = 0) const uint x = 64;
+    //     shared uint arr[x > 64 ? 64 : x];
+    //
+    // this will generate branch/switch statements that we want to leverage spirv-opt to apply to make parsing easier
+    optimizer.RegisterPass(spvtools::CreateFoldSpecConstantOpAndCompositePass());
+
+    // Apply the specialization-constant values and revalidate the shader module is valid.
+    std::vector<uint32_t> specialized_spirv;
+    result->optimized = optimizer.Run(module_state.words_.data(), module_state.words_.size(), &specialized_spirv, options, true);
+    if (result->optimized) {
+        // Specialized modules that passed spirv-val, in this run or a previous one, are recorded in the shader validation cache
+        // the same way as the modules given to vkCreateShaderModule
+        auto cache = CastFromHandle<ValidationCache *>(core_validation_cache);
+        const uint64_t specialized_hash =
+            cache ? ValidationCache::MakeShaderHash(specialized_spirv.data(), specialized_spirv.size()) : 0;
+        if (cache && cache->Contains(specialized_hash)) {
+            result->valid = true;
+        } else {
+            spv_context ctx = spvContextCreate(spirv_environment);
+            spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
+            spv_diagnostic diag = nullptr;
+            result->valid = spvValidateWithOptions(ctx, options, &binary, &diag) == SPV_SUCCESS;
+            if (result->valid && cache) {
+                cache->Insert(specialized_hash);
+            }
+            spvDiagnosticDestroy(diag);
+            spvContextDestroy(ctx);
+        }
+
+        // The new optimized SPIR-V will NOT match the original SHADER_MODULE_STATE object parsing, so a new SHADER_MODULE_STATE
+        // object is needed. This an issue due to each pipeline being able to reuse the same shader module but with different
+        // spec constant values.
+        SHADER_MODULE_STATE spec_mod(specialized_spirv);
+
+        // According to https://github.com/KhronosGroup/Vulkan-Docs/issues/1671 anything labeled as "static use" (such as if an
+        // input is used or not) don't have to be checked post spec constants freezing since the device compiler is not
+        // guaranteed to run things such as dead-code elimination. The following checks are things that don't follow under
+        // "static use" rules and need to be validated still.
+
+        // see ValidateComputeSharedMemory() for details why we might track max block size
+        layer_data::unordered_set<uint32_t> aliased_id;
+        bool find_max_block = false;
+
+        uint32_t workgroup_size_id = 0;  // result id can't be zero
+        uint32_t local_size_id_x = 0;
+        uint32_t local_size_id_y = 0;
+        uint32_t local_size_id_z = 0;
+
+        // make single interation through new shader
+        for (const Instruction &insn : spec_mod.GetInstructions()) {
+            const uint32_t opcode = insn.Opcode();
+
+            if (opcode == spv::OpExecutionModeId && insn.Word(2) == spv::ExecutionModeLocalSizeId) {
+                local_size_id_x = insn.Word(3);
+                local_size_id_y = insn.Word(4);
+                local_size_id_z = insn.Word(5);
+            }
+
+            if (opcode == spv::OpDecorate) {
+                // Validate applied WorkgroupSize is still below maxComputeWorkGroupSize limit
+                if (insn.Word(2) == spv::DecorationBuiltIn && insn.Word(3) == spv::BuiltInWorkgroupSize) {
+                    // Will be a OpConstantComposite and always have the OpDecorate section
+                    workgroup_size_id = insn.Word(1);
+                }
+                if (insn.Word(2) == spv::DecorationAliased) {
+                    aliased_id.emplace(insn.Word(1));
+                }
+            }
+
+            if (opcode == spv::OpConstantComposite && workgroup_size_id == insn.Word(2)) {
+                // VUID-WorkgroupSize-WorkgroupSize-04427 makes sure this is a OpTypeVector of int32 so this can be assuemd
+                result->local_size_x = spec_mod.FindDef(insn.Word(3))->Word(3);
+                result->local_size_y = spec_mod.FindDef(insn.Word(4))->Word(3);
+                result->local_size_z = spec_mod.FindDef(insn.Word(5))->Word(3);
+            }
+
+            if (opcode == spv::OpVariable && insn.StorageClass() == spv::StorageClassWorkgroup) {
+                if (aliased_id.find(insn.Word(2)) != aliased_id.end()) {
+                    find_max_block = true;
+                }
+
+                const uint32_t result_type_id = insn.Word(1);
+                const Instruction *result_type = spec_mod.FindDef(result_type_id);
+                const Instruction *type = spec_mod.FindDef(result_type->Word(3));
+                const uint32_t variable_shared_size = spec_mod.GetTypeBitsSize(type) / 8;
+
+                if (find_max_block) {
+                    result->total_shared_size = std::max(result->total_shared_size, variable_shared_size);
+                } else {
+                    result->total_shared_size += variable_shared_size;
+                }
+            }
+        }
+
+        // if after no WorkgroupSize is found, then can apply any possible LocalSizeId due to precedence order
+        if (result->local_size_x == 0 && local_size_id_x != 0) {
+            result->local_size_x = spec_mod.FindDef(local_size_id_x)->Word(3);
+            result->local_size_y = spec_mod.FindDef(local_size_id_y)->Word(3);
+            result->local_size_z = spec_mod.FindDef(local_size_id_z)->Word(3);
+        }
+    }
+
+    specialized_shader_cache.Insert(key, result);
+    return result;
+}
+
 bool CoreChecks::ValidatePipelineShaderStage(const PIPELINE_STATE &pipeline, const PipelineStageState &stage_state) const {
     bool skip = false;
     const auto *pStage = stage_state.create_info;
@@ -2836,31 +2994,14 @@ bool CoreChecks::ValidatePipelineShaderStage(const PIPELINE_STATE &pipeline, con
 
     // If specialization-constant instructions are present in the shader, the specializations should be applied.
     if (module_state.HasSpecConstants()) {
-        // both spirv-opt and spirv-val will use the same flags
-        spvtools::ValidatorOptions options;
-        AdjustValidatorOptions(device_extensions, enabled_features, options);
-
-        // setup the call back if the optimizer fails
-        spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
-        spvtools::Optimizer optimizer(spirv_environment);
-        spvtools::MessageConsumer consumer = [&skip, &module_state, &stage_state, this](
-                                                 spv_message_level_t level, const char *source, const spv_position_t &position,
-                                                 const char *message) {
-            skip |= LogError(device, "VUID-VkPipelineShaderStageCreateInfo-module-parameter",
-                             "%s does not contain valid spirv for stage %s. %s",
-                             report_data->FormatHandle(module_state.vk_shader_module()).c_str(),
-                             string_VkShaderStageFlagBits(stage_state.stage_flag), message);
-        };
-        optimizer.SetMessageConsumer(consumer);
-
         // The app might be using the default spec constant values, but if they pass values at runtime to the pipeline then need to
         // use those values to apply to the spec constants
+        std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;  // note: this must be std:: to work with spvtools
         if (pStage->pSpecializationInfo != nullptr && pStage->pSpecializationInfo->mapEntryCount > 0 &&
             pStage->pSpecializationInfo->pMapEntries != nullptr) {
             // Gather the specialization-constant values.
             auto const &specialization_info = pStage->pSpecializationInfo;
             auto const &specialization_data = reinterpret_cast<uint8_t const *>(specialization_info->pData);
-            std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;  // note: this must be std:: to work with spvtools
             id_value_map.reserve(specialization_info->mapEntryCount);
             for (auto i = 0u; i < specialization_info->mapEntryCount; ++i) {
                 auto const &map_entry = specialization_info->pMapEntries[i];
@@ -2910,119 +3051,29 @@ bool CoreChecks::ValidatePipelineShaderStage(const PIPELINE_STATE &pipeline, con
                     id_value_map.emplace(map_entry.constantID, std::move(entry_data));
                 }
             }
-
-            // This pass takes the runtime spec const values and applies it into the SPIR-V
-            // will turn a spec constant like
-            //     OpSpecConstant %uint 1
-            // to a use the value passed in instead (for example if the value is 32) so now it looks like
-            //     OpSpecConstant %uint 32
-            optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(id_value_map));
         }
 
-        // This pass will turn OpSpecConstant into a OpConstant (also OpSpecConstantTrue/OpSpecConstantFalse)
-        optimizer.RegisterPass(spvtools::CreateFreezeSpecConstantValuePass());
-        // Using the new frozen OpConstant all OpSpecConstantComposite can be resolved turning them into OpConstantComposite
-        // This is need incase a shdaer looks like:
-        //
-        //     layout(constant_id = 0) const uint x = 64;
-        //     shared uint arr[x > 64 ? 64 : x];
-        //
-        // this will generate branch/switch statements that we want to leverage spirv-opt to apply to make parsing easier
-        optimizer.RegisterPass(spvtools::CreateFoldSpecConstantOpAndCompositePass());
-
-        // Apply the specialization-constant values and revalidate the shader module is valid.
         const char *pSpecializationInfo_vuid = IsExtEnabled(device_extensions.vk_ext_shader_module_identifier)
                                ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
                                : "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06719";
-        std::vector<uint32_t> specialized_spirv;
-        auto const optimized =
-            optimizer.Run(module_state.words_.data(), module_state.words_.size(), &specialized_spirv, options, true);
-        if (optimized) {
-            spv_context ctx = spvContextCreate(spirv_environment);
-            spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
-            spv_diagnostic diag = nullptr;
-            auto const spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
-            if (spv_valid != SPV_SUCCESS) {
+        const auto specialized = SpecializeShaderModule(module_state, id_value_map);
+        for (const auto &message : specialized->optimizer_messages) {
+            skip |= LogError(device, "VUID-VkPipelineShaderStageCreateInfo-module-parameter",
+                             "%s does not contain valid spirv for stage %s. %s",
+                             report_data->FormatHandle(module_state.vk_shader_module()).c_str(),
+                             string_VkShaderStageFlagBits(stage_state.stage_flag), message.c_str());
+        }
+        if (specialized->optimized) {
+            if (!specialized->valid) {
                 skip |= LogError(device, pSpecializationInfo_vuid,
                                  "After specialization was applied, %s does not contain valid spirv for stage %s.",
                                  report_data->FormatHandle(module_state.vk_shader_module()).c_str(),
                                  string_VkShaderStageFlagBits(stage_state.stage_flag));
             }
-
-            // The new optimized SPIR-V will NOT match the original SHADER_MODULE_STATE object parsing, so a new SHADER_MODULE_STATE
-            // object is needed. This an issue due to each pipeline being able to reuse the same shader module but with different
-            // spec constant values.
-            SHADER_MODULE_STATE spec_mod(specialized_spirv);
-
-            // According to https://github.com/KhronosGroup/Vulkan-Docs/issues/1671 anything labeled as "static use" (such as if an
-            // input is used or not) don't have to be checked post spec constants freezing since the device compiler is not
-            // guaranteed to run things such as dead-code elimination. The following checks are things that don't follow under
-            // "static use" rules and need to be validated still.
-
-            // see ValidateComputeSharedMemory() for details why we might track max block size
-            layer_data::unordered_set<uint32_t> aliased_id;
-            bool find_max_block = false;
-
-            uint32_t workgroup_size_id = 0;  // result id can't be zero
-            uint32_t local_size_id_x = 0;
-            uint32_t local_size_id_y = 0;
-            uint32_t local_size_id_z = 0;
-
-            // make single interation through new shader
-            for (const Instruction &insn : spec_mod.GetInstructions()) {
-                const uint32_t opcode = insn.Opcode();
-
-                if (opcode == spv::OpExecutionModeId && insn.Word(2) == spv::ExecutionModeLocalSizeId) {
-                    local_size_id_x = insn.Word(3);
-                    local_size_id_y = insn.Word(4);
-                    local_size_id_z = insn.Word(5);
-                }
-
-                if (opcode == spv::OpDecorate) {
-                    // Validate applied WorkgroupSize is still below maxComputeWorkGroupSize limit
-                    if (insn.Word(2) == spv::DecorationBuiltIn && insn.Word(3) == spv::BuiltInWorkgroupSize) {
-                        // Will be a OpConstantComposite and always have the OpDecorate section
-                        workgroup_size_id = insn.Word(1);
-                    }
-                    if (insn.Word(2) == spv::DecorationAliased) {
-                        aliased_id.emplace(insn.Word(1));
-                    }
-                }
-
-                if (opcode == spv::OpConstantComposite && workgroup_size_id == insn.Word(2)) {
-                    // VUID-WorkgroupSize-WorkgroupSize-04427 makes sure this is a OpTypeVector of int32 so this can be assuemd
-                    local_size_x = spec_mod.FindDef(insn.Word(3))->Word(3);
-                    local_size_y = spec_mod.FindDef(insn.Word(4))->Word(3);
-                    local_size_z = spec_mod.FindDef(insn.Word(5))->Word(3);
-                }
-
-                if (opcode == spv::OpVariable && insn.StorageClass() == spv::StorageClassWorkgroup) {
-                    if (aliased_id.find(insn.Word(2)) != aliased_id.end()) {
-                        find_max_block = true;
-                    }
-
-                    const uint32_t result_type_id = insn.Word(1);
-                    const Instruction *result_type = spec_mod.FindDef(result_type_id);
-                    const Instruction *type = spec_mod.FindDef(result_type->Word(3));
-                    const uint32_t variable_shared_size = spec_mod.GetTypeBitsSize(type) / 8;
-
-                    if (find_max_block) {
-                        total_shared_size = std::max(total_shared_size, variable_shared_size);
-                    } else {
-                        total_shared_size += variable_shared_size;
-                    }
-                }
-            }
-
-            // if after no WorkgroupSize is found, then can apply any possible LocalSizeId due to precedence order
-            if (local_size_x == 0 && local_size_id_x != 0) {
-                local_size_x = spec_mod.FindDef(local_size_id_x)->Word(3);
-                local_size_y = spec_mod.FindDef(local_size_id_y)->Word(3);
-                local_size_z = spec_mod.FindDef(local_size_id_z)->Word(3);
-            }
-
-            spvDiagnosticDestroy(diag);
-            spvContextDestroy(ctx);
+            local_size_x = specialized->local_size_x;
+            local_size_y = specialized->local_size_y;
+            local_size_z = specialized->local_size_z;
+            total_shared_size = specialized->total_shared_size;
         } else {
             // Should never get here, but better then asserting
             skip |= LogError(device, pSpecializationInfo_vuid,
@@ -3323,6 +3374,20 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
     return skip;
 }
 
+// Key of the interface check between two stages in the validation cache
+uint64_t CoreChecks::InterfaceVerdictKey(const PipelineStageState &producer, uint32_t producer_id,
+                                         const PipelineStageState &consumer, uint32_t consumer_id) const {
+    const uint64_t key_data[] = {
+        producer.module_state->GetSpirvData().hash,
+        consumer.module_state->GetSpirvData().hash,
+        producer.entrypoint->Word(2),
+        consumer.entrypoint->Word(2),
+        (static_cast<uint64_t>(producer_id) << 32) | consumer_id,
+        enabled_features.core13.maintenance4,
+    };
+    return XXH3_64bits(key_data, sizeof(key_data));
+}
+
 // Validate that the shaders used by the given pipeline and store the active_slots
 //  that are actually used by the pipeline into pPipeline->active_slots
 bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE &pipeline) const {
@@ -3368,9 +3433,25 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE &pipel
                 producer.entrypoint) {
                 auto producer_id = GetShaderStageId(producer.stage_flag);
                 auto consumer_id = GetShaderStageId(consumer.stage_flag);
-                skip |= ValidateInterfaceBetweenStages(*producer.module_state.get(), *(producer.entrypoint),
-                                                       &shader_stage_attribs[producer_id], *consumer.module_state.get(),
-                                                       *(consumer.entrypoint), &shader_stage_attribs[consumer_id]);
+                // The interface check only depends on the code of both stages, so a clean verdict is kept in the validation
+                // cache and reused by later pipelines and runs
+                auto cache = CastFromHandle<ValidationCache *>(core_validation_cache);
+                const uint64_t verdict_key = cache ? InterfaceVerdictKey(producer, producer_id, consumer, consumer_id) : 0;
+                if (cache && cache->ContainsPipelineVerdict(verdict_key)) {
+                    continue;
+                }
+                LogMessageCapture capture;
+                {
+                    LogMessageCapture::Scope scope(capture);
+                    ValidateInterfaceBetweenStages(*producer.module_state.get(), *(producer.entrypoint),
+                                                   &shader_stage_attribs[producer_id], *consumer.module_state.get(),
+                                                   *(consumer.entrypoint), &shader_stage_attribs[consumer_id]);
+                }
+                // Only a check that logged nothing, with no message filtered out, is known to be clean
+                if (cache && capture.empty() && !capture.Filtered()) {
+                    cache->InsertPipelineVerdict(verdict_key);
+                }
+                skip |= capture.Report(report_data);
             }
         }
     }
@@ -3597,7 +3678,11 @@ bool CoreChecks::ValidateRayTracingPipeline(const PIPELINE_STATE &pipeline,
     return skip;
 }
 
-uint32_t ValidationCache::MakeShaderHash(VkShaderModuleCreateInfo const *smci) { return XXH32(smci->pCode, smci->codeSize, 0); }
+uint64_t ValidationCache::MakeShaderHash(VkShaderModuleCreateInfo const *smci) { return XXH3_64bits(smci->pCode, smci->codeSize); }
+
+uint64_t ValidationCache::MakeShaderHash(const uint32_t *words, size_t word_count) {
+    return XXH3_64bits(words, word_count * sizeof(uint32_t));
+}
 
 static ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *pCreateInfo) {
     const auto validation_cache_ci = LvlFindInChain<VkShaderModuleValidationCacheCreateInfoEXT>(pCreateInfo->pNext);
@@ -3623,7 +3708,7 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
                          "SPIR-V module not valid: Codesize must be a multiple of 4 but is %zu", pCreateInfo->codeSize);
     } else {
         auto cache = GetValidationCacheInfo(pCreateInfo);
-        uint32_t hash = 0;
+        uint64_t hash = 0;
         // If app isn't using a shader validation cache, use the default one from CoreChecks
         if (!cache) cache = CastFromHandle<ValidationCache *>(core_validation_cache);
         if (cache) {
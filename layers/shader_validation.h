@@ -23,6 +23,10 @@
 #define VULKAN_SHADER_VALIDATION_H
 
 #include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "vulkan/vulkan.h"
 #include <generated/spirv_tools_commit_id.h>
@@ -39,6 +43,10 @@ struct shader_stage_attributes {
     VkShaderStageFlags stage;
 };
 
+// Implementation of VK_EXT_validation_cache, also used by CoreChecks to persist results across runs. After the header defined
+// by the extension, the data holds the number of shader hashes and of pipeline interface verdicts, followed by the 64-bit
+// keys of each, in that order. The format version is folded into the header UUID along with the SPIRV-Tools commit, so data
+// written in another format or by another version of SPIRV-Tools is ignored.
 class ValidationCache {
   public:
     static VkValidationCacheEXT Create(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
@@ -48,55 +56,59 @@ class ValidationCache {
     }
 
     void Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
-        const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
-        auto size = headerSize;
-        if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < size) return;
+        if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < kHeaderSize + kCountsSize) return;
 
-        uint32_t const *data = (uint32_t const *)pCreateInfo->pInitialData;
-        if (data[0] != size) return;
-        if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
+        const auto *bytes = static_cast<const uint8_t *>(pCreateInfo->pInitialData);
+        uint32_t header[2];
+        std::memcpy(header, bytes, sizeof(header));
+        if (header[0] != kHeaderSize) return;
+        if (header[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
         uint8_t expected_uuid[VK_UUID_SIZE];
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, expected_uuid);
-        if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
+        MakeUuid(expected_uuid);
+        if (memcmp(bytes + sizeof(header), expected_uuid, VK_UUID_SIZE) != 0) return;  // different version or format
 
-        data = (uint32_t const *)(reinterpret_cast<uint8_t const *>(data) + headerSize);
+        uint32_t counts[2];
+        std::memcpy(counts, bytes + kHeaderSize, sizeof(counts));
+        const uint8_t *keys = bytes + kHeaderSize + kCountsSize;
+        const size_t available = (pCreateInfo->initialDataSize - kHeaderSize - kCountsSize) / sizeof(uint64_t);
+        const size_t shader_count = std::min<size_t>(counts[0], available);
+        const size_t pipeline_count = std::min<size_t>(counts[1], available - shader_count);
 
         auto guard = WriteLock();
-        for (; size < pCreateInfo->initialDataSize; data++, size += sizeof(uint32_t)) {
-            good_shader_hashes_.insert(*data);
-        }
+        ReadKeys(keys, shader_count, good_shader_hashes_);
+        ReadKeys(keys + shader_count * sizeof(uint64_t), pipeline_count, good_pipeline_verdicts_);
     }
 
     void Write(size_t *pDataSize, void *pData) {
-        const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
+        auto guard = ReadLock();
         if (!pData) {
-            *pDataSize = headerSize + good_shader_hashes_.size() * sizeof(uint32_t);
+            *pDataSize =
+                kHeaderSize + kCountsSize + (good_shader_hashes_.size() + good_pipeline_verdicts_.size()) * sizeof(uint64_t);
             return;
         }
 
-        if (*pDataSize < headerSize) {
+        if (*pDataSize < kHeaderSize + kCountsSize) {
             *pDataSize = 0;
             return;  // Too small for even the header!
         }
 
-        uint32_t *out = (uint32_t *)pData;
-        size_t actualSize = headerSize;
-
         // Write the header
-        *out++ = headerSize;
-        *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, reinterpret_cast<uint8_t *>(out));
-        out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
-
-        {
-            auto guard = ReadLock();
-            for (auto it = good_shader_hashes_.begin(); it != good_shader_hashes_.end() && actualSize < *pDataSize;
-                 it++, out++, actualSize += sizeof(uint32_t)) {
-                *out = *it;
-            }
-        }
+        auto *out = static_cast<uint8_t *>(pData);
+        const uint32_t header[2] = {kHeaderSize, VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT};
+        std::memcpy(out, header, sizeof(header));
+        MakeUuid(out + sizeof(header));
+
+        // Only whole keys are written, and the counts reflect what fits
+        const size_t capacity = (*pDataSize - kHeaderSize - kCountsSize) / sizeof(uint64_t);
+        const size_t shader_count = std::min(good_shader_hashes_.size(), capacity);
+        const size_t pipeline_count = std::min(good_pipeline_verdicts_.size(), capacity - shader_count);
+        const uint32_t counts[2] = {static_cast<uint32_t>(shader_count), static_cast<uint32_t>(pipeline_count)};
+        std::memcpy(out + kHeaderSize, counts, sizeof(counts));
+        out += kHeaderSize + kCountsSize;
+        out = WriteKeys(good_shader_hashes_, shader_count, out);
+        out = WriteKeys(good_pipeline_verdicts_, pipeline_count, out);
 
-        *pDataSize = actualSize;
+        *pDataSize = out - static_cast<uint8_t *>(pData);
     }
 
     void Merge(ValidationCache const *other) {
@@ -108,20 +120,34 @@ class ValidationCache {
         auto guard = WriteLock();
         good_shader_hashes_.reserve(good_shader_hashes_.size() + other->good_shader_hashes_.size());
         for (auto h : other->good_shader_hashes_) good_shader_hashes_.insert(h);
+        good_pipeline_verdicts_.reserve(good_pipeline_verdicts_.size() + other->good_pipeline_verdicts_.size());
+        for (auto h : other->good_pipeline_verdicts_) good_pipeline_verdicts_.insert(h);
     }
 
-    static uint32_t MakeShaderHash(VkShaderModuleCreateInfo const *smci);
+    static uint64_t MakeShaderHash(VkShaderModuleCreateInfo const *smci);
+    static uint64_t MakeShaderHash(const uint32_t *words, size_t word_count);
 
-    bool Contains(uint32_t hash) {
+    bool Contains(uint64_t hash) {
         auto guard = ReadLock();
         return good_shader_hashes_.count(hash) != 0;
     }
 
-    void Insert(uint32_t hash) {
+    void Insert(uint64_t hash) {
         auto guard = WriteLock();
         good_shader_hashes_.insert(hash);
     }
 
+    // Verdicts of pipeline checks that only depend on the shader code and a few pieces of state, keyed by a hash of all of them
+    bool ContainsPipelineVerdict(uint64_t key) {
+        auto guard = ReadLock();
+        return good_pipeline_verdicts_.count(key) != 0;
+    }
+
+    void InsertPipelineVerdict(uint64_t key) {
+        auto guard = WriteLock();
+        good_pipeline_verdicts_.insert(key);
+    }
+
   private:
     ValidationCache() {}
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
@@ -146,11 +172,93 @@ class ValidationCache {
         }
     }
 
+    void MakeUuid(uint8_t *uuid) {
+        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, uuid);
+        uuid[VK_UUID_SIZE - 1] ^= kFormatVersion;
+    }
+
+    static void ReadKeys(const uint8_t *keys, size_t count, layer_data::unordered_set<uint64_t> &set) {
+        set.reserve(set.size() + count);
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t key;
+            std::memcpy(&key, keys + i * sizeof(uint64_t), sizeof(key));
+            set.insert(key);
+        }
+    }
+
+    static uint8_t *WriteKeys(const layer_data::unordered_set<uint64_t> &set, size_t count, uint8_t *out) {
+        for (auto it = set.begin(); count > 0; ++it, --count, out += sizeof(uint64_t)) {
+            const uint64_t key = *it;
+            std::memcpy(out, &key, sizeof(key));
+        }
+        return out;
+    }
+
+    static constexpr uint32_t kHeaderSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // header size + version number + UUID
+    static constexpr size_t kCountsSize = 2 * sizeof(uint32_t);
+    // Version 1 was a flat list of 32-bit shader hashes
+    static constexpr uint8_t kFormatVersion = 2;
+
     // hashes of shaders that have passed validation before, and can be skipped.
     // we don't store negative results, as we would have to also store what was
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
-    layer_data::unordered_set<uint32_t> good_shader_hashes_;
+    layer_data::unordered_set<uint64_t> good_shader_hashes_;
+    // same for pipeline checks that found nothing to report
+    layer_data::unordered_set<uint64_t> good_pipeline_verdicts_;
+    mutable std::shared_mutex lock_;
+};
+
+// Outcome of applying specialization constants to a shader module with spirv-opt and validating the specialized SPIR-V,
+// along with the values pipeline validation needs from the specialized module.
+struct SpecializedShaderResult {
+    bool optimized = false;
+    bool valid = false;
+    // errors reported by spirv-opt while specializing, replayed for every stage using the result
+    std::vector<std::string> optimizer_messages;
+    uint32_t local_size_x = 0;
+    uint32_t local_size_y = 0;
+    uint32_t local_size_z = 0;
+    uint32_t total_shared_size = 0;
+};
+
+// Pipelines commonly reuse a shader module with the same specialization data, and specializing and revalidating the module
+// is by far the most expensive part of validating a stage. Results are kept per device, keyed by a hash of the module code
+// and a hash of the specialization constant values.
+class SpecializedShaderCache {
+  public:
+    struct Key {
+        uint64_t module_hash;
+        uint64_t specialization_hash;
+        bool operator==(const Key &other) const {
+            return module_hash == other.module_hash && specialization_hash == other.specialization_hash;
+        }
+    };
+
+    std::shared_ptr<const SpecializedShaderResult> Find(const Key &key) const {
+        ReadLockGuard guard(lock_);
+        const auto it = results_.find(key);
+        return it != results_.end() ? it->second : nullptr;
+    }
+
+    void Insert(const Key &key, std::shared_ptr<const SpecializedShaderResult> result) {
+        WriteLockGuard guard(lock_);
+        // Entries are never tied to a module handle, so bound the cache instead of tracking module destruction
+        if (results_.size() >= kMaxEntries) {
+            results_.clear();
+        }
+        results_.emplace(key, std::move(result));
+    }
+
+  private:
+    struct KeyHash {
+        size_t operator()(const Key &key) const {
+            return static_cast<size_t>(key.module_hash ^ (key.specialization_hash * 0x9e3779b97f4a7c15ULL));
+        }
+    };
+
+    static constexpr size_t kMaxEntries = 4096;
+    layer_data::unordered_map<Key, std::shared_ptr<const SpecializedShaderResult>, KeyHash> results_;
     mutable std::shared_mutex lock_;
 };
 
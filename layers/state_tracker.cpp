@@ -24,9 +24,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <sstream>
 
 #include "vk_enum_string_helper.h"
 #include "vk_format_utils.h"
+#include "vk_layer_config.h"
 #include "vk_layer_data.h"
 #include "vk_layer_utils.h"
 #include "vk_layer_logging.h"
@@ -368,7 +370,9 @@ void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const V
             WriteLockGuard guard(buffer_address_lock_);
             // address is used for GPU-AV and ray tracing buffer validation
             buffer_state->deviceAddress = opaque_capture_address->opaqueCaptureAddress;
-            buffer_address_map_.insert({buffer_state->DeviceAddressRange(), buffer_state});
+            if (buffer_address_map_.insert({buffer_state->DeviceAddressRange(), buffer_state}).second) {
+                buffer_address_map_version_++;
+            }
         }
 
         const VkBufferUsageFlags descriptor_buffer_usages =
@@ -481,7 +485,11 @@ void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffe
     auto buffer_state = Get<BUFFER_STATE>(buffer);
     if (buffer_state) {
         WriteLockGuard guard(buffer_address_lock_);
+        const auto address_map_size = buffer_address_map_.size();
         buffer_address_map_.erase_range(buffer_state->DeviceAddressRange());
+        if (buffer_address_map_.size() != address_map_size) {
+            buffer_address_map_version_++;
+        }
 
         const VkBufferUsageFlags descriptor_buffer_usages =
             VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
@@ -643,6 +651,9 @@ std::shared_ptr<QUEUE_STATE> ValidationStateTracker::CreateQueue(VkQueue q, uint
 }
 
 void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
+    worker_pool_ = WorkerPool::Shared();
+    spirv_data_store_ = std::make_shared<SpirvDataStore>();
+
     const VkPhysicalDeviceFeatures *enabled_features_found = pCreateInfo->pEnabledFeatures;
     if (nullptr == enabled_features_found) {
         const auto *features2 = LvlFindInChain<VkPhysicalDeviceFeatures2>(pCreateInfo->pNext);
@@ -1590,9 +1601,94 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
     }
 }
 
+void ValidationStateTracker::ReportStateMapContention() const {
+    if (!vl_concurrent_map_config::Get().collect_stats) return;
+
+    std::ostringstream report;
+    queue_map_.ReportContention("queue_map_", report);
+    acceleration_structure_nv_map_.ReportContention("acceleration_structure_nv_map_", report);
+    render_pass_map_.ReportContention("render_pass_map_", report);
+    descriptor_set_layout_map_.ReportContention("descriptor_set_layout_map_", report);
+    sampler_map_.ReportContention("sampler_map_", report);
+    image_view_map_.ReportContention("image_view_map_", report);
+    image_map_.ReportContention("image_map_", report);
+    buffer_view_map_.ReportContention("buffer_view_map_", report);
+    buffer_map_.ReportContention("buffer_map_", report);
+    pipeline_map_.ReportContention("pipeline_map_", report);
+    mem_obj_map_.ReportContention("mem_obj_map_", report);
+    frame_buffer_map_.ReportContention("frame_buffer_map_", report);
+    shader_module_map_.ReportContention("shader_module_map_", report);
+    desc_template_map_.ReportContention("desc_template_map_", report);
+    swapchain_map_.ReportContention("swapchain_map_", report);
+    descriptor_pool_map_.ReportContention("descriptor_pool_map_", report);
+    descriptor_set_map_.ReportContention("descriptor_set_map_", report);
+    command_buffer_map_.ReportContention("command_buffer_map_", report);
+    command_pool_map_.ReportContention("command_pool_map_", report);
+    pipeline_layout_map_.ReportContention("pipeline_layout_map_", report);
+    fence_map_.ReportContention("fence_map_", report);
+    query_pool_map_.ReportContention("query_pool_map_", report);
+    semaphore_map_.ReportContention("semaphore_map_", report);
+    event_map_.ReportContention("event_map_", report);
+    sampler_ycbcr_conversion_map_.ReportContention("sampler_ycbcr_conversion_map_", report);
+    acceleration_structure_khr_map_.ReportContention("acceleration_structure_khr_map_", report);
+    ahb_ext_formats_map.ReportContention("ahb_ext_formats_map", report);
+
+    const std::string text = report.str();
+    if (!text.empty()) {
+        LogInfo(device, "UNASSIGNED-concurrent-map-contention", "State tracker map lock contention:\n%s", text.c_str());
+    }
+}
+
+void ValidationStateTracker::ReportShaderModuleMemory() const {
+    static const bool enabled =
+        GetBoolSetting("VK_LAYER_SHADER_MODULE_MEMORY_REPORT", "khronos_validation.shader_module_memory_report");
+    if (!enabled) return;
+
+    // Modules destroyed by the application are kept alive by the pipelines using them
+    layer_data::unordered_set<const SHADER_MODULE_STATE *> modules;
+    for (const auto &entry : shader_module_map_.snapshot()) {
+        modules.insert(entry.second.get());
+    }
+    for (const auto &entry : pipeline_map_.snapshot()) {
+        for (const auto &stage : entry.second->stage_state) {
+            if (stage.module_state) {
+                modules.insert(stage.module_state.get());
+            }
+        }
+    }
+
+    // Modules created from identical SPIR-V share their words and parsed data, which is only counted once
+    layer_data::unordered_set<const SHADER_MODULE_STATE::SpirvData *> spirv_data;
+    SHADER_MODULE_STATE::MemoryUsage total;
+    size_t static_data_count = 0;
+    size_t entry_point_data_count = 0;
+    size_t access_data_count = 0;
+    for (const SHADER_MODULE_STATE *module_state : modules) {
+        if (!spirv_data.insert(&module_state->GetSpirvData()).second) continue;
+        const auto usage = module_state->GetMemoryUsage();
+        total.words += usage.words;
+        total.static_data += usage.static_data;
+        total.entry_point_data += usage.entry_point_data;
+        total.access_data += usage.access_data;
+        static_data_count += (usage.static_data != 0) ? 1 : 0;
+        entry_point_data_count += (usage.entry_point_data != 0) ? 1 : 0;
+        access_data_count += (usage.access_data != 0) ? 1 : 0;
+    }
+
+    LogInfo(device, "UNASSIGNED-shader-module-memory",
+            "%zu shader modules share %zu distinct SPIR-V modules using %zu KiB. Parsed data: %zu with instructions (%zu KiB), "
+            "%zu with entry points (%zu KiB), %zu with access tracking (%zu KiB).",
+            modules.size(), spirv_data.size(), total.words / 1024, static_data_count, total.static_data / 1024,
+            entry_point_data_count, total.entry_point_data / 1024, access_data_count, total.access_data / 1024);
+}
+
 void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     if (!device) return;
 
+    ReportStateMapContention();
+    ReportShaderModuleMemory();
+    worker_pool_.reset();
+
     command_pool_map_.clear();
     assert(command_buffer_map_.empty());
     pipeline_map_.clear();
@@ -1769,6 +1865,29 @@ void ValidationStateTracker::PreCallRecordFreeMemory(VkDevice device, VkDeviceMe
     Destroy<DEVICE_MEMORY_STATE>(mem);
 }
 
+void ValidationStateTracker::NotifyDescriptorSets(const BASE_NODE &node) {
+    if (node.BindlessReferenced()) {
+        bindless_resource_generation_++;
+    }
+    for (const auto &item : node.ObjectBindings()) {
+        auto parent = item.second.lock();
+        if (!parent || parent->Destroyed()) {
+            continue;
+        }
+        switch (parent->Type()) {
+            case kVulkanObjectTypeDescriptorSet:
+                static_cast<cvdescriptorset::DescriptorSet *>(parent.get())->NotifyReferencedObjectChanged();
+                break;
+            case kVulkanObjectTypeCommandBuffer:
+                break;
+            default:
+                // Views of an image or buffer, and resources bound to a memory object
+                NotifyDescriptorSets(*parent);
+                break;
+        }
+    }
+}
+
 void ValidationStateTracker::PreCallRecordQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo *pBindInfo,
                                                           VkFence fence) {
     auto queue_state = Get<QUEUE_STATE>(queue);
@@ -1788,6 +1907,10 @@ void ValidationStateTracker::PreCallRecordQueueBindSparse(VkQueue queue, uint32_
                                              sparse_binding.resourceOffset, sparse_binding.size);
                 }
             }
+            // Rebinding sparse memory can make the descriptors validated before valid or invalid
+            if (auto buffer_state = Get<BUFFER_STATE>(bind_info.pBufferBinds[j].buffer)) {
+                NotifyDescriptorSets(*buffer_state);
+            }
         }
         for (uint32_t j = 0; j < bind_info.imageOpaqueBindCount; j++) {
             for (uint32_t k = 0; k < bind_info.pImageOpaqueBinds[j].bindCount; k++) {
@@ -1805,6 +1928,9 @@ void ValidationStateTracker::PreCallRecordQueueBindSparse(VkQueue queue, uint32_
                                             sparse_binding.resourceOffset, sparse_binding.size);
                 }
             }
+            if (auto image_state = Get<IMAGE_STATE>(bind_info.pImageOpaqueBinds[j].image)) {
+                NotifyDescriptorSets(*image_state);
+            }
         }
         for (uint32_t j = 0; j < bind_info.imageBindCount; j++) {
             for (uint32_t k = 0; k < bind_info.pImageBinds[j].bindCount; k++) {
@@ -1824,6 +1950,9 @@ void ValidationStateTracker::PreCallRecordQueueBindSparse(VkQueue queue, uint32_
                     image_state->BindMemory(image_state.get(), mem_state, sparse_binding.memoryOffset, offset, size);
                 }
             }
+            if (auto image_state = Get<IMAGE_STATE>(bind_info.pImageBinds[j].image)) {
+                NotifyDescriptorSets(*image_state);
+            }
         }
         auto timeline_info = LvlFindInChain<VkTimelineSemaphoreSubmitInfo>(bind_info.pNext);
         CB_SUBMISSION submission;
@@ -1847,7 +1976,6 @@ void ValidationStateTracker::PreCallRecordQueueBindSparse(VkQueue queue, uint32_
         auto submit_seq = queue_state->Submit(std::move(submission));
         early_retire_seq = std::max(early_retire_seq, submit_seq);
     }
-
     if (early_retire_seq) {
         queue_state->NotifyAndWait(early_retire_seq);
     }
@@ -4612,8 +4740,11 @@ std::shared_ptr<SHADER_MODULE_STATE> ValidationStateTracker::CreateShaderModuleS
                                                                                      VkShaderModule handle) const {
     spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
     bool is_spirv = (create_info.pCode[0] == spv::MagicNumber);
-    return is_spirv ? std::make_shared<SHADER_MODULE_STATE>(create_info, handle, spirv_environment, unique_shader_id)
-                    : std::make_shared<SHADER_MODULE_STATE>();
+    if (!is_spirv) {
+        return std::make_shared<SHADER_MODULE_STATE>();
+    }
+    auto spirv_data = spirv_data_store_->Get(create_info.pCode, create_info.codeSize / sizeof(uint32_t), spirv_environment);
+    return std::make_shared<SHADER_MODULE_STATE>(std::move(spirv_data), handle, unique_shader_id);
 }
 
 void ValidationStateTracker::PostCallRecordCmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer,
@@ -5224,7 +5355,10 @@ void ValidationStateTracker::RecordGetBufferDeviceAddress(const VkBufferDeviceAd
         WriteLockGuard guard(buffer_address_lock_);
         // address is used for GPU-AV and ray tracing buffer validation
         buffer_state->deviceAddress = address;
-        buffer_address_map_.insert({buffer_state->DeviceAddressRange(), buffer_state});
+        // Applications commonly query the same address repeatedly, which leaves the map unchanged
+        if (buffer_address_map_.insert({buffer_state->DeviceAddressRange(), buffer_state}).second) {
+            buffer_address_map_version_++;
+        }
     }
 }
 
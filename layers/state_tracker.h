@@ -39,6 +39,7 @@
 #include "vk_layer_data.h"
 #include "android_ndk_types.h"
 #include "range_vector.h"
+#include "worker_pool.h"
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -131,8 +132,8 @@ struct create_buffer_api_state {
     VkBufferCreateInfo modified_create_info;
 };
 
-#define VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, instance_scope) \
-    vl_concurrent_unordered_map<handle_type, std::shared_ptr<state_type>> map_member; \
+#define VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, instance_scope, map_template) \
+    map_template<handle_type, std::shared_ptr<state_type>> map_member; \
     template <typename Dummy> \
     struct MapTraits<state_type, Dummy> { \
         static constexpr bool kInstanceScope = instance_scope; \
@@ -141,9 +142,13 @@ struct create_buffer_api_state {
     };
 
 #define VALSTATETRACK_MAP_AND_TRAITS(handle_type, state_type, map_member) \
-    VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, false)
+    VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, false, vl_concurrent_unordered_map)
 #define VALSTATETRACK_MAP_AND_TRAITS_INSTANCE_SCOPE(handle_type, state_type, map_member) \
-    VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, true)
+    VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, true, vl_concurrent_read_mostly_map)
+// For objects that are looked up on (nearly) every command but rarely created or destroyed. Lookups are lock-free,
+// see vl_concurrent_read_mostly_map.
+#define VALSTATETRACK_READ_MOSTLY_MAP_AND_TRAITS(handle_type, state_type, map_member) \
+    VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, false, vl_concurrent_read_mostly_map)
 
 namespace state_object {
 // Traits for State function resolution.  Specializations defined in the macros below.
@@ -269,6 +274,7 @@ enum PushConstantByteState {
 };
 
 struct SHADER_MODULE_STATE;
+class SpirvDataStore;
 
 VALSTATETRACK_STATE_OBJECT(VkQueue, QUEUE_STATE);
 VALSTATETRACK_STATE_OBJECT(VkAccelerationStructureNV, ACCELERATION_STRUCTURE_STATE)
@@ -322,6 +328,19 @@ class ValidationStateTracker : public ValidationObject {
         return (MapTraits::kInstanceScope && (this->*map_member).size() == 0) ? instance_state->*map_member : this->*map_member;
     }
 
+    template <typename BaseType>
+    static constexpr bool InvalidatesDescriptors() {
+        return std::is_same<BaseType, BUFFER_STATE>::value || std::is_same<BaseType, BUFFER_VIEW_STATE>::value ||
+               std::is_same<BaseType, IMAGE_STATE>::value || std::is_same<BaseType, IMAGE_VIEW_STATE>::value ||
+               std::is_same<BaseType, SAMPLER_STATE>::value || std::is_same<BaseType, DEVICE_MEMORY_STATE>::value ||
+               std::is_same<BaseType, ACCELERATION_STRUCTURE_STATE>::value ||
+               std::is_same<BaseType, ACCELERATION_STRUCTURE_STATE_KHR>::value;
+    }
+    std::atomic<uint64_t> bindless_resource_generation_{1};
+    std::shared_ptr<WorkerPool> worker_pool_;
+    // Shares the words and parsed data of shader modules created from identical SPIR-V
+    std::shared_ptr<SpirvDataStore> spirv_data_store_;
+
   public:
     template <typename State, typename HandleType = typename state_object::Traits<State>::HandleType>
     void Add(std::shared_ptr<State>&& state_object) {
@@ -338,10 +357,25 @@ class ValidationStateTracker : public ValidationObject {
         auto& map = GetStateMap<State>();
         auto iter = map.pop(handle);
         if (iter != map.end()) {
+            // Before Destroy() unlinks the object from the descriptor sets referencing it
+            if (InvalidatesDescriptors<typename Traits::BaseType>()) {
+                NotifyDescriptorSets(*iter->second);
+            }
             iter->second->Destroy();
         }
     }
 
+    // Bumps the change count of the descriptor sets referencing node, directly or through a view or a resource bound to it, so
+    // that submit time descriptor validation revalidates the draws using them. Bindless descriptors don't link their set to
+    // the objects they reference, so if one may reference node, BindlessResourceGeneration() changes instead.
+    void NotifyDescriptorSets(const BASE_NODE& node);
+
+    // Changes whenever an object that was written to a bindless descriptor is destroyed or has sparse memory bound
+    uint64_t BindlessResourceGeneration() const { return bindless_resource_generation_.load(); }
+
+    // Shared pool for read-only validation work, nullptr when submit_validation_threads is 0 or 1
+    WorkerPool* GetWorkerPool() const { return worker_pool_.get(); }
+
     template <typename State>
     size_t Count() const {
         return GetStateMap<State>().size();
@@ -466,8 +500,12 @@ class ValidationStateTracker : public ValidationObject {
     }
 
     using BufferAddressRange = sparse_container::range<VkDeviceAddress>;
-    std::vector<BufferAddressRange> GetBufferAddressRanges() const {
+    // Returns the sorted address ranges, and optionally the BufferAddressMapVersion() they correspond to
+    std::vector<BufferAddressRange> GetBufferAddressRanges(uint64_t* version = nullptr) const {
         ReadLockGuard guard(buffer_address_lock_);
+        if (version) {
+            *version = buffer_address_map_version_.load();
+        }
         std::vector<BufferAddressRange> result;
         result.reserve(buffer_address_map_.size());
         for (const auto& entry : buffer_address_map_) {
@@ -476,6 +514,9 @@ class ValidationStateTracker : public ValidationObject {
         return result;
     }
 
+    // Changes whenever a range is added to or removed from the buffer device address map
+    uint64_t BufferAddressMapVersion() const { return buffer_address_map_version_.load(); }
+
     using SetImageViewInitialLayoutCallback = std::function<void(CMD_BUFFER_STATE*, const IMAGE_VIEW_STATE&, VkImageLayout)>;
     template <typename Fn>
     void SetSetImageViewInitialLayoutCallback(Fn&& fn) {
@@ -615,6 +656,10 @@ class ValidationStateTracker : public ValidationObject {
     virtual void CreateDevice(const VkDeviceCreateInfo* pCreateInfo);
 
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) override;
+    // Logs the lock contention counters of the state maps, see vl_concurrent_map_config.
+    void ReportStateMapContention() const;
+    // Logs the memory used by the shader modules still alive, if the shader_module_memory_report setting is enabled.
+    void ReportShaderModuleMemory() const;
 
     void PostCallRecordCreateAccelerationStructureNV(VkDevice device, const VkAccelerationStructureCreateInfoNV* pCreateInfo,
                                                      const VkAllocationCallbacks* pAllocator,
@@ -1481,6 +1526,8 @@ class ValidationStateTracker : public ValidationObject {
     // If vkGetBufferDeviceAddress is called, keep track of buffer <-> address mapping.
     sparse_container::range_map<VkDeviceAddress, std::shared_ptr<BUFFER_STATE>> buffer_address_map_;
     mutable std::shared_mutex buffer_address_lock_;
+    // Only changed with buffer_address_lock_ held for writing
+    std::atomic<uint64_t> buffer_address_map_version_{0};
 
     vl_concurrent_unordered_map<uint64_t, VkFormatFeatureFlags2KHR> ahb_ext_formats_map;
     std::atomic<VkDeviceSize> descriptorBufferAddressSpaceSize = {0u};
@@ -1488,31 +1535,33 @@ class ValidationStateTracker : public ValidationObject {
     std::atomic<VkDeviceSize> samplerDescriptorBufferAddressSpaceSize = {0u};
 
   private:
-    VALSTATETRACK_MAP_AND_TRAITS(VkQueue, QUEUE_STATE, queue_map_)
+    VALSTATETRACK_READ_MOSTLY_MAP_AND_TRAITS(VkQueue, QUEUE_STATE, queue_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkAccelerationStructureNV, ACCELERATION_STRUCTURE_STATE, acceleration_structure_nv_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkRenderPass, RENDER_PASS_STATE, render_pass_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorSetLayout, cvdescriptorset::DescriptorSetLayout, descriptor_set_layout_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkSampler, SAMPLER_STATE, sampler_map_)
+    VALSTATETRACK_READ_MOSTLY_MAP_AND_TRAITS(VkRenderPass, RENDER_PASS_STATE, render_pass_map_)
+    VALSTATETRACK_READ_MOSTLY_MAP_AND_TRAITS(VkDescriptorSetLayout, cvdescriptorset::DescriptorSetLayout,
+                                             descriptor_set_layout_map_)
+    VALSTATETRACK_READ_MOSTLY_MAP_AND_TRAITS(VkSampler, SAMPLER_STATE, sampler_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkImageView, IMAGE_VIEW_STATE, image_view_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkImage, IMAGE_STATE, image_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkBufferView, BUFFER_VIEW_STATE, buffer_view_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkBuffer, BUFFER_STATE, buffer_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkPipeline, PIPELINE_STATE, pipeline_map_)
+    VALSTATETRACK_READ_MOSTLY_MAP_AND_TRAITS(VkPipeline, PIPELINE_STATE, pipeline_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkDeviceMemory, DEVICE_MEMORY_STATE, mem_obj_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkFramebuffer, FRAMEBUFFER_STATE, frame_buffer_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkShaderModule, SHADER_MODULE_STATE, shader_module_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorUpdateTemplate, UPDATE_TEMPLATE_STATE, desc_template_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkSwapchainKHR, SWAPCHAIN_NODE, swapchain_map_)
+    VALSTATETRACK_READ_MOSTLY_MAP_AND_TRAITS(VkShaderModule, SHADER_MODULE_STATE, shader_module_map_)
+    VALSTATETRACK_READ_MOSTLY_MAP_AND_TRAITS(VkDescriptorUpdateTemplate, UPDATE_TEMPLATE_STATE, desc_template_map_)
+    VALSTATETRACK_READ_MOSTLY_MAP_AND_TRAITS(VkSwapchainKHR, SWAPCHAIN_NODE, swapchain_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorPool, DESCRIPTOR_POOL_STATE, descriptor_pool_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkDescriptorSet, cvdescriptorset::DescriptorSet, descriptor_set_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkCommandBuffer, CMD_BUFFER_STATE, command_buffer_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkCommandPool, COMMAND_POOL_STATE, command_pool_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkPipelineLayout, PIPELINE_LAYOUT_STATE, pipeline_layout_map_)
+    VALSTATETRACK_READ_MOSTLY_MAP_AND_TRAITS(VkCommandBuffer, CMD_BUFFER_STATE, command_buffer_map_)
+    VALSTATETRACK_READ_MOSTLY_MAP_AND_TRAITS(VkCommandPool, COMMAND_POOL_STATE, command_pool_map_)
+    VALSTATETRACK_READ_MOSTLY_MAP_AND_TRAITS(VkPipelineLayout, PIPELINE_LAYOUT_STATE, pipeline_layout_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkFence, FENCE_STATE, fence_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkQueryPool, QUERY_POOL_STATE, query_pool_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkSemaphore, SEMAPHORE_STATE, semaphore_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkEvent, EVENT_STATE, event_map_)
-    VALSTATETRACK_MAP_AND_TRAITS(VkSamplerYcbcrConversion, SAMPLER_YCBCR_CONVERSION_STATE, sampler_ycbcr_conversion_map_)
+    VALSTATETRACK_READ_MOSTLY_MAP_AND_TRAITS(VkSamplerYcbcrConversion, SAMPLER_YCBCR_CONVERSION_STATE,
+                                             sampler_ycbcr_conversion_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkAccelerationStructureKHR, ACCELERATION_STRUCTURE_STATE_KHR, acceleration_structure_khr_map_)
     VALSTATETRACK_MAP_AND_TRAITS_INSTANCE_SCOPE(VkSurfaceKHR, SURFACE_STATE, surface_map_)
     VALSTATETRACK_MAP_AND_TRAITS_INSTANCE_SCOPE(VkDisplayModeKHR, DISPLAY_MODE_STATE, display_mode_map_)
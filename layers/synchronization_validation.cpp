@@ -20,13 +20,14 @@
  */
 
 #include <algorithm>
-#include <bitset>
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <vector>
 
 #include "synchronization_validation.h"
 #include "sync_utils.h"
+#include "vk_layer_config.h"
 
 // Utilities to DRY up Get... calls
 template <typename Map, typename Key = typename Map::key_type, typename RetVal = layer_data::optional<typename Map::mapped_type>>
@@ -186,14 +187,8 @@ static const char *string_SyncHazard(SyncHazard hazard) {
 
 static const SyncStageAccessInfoType *SyncStageAccessInfoFromMask(SyncStageAccessFlags flags) {
     // Return the info for the first bit found
-    const SyncStageAccessInfoType *info = nullptr;
-    for (size_t i = 0; i < flags.size(); i++) {
-        if (flags.test(i)) {
-            info = &syncStageAccessInfoByStageAccessIndex[i];
-            break;
-        }
-    }
-    return info;
+    const size_t index = flags.FirstIndex();
+    return index < syncStageAccessInfoByStageAccessIndex.size() ? &syncStageAccessInfoByStageAccessIndex[index] : nullptr;
 }
 
 static std::string string_SyncStageAccessFlags(const SyncStageAccessFlags &flags, const char *sep = "|") {
@@ -203,7 +198,7 @@ static std::string string_SyncStageAccessFlags(const SyncStageAccessFlags &flags
     } else {
         for (size_t i = 0; i < syncStageAccessInfoByStageAccessIndex.size(); i++) {
             const auto &info = syncStageAccessInfoByStageAccessIndex[i];
-            if ((flags & info.stage_access_bit).any()) {
+            if (flags.Intersects(info.stage_access_bit)) {
                 if (!out_str.empty()) {
                     out_str.append(sep);
                 }
@@ -395,19 +390,20 @@ bool CommandExecutionContext::ValidForSyncOps() const {
 //       rules apply only to this specific access for this stage, and not the stage as a whole. The ordering detection
 //       also reflects this special case for read hazard detection (using access instead of exec scope)
 static constexpr VkPipelineStageFlags2KHR kColorAttachmentExecScope = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR;
-static const SyncStageAccessFlags kColorAttachmentAccessScope =
+static constexpr SyncStageAccessFlags kColorAttachmentAccessScope =
     SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_READ_BIT |
     SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_READ_NONCOHERENT_BIT_EXT |
     SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_WRITE_BIT |
     SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT;  // Note: this is intentionally not in the exec scope
 static constexpr VkPipelineStageFlags2KHR kDepthStencilAttachmentExecScope =
     VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT_KHR | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT_KHR;
-static const SyncStageAccessFlags kDepthStencilAttachmentAccessScope =
+static constexpr SyncStageAccessFlags kDepthStencilAttachmentAccessScope =
     SYNC_EARLY_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | SYNC_EARLY_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
     SYNC_LATE_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | SYNC_LATE_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
     SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT;  // Note: this is intentionally not in the exec scope
 static constexpr VkPipelineStageFlags2KHR kRasterAttachmentExecScope = kDepthStencilAttachmentExecScope | kColorAttachmentExecScope;
-static const SyncStageAccessFlags kRasterAttachmentAccessScope = kDepthStencilAttachmentAccessScope | kColorAttachmentAccessScope;
+static constexpr SyncStageAccessFlags kRasterAttachmentAccessScope =
+    kDepthStencilAttachmentAccessScope | kColorAttachmentAccessScope;
 
 ResourceAccessState::OrderingBarriers ResourceAccessState::kOrderingRules = {
     {{VK_PIPELINE_STAGE_2_NONE_KHR, SyncStageAccessFlags()},
@@ -840,16 +836,16 @@ class UpdateStateResolveAction {
 };
 
 void HazardResult::Set(const ResourceAccessState *access_state_, SyncStageAccessIndex usage_index_, SyncHazard hazard_,
-                       const SyncStageAccessFlags &prior_, const ResourceUsageTag tag_) {
+                       SyncStageAccessIndex prior_, const ResourceUsageTag tag_) {
     access_state = std::make_unique<const ResourceAccessState>(*access_state_);
     usage_index = usage_index_;
     hazard = hazard_;
-    prior_access = prior_;
+    prior_access = FlagBit(prior_);
     tag = tag_;
 
     // Touchup the hazard to reflect "present as release" semantics
     // NOTE: For implementing QFO release/acquire semantics... touch up here as well
-    if (access_state->LastWriteOp() == SYNC_PRESENT_ENGINE_BIT_SYNCVAL_PRESENT_PRESENTED_BIT_SYNCVAL) {
+    if (access_state->LastWriteIndex() == SYNC_PRESENT_ENGINE_SYNCVAL_PRESENT_PRESENTED_SYNCVAL) {
         if (hazard == SyncHazard::READ_AFTER_WRITE) {
             hazard = SyncHazard::READ_AFTER_PRESENT;
         } else if (hazard == SyncHazard::WRITE_AFTER_WRITE) {
@@ -910,13 +906,38 @@ AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
 }
 
 void AccessContext::Trim() {
-    auto normalize = [](AccessAddressType address_type, ResourceAccessRangeMap::value_type &access) { access.second.Normalize(); };
-    ForAll(normalize);
+    for (const auto address_type : kAddressTypes) {
+        const auto &shared = access_state_maps_[static_cast<size_t>(address_type)];
+        // Trimming is idempotent, and skipping untouched maps keeps those shared with other contexts shared
+        if (!shared || shared->normalized) continue;
 
-    // Consolidate map after normalization, combines directly adjacent ranges with common values.
-    for (auto& map : access_state_maps_) {
+        auto &map = GetAccessStateMap(address_type);
+        for (auto &access : map) {
+            access.second.Normalize();
+        }
+        // Consolidate map after normalization, combines directly adjacent ranges with common values.
         sparse_container::consolidate(map);
+        shared->normalized = true;
+    }
+}
+
+ResourceAccessRangeMap &AccessContext::GetAccessStateMap(AccessAddressType type) {
+    auto &shared = access_state_maps_[static_cast<size_t>(type)];
+    if (!shared) {
+        shared = std::make_shared<SharedAccessStateMap>();
+    } else if (shared.use_count() > 1) {
+        shared = std::make_shared<SharedAccessStateMap>(*shared);
+    } else {
+        // Other owners may have dropped their reference on another thread, make their reads of the map happen before our writes
+        std::atomic_thread_fence(std::memory_order_acquire);
     }
+    shared->normalized = false;
+    return shared->map;
+}
+
+const ResourceAccessRangeMap &AccessContext::EmptyAccessStateMap() {
+    static const ResourceAccessRangeMap empty_map;
+    return empty_map;
 }
 
 void AccessContext::AddReferencedTags(ResourceUsageTagSet &used) const {
@@ -926,6 +947,20 @@ void AccessContext::AddReferencedTags(ResourceUsageTagSet &used) const {
     ConstForAll(gather);
 }
 
+void AccessContext::AccumulateMemoryUsage(MemoryUsage &usage) const {
+    for (const auto address_type : kAddressTypes) {
+        const auto &accesses = GetAccessStateMap(address_type);
+        if (accesses.empty() || !usage.maps.insert(&accesses).second) continue;
+        usage.range_count += accesses.size();
+        if (const auto *pool = accesses.get_implementation_map().get_allocator().pool()) {
+            usage.pool_size += pool->Capacity();
+        }
+        for (const auto &access : accesses) {
+            usage.heap_size += access.second.HeapSize();
+        }
+    }
+}
+
 template <typename Detector>
 HazardResult AccessContext::DetectPreviousHazard(AccessAddressType type, Detector &detector,
                                                  const ResourceAccessRange &range) const {
@@ -1286,6 +1321,19 @@ void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessConte
     }
 }
 
+void AccessContext::ImportAccessStateMaps(const AccessContext &from) {
+    const NoopBarrierAction noop_barrier;
+    for (const auto address_type : kAddressTypes) {
+        const auto index = static_cast<size_t>(address_type);
+        if (!access_state_maps_[index] || access_state_maps_[index]->map.empty()) {
+            // Resolving into an empty map without a barrier is a plain copy
+            access_state_maps_[index] = from.access_state_maps_[index];
+        } else {
+            from.ResolveAccessRange(address_type, kFullRange, noop_barrier, &GetAccessStateMap(address_type), nullptr, false);
+        }
+    }
+}
+
 // Layout transitions are handled as if the were occuring in the beginning of the next subpass
 bool AccessContext::ValidateLayoutTransitions(const CommandExecutionContext &exec_context, const RENDER_PASS_STATE &rp_state,
                                               const VkRect2D &render_area, uint32_t subpass,
@@ -2537,7 +2585,8 @@ bool CommandBufferAccessContext::ValidateFirstUse(CommandExecutionContext &exec_
 
     // and anything after the last syncop
     tag_range.end = ResourceUsageRecord::kMaxIndex;
-    hazard = recorded_context->DetectFirstUseHazard(queue_id, tag_range, *exec_context.GetCurrentAccessContext());
+    hazard = recorded_context->DetectFirstUseHazard(queue_id, tag_range, *exec_context.GetCurrentAccessContext(),
+                                                    exec_context.GetSyncState().GetWorkerPool());
     if (hazard.hazard) {
         skip |= log_msg(hazard, exec_context, func_name, index);
     }
@@ -2650,19 +2699,61 @@ class HazardDetectFirstUse {
     const ResourceUsageRange &tag_range_;
 };
 
+// Recorded maps with fewer ranges than this are checked on the calling thread, as splitting them costs more than it saves
+static constexpr size_t kParallelFirstUseThreshold = 4096;
+// Number of consecutive recorded ranges checked by one ParallelFor index
+static constexpr size_t kFirstUseRangesPerShard = 1024;
+
 // This is called with the *recorded* command buffers access context, with the *active* access context pass in, againsts which
 // hazards will be detected
 HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                                 const AccessContext &access_context) const {
+                                                 const AccessContext &access_context, WorkerPool *pool) const {
+    using ConstIterator = ResourceAccessRangeMap::const_iterator;
+    auto detect_first = [queue_id, &tag_range, &access_context](AccessAddressType address_type, ConstIterator begin,
+                                                               ConstIterator end, HazardResult &hazard) {
+        for (auto recorded_access = begin; recorded_access != end; ++recorded_access) {
+            // Cull any entries not in the current tag range
+            if (!recorded_access->second.FirstAccessInTagRange(tag_range)) continue;
+            HazardDetectFirstUse detector(recorded_access->second, queue_id, tag_range);
+            hazard = access_context.DetectHazard(address_type, detector, recorded_access->first, DetectOptions::kDetectAll);
+            if (hazard.hazard) return true;
+        }
+        return false;
+    };
+
     HazardResult hazard;
     for (const auto address_type : kAddressTypes) {
         const auto &recorded_access_map = GetAccessStateMap(address_type);
-        for (const auto &recorded_access : recorded_access_map) {
-            // Cull any entries not in the current tag range
-            if (!recorded_access.second.FirstAccessInTagRange(tag_range)) continue;
-            HazardDetectFirstUse detector(recorded_access.second, queue_id, tag_range);
-            hazard = access_context.DetectHazard(address_type, detector, recorded_access.first, DetectOptions::kDetectAll);
-            if (hazard.hazard) break;
+        if (!pool || recorded_access_map.size() < kParallelFirstUseThreshold) {
+            // The first hazard found is reported, later address types must not replace it with their (clean) result
+            if (detect_first(address_type, recorded_access_map.cbegin(), recorded_access_map.cend(), hazard)) return hazard;
+            continue;
+        }
+
+        // The recorded ranges are disjoint and sorted, so consecutive runs of them are disjoint partitions of the address
+        // space that can be checked independently. Only the hazard of the lowest shard is kept, which is the hazard the
+        // serial walk finds first. Shards past one with a hazard are skipped.
+        std::vector<ConstIterator> bounds;
+        bounds.reserve(recorded_access_map.size() / kFirstUseRangesPerShard + 2);
+        size_t position = 0;
+        for (auto it = recorded_access_map.cbegin(); it != recorded_access_map.cend(); ++it, ++position) {
+            if (position % kFirstUseRangesPerShard == 0) bounds.emplace_back(it);
+        }
+        bounds.emplace_back(recorded_access_map.cend());
+
+        const size_t shard_count = bounds.size() - 1;
+        std::vector<HazardResult> shard_hazards(shard_count);
+        std::atomic<size_t> first_hazard_shard{shard_count};
+        pool->ParallelFor(shard_count, [&](size_t shard) {
+            if (shard > first_hazard_shard.load(std::memory_order_relaxed)) return;
+            if (!detect_first(address_type, bounds[shard], bounds[shard + 1], shard_hazards[shard])) return;
+            size_t first = first_hazard_shard.load(std::memory_order_relaxed);
+            while (shard < first && !first_hazard_shard.compare_exchange_weak(first, shard, std::memory_order_relaxed)) {
+            }
+        });
+        const size_t first = first_hazard_shard.load();
+        if (first < shard_count) {
+            return std::move(shard_hazards[first]);
         }
     }
 
@@ -3157,7 +3248,7 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index)
                     break;
                 }
             }
-        } else if (last_write.any() && IsWriteHazard(usage)) {
+        } else if (HasWriteOp() && IsWriteHazard(usage)) {
             // Write-After-Write check -- if we have a previous write to test against
             hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write, write_tag);
         }
@@ -3177,8 +3268,8 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
     HazardResult hazard;
     const auto usage_bit = FlagBit(usage_index);
     const auto usage_stage = PipelineStageBit(usage_index);
-    const bool input_attachment_ordering = (ordering.access_scope & SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT).any();
-    const bool last_write_is_ordered = (last_write & ordering.access_scope).any() && (write_queue == queue_id);
+    const bool input_attachment_ordering = ordering.access_scope.Intersects(SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT);
+    const bool last_write_is_ordered = WriteInScope(ordering.access_scope) && (write_queue == queue_id);
     if (IsRead(usage_bit)) {
         // Exclude RAW if no write, or write not most "most recent" operation w.r.t. usage;
         bool is_raw_hazard = IsRAWHazard(usage_stage, usage_bit);
@@ -3203,7 +3294,7 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
         return DetectBarrierHazard(usage_index, queue_id, ordering.exec_scope, ordering.access_scope);
     } else {
         // Only check for WAW if there are no reads since last_write
-        bool usage_write_is_ordered = (usage_bit & ordering.access_scope).any();
+        bool usage_write_is_ordered = usage_bit.Intersects(ordering.access_scope);
         if (last_reads.size()) {
             // Look for any WAR hazards outside the ordered set of stages
             VkPipelineStageFlags2KHR ordered_stages = 0;
@@ -3221,12 +3312,12 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
                     }
                 }
             }
-        } else if (last_write.any() && !(last_write_is_ordered && usage_write_is_ordered)) {
+        } else if (HasWriteOp() && !(last_write_is_ordered && usage_write_is_ordered)) {
             bool ilt_ilt_hazard = false;
-            if ((usage_index == SYNC_IMAGE_LAYOUT_TRANSITION) && (usage_bit == last_write)) {
+            if ((usage_index == SYNC_IMAGE_LAYOUT_TRANSITION) && (usage_index == last_write)) {
                 // ILT after ILT is a special case where we check the 2nd access scope of the first ILT against the first access
                 // scope of the second ILT, which has been passed (smuggled?) in the ordering barrier
-                ilt_ilt_hazard = !(write_barriers & ordering.access_scope).any();
+                ilt_ilt_hazard = !write_barriers.Intersects(ordering.access_scope);
             }
             if (ilt_ilt_hazard || IsWriteHazard(usage_bit)) {
                 hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write, write_tag);
@@ -3300,11 +3391,11 @@ HazardResult ResourceAccessState::DetectAsyncHazard(SyncStageAccessIndex usage_i
     // subpasses.  Anything older than that should have been checked at the start of each subpass, taking into account all of
     // the raster ordering rules.
     if (IsRead(usage)) {
-        if (last_write.any() && (write_tag >= start_tag)) {
+        if (HasWriteOp() && (write_tag >= start_tag)) {
             hazard.Set(this, usage_index, READ_RACING_WRITE, last_write, write_tag);
         }
     } else {
-        if (last_write.any() && (write_tag >= start_tag)) {
+        if (HasWriteOp() && (write_tag >= start_tag)) {
             hazard.Set(this, usage_index, WRITE_RACING_WRITE, last_write, write_tag);
         } else if (last_reads.size() > 0) {
             // Any reads during the other subpass will conflict with this write, so we need to check them all.
@@ -3352,7 +3443,7 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
                 break;
             }
         }
-    } else if (last_write.any() && IsWriteBarrierHazard(queue_id, src_exec_scope, src_access_scope)) {
+    } else if (HasWriteOp() && IsWriteBarrierHazard(queue_id, src_exec_scope, src_access_scope)) {
         hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write, write_tag);
     }
 
@@ -3367,7 +3458,7 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
     assert(usage_index == SyncStageAccessIndex::SYNC_IMAGE_LAYOUT_TRANSITION);
     HazardResult hazard;
 
-    if ((write_tag >= event_tag) && last_write.any()) {
+    if ((write_tag >= event_tag) && HasWriteOp()) {
         // Any write after the event precludes the possibility of being in the first access scope for the layout transition
         hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write, write_tag);
     } else {
@@ -3404,7 +3495,7 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
                 const ReadState &current_read = last_reads[scope_read_count];
                 hazard.Set(this, usage_index, WRITE_AFTER_READ, current_read.access, current_read.tag);
             }
-        } else if (last_write.any()) {
+        } else if (HasWriteOp()) {
             // if there are no reads, the write is either the reason the access is in the event scope... they are a hazard
             // The write is in the first sync scope of the event (sync their aren't any reads to be the reason)
             // So do a normal barrier hazard check
@@ -3519,7 +3610,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, SyncOrdering
             const auto not_usage_stage = ~usage_stage;
             for (auto &read_access : last_reads) {
                 if (read_access.stage == usage_stage) {
-                    read_access.Set(usage_stage, usage_bit, 0, tag);
+                    read_access.Set(usage_stage, usage_index, 0, tag);
                 } else if (read_access.barriers & usage_stage) {
                     // If the current access is barriered to this stage, mark it as "known to happen after"
                     read_access.sync_stages |= usage_stage;
@@ -3536,7 +3627,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, SyncOrdering
                     read_access.sync_stages |= usage_stage;
                 }
             }
-            last_reads.emplace_back(usage_stage, usage_bit, 0, tag);
+            last_reads.emplace_back(usage_stage, usage_index, 0, tag);
             last_read_stages |= usage_stage;
         }
 
@@ -3548,7 +3639,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, SyncOrdering
     } else {
         // Assume write
         // TODO determine what to do with READ-WRITE operations if any
-        SetWrite(usage_bit, tag);
+        SetWrite(usage_index, tag);
     }
     UpdateFirst(tag, usage_index, ordering_rule);
 }
@@ -3558,11 +3649,11 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, SyncOrdering
 // We can overwrite them as *this* write is now after them.
 //
 // Note: intentionally ignore pending barriers and chains (i.e. don't apply or clear them), let ApplyPendingBarriers handle them.
-void ResourceAccessState::SetWrite(const SyncStageAccessFlags &usage_bit, const ResourceUsageTag tag) {
+void ResourceAccessState::SetWrite(SyncStageAccessIndex usage_index, const ResourceUsageTag tag) {
     ClearRead();
     ClearWrite();
     write_tag = tag;
-    last_write = usage_bit;
+    last_write = usage_index;
 }
 
 void ResourceAccessState::ClearWrite() {
@@ -3570,7 +3661,7 @@ void ResourceAccessState::ClearWrite() {
     input_attachment_read = false;  // Denotes no outstanding input attachment read after the last write.
     write_barriers.reset();
     write_dependency_chain = VK_PIPELINE_STAGE_2_NONE;
-    last_write.reset();
+    last_write = SYNC_ACCESS_INDEX_NONE;
 
     write_tag = 0;
     write_queue = QueueSyncState::kQueueIdInvalid;
@@ -3643,7 +3734,7 @@ void ResourceAccessState::ApplyBarrier(ScopeOps &&scope, const SyncBarrier &barr
 void ResourceAccessState::ApplyPendingBarriers(const ResourceUsageTag tag) {
     if (pending_layout_transition) {
         // SetWrite clobbers the last_reads array, and thus we don't have to clear the read_state out.
-        SetWrite(SYNC_IMAGE_LAYOUT_TRANSITION_BIT, tag);  // Side effect notes below
+        SetWrite(SYNC_IMAGE_LAYOUT_TRANSITION, tag);  // Side effect notes below
         UpdateFirst(tag, SYNC_IMAGE_LAYOUT_TRANSITION, SyncOrdering::kNonAttachment);
         TouchupFirstForLayoutTransition(tag, pending_layout_ordering_);
         pending_layout_ordering_ = OrderingBarrier();
@@ -3695,7 +3786,7 @@ bool ResourceAccessState::WaitQueueTagPredicate::operator()(const ResourceAccess
 }
 bool ResourceAccessState::WaitQueueTagPredicate::operator()(const ResourceAccessState &access) const {
     return (access.write_queue == queue) && (access.write_tag <= tag) &&
-           (access.last_write != SYNC_PRESENT_ENGINE_BIT_SYNCVAL_PRESENT_PRESENTED_BIT_SYNCVAL);
+           (access.last_write != SYNC_PRESENT_ENGINE_SYNCVAL_PRESENT_PRESENTED_SYNCVAL);
 }
 
 // Read access predicate for queue wait
@@ -3703,7 +3794,7 @@ bool ResourceAccessState::WaitTagPredicate::operator()(const ResourceAccessState
     return (read_access.tag <= tag) && (read_access.stage != VK_PIPELINE_STAGE_2_PRESENT_ENGINE_BIT_SYNCVAL);
 }
 bool ResourceAccessState::WaitTagPredicate::operator()(const ResourceAccessState &access) const {
-    return (access.write_tag <= tag) && (access.last_write != SYNC_PRESENT_ENGINE_BIT_SYNCVAL_PRESENT_PRESENTED_BIT_SYNCVAL);
+    return (access.write_tag <= tag) && (access.last_write != SYNC_PRESENT_ENGINE_SYNCVAL_PRESENT_PRESENTED_SYNCVAL);
 }
 
 // Present operations only matching only the *exactly* tagged present and acquire operations
@@ -3712,7 +3803,7 @@ bool ResourceAccessState::WaitAcquirePredicate::operator()(const ResourceAccessS
 }
 bool ResourceAccessState::WaitAcquirePredicate::operator()(const ResourceAccessState &access) const {
     return (access.write_tag == present_tag) &&
-           (access.last_write == SYNC_PRESENT_ENGINE_BIT_SYNCVAL_PRESENT_PRESENTED_BIT_SYNCVAL);
+           (access.last_write == SYNC_PRESENT_ENGINE_SYNCVAL_PRESENT_PRESENTED_SYNCVAL);
 }
 
 // Return if the resulting state is "empty"
@@ -3762,7 +3853,7 @@ bool ResourceAccessState::ApplyPredicatedWait(Predicate &predicate) {
     }
 
     bool all_clear = last_reads.size() == 0;
-    if (last_write.any()) {
+    if (HasWriteOp()) {
         if (predicate(*this) || sync_reads) {
             // Clear any predicated write, or any the write from any any access with synchronized reads.
             // This could drop RAW detection, but only if the synchronized reads were RAW hazards, and given
@@ -3783,7 +3874,7 @@ bool ResourceAccessState::FirstAccessInTagRange(const ResourceUsageRange &tag_ra
 }
 
 void ResourceAccessState::OffsetTag(ResourceUsageTag offset) {
-    if (last_write.any()) write_tag += offset;
+    if (HasWriteOp()) write_tag += offset;
     for (auto &read_access : last_reads) {
         read_access.tag += offset;
     }
@@ -3797,24 +3888,23 @@ ResourceAccessState::ResourceAccessState()
       write_dependency_chain(0),
       write_tag(),
       write_queue(QueueSyncState::kQueueIdInvalid),
-      last_write(0),
-      input_attachment_read(false),
+      last_write(SYNC_ACCESS_INDEX_NONE),
       last_read_stages(0),
       read_execution_barriers(0),
       pending_write_dep_chain(0),
-      pending_layout_transition(false),
       pending_write_barriers(0),
       pending_layout_ordering_(),
       first_accesses_(),
       first_read_stages_(0U),
-      first_write_layout_ordering_() {}
+      first_write_layout_ordering_(),
+      input_attachment_read(false),
+      pending_layout_transition(false) {}
 
-// This should be just Bits or Index, but we don't have an invalid state for Index
 VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAccessFlags &usage_bit) const {
     VkPipelineStageFlags2KHR barriers = 0U;
 
     for (const auto &read_access : last_reads) {
-        if ((read_access.access & usage_bit).any()) {
+        if (usage_bit.test(read_access.access)) {
             barriers = read_access.barriers;
             break;
         }
@@ -3829,7 +3919,7 @@ void ResourceAccessState::SetQueueId(QueueId id) {
             read_access.queue = id;
         }
     }
-    if (last_write.any() && (write_queue == QueueSyncState::kQueueIdInvalid)) {
+    if (HasWriteOp() && (write_queue == QueueSyncState::kQueueIdInvalid)) {
         write_queue = id;
     }
 }
@@ -3839,11 +3929,11 @@ bool ResourceAccessState::WriteInChain(VkPipelineStageFlags2KHR src_exec_scope)
 }
 
 bool ResourceAccessState::WriteInScope(const SyncStageAccessFlags &src_access_scope) const {
-    return (src_access_scope & last_write).any();
+    return HasWriteOp() && src_access_scope.test(last_write);
 }
 
 bool ResourceAccessState::WriteBarrierInScope(const SyncStageAccessFlags &src_access_scope) const {
-    return (write_barriers & src_access_scope).any();
+    return write_barriers.Intersects(src_access_scope);
 }
 
 bool ResourceAccessState::WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope,
@@ -3875,7 +3965,7 @@ bool operator<(const ResourceAccessState::ReadState &lhs, const ResourceAccessSt
 }
 
 void ResourceAccessState::Normalize() {
-    if (!last_write.any()) {
+    if (!HasWriteOp()) {
         ClearWrite();
     }
     if (!last_reads.size()) {
@@ -3892,8 +3982,19 @@ void ResourceAccessState::Normalize() {
     ClearFirstUse();
 }
 
+size_t ResourceAccessState::HeapSize() const {
+    size_t size = 0;
+    if (last_reads.size() > ReadStates::kSmallCapacity) {
+        size += last_reads.size() * sizeof(ReadState);
+    }
+    if (first_accesses_.size() > FirstAccesses::kSmallCapacity) {
+        size += first_accesses_.size() * sizeof(ResourceFirstAccess);
+    }
+    return size;
+}
+
 void ResourceAccessState::GatherReferencedTags(ResourceUsageTagSet &used) const {
-    if (last_write.any()) {
+    if (HasWriteOp()) {
         used.insert(write_tag);
     }
 
@@ -3909,7 +4010,7 @@ bool ResourceAccessState::IsRAWHazard(VkPipelineStageFlags2KHR usage_stage, cons
     //      any reads that happen after.
     //    * the previous reads *are* hazards to last_write, have been reported, and if that hazard is fixed
     //      the current read will be also not be a hazard, thus reporting a hazard here adds no needed information.
-    return last_write.any() && (0 == (read_execution_barriers & usage_stage)) && IsWriteHazard(usage);
+    return HasWriteOp() && (0 == (read_execution_barriers & usage_stage)) && IsWriteHazard(usage);
 }
 
 VkPipelineStageFlags2 ResourceAccessState::GetOrderedStages(QueueId queue_id, const OrderingBarrier &ordering) const {
@@ -3926,7 +4027,7 @@ VkPipelineStageFlags2 ResourceAccessState::GetOrderedStages(QueueId queue_id, co
     const VkPipelineStageFlags2 read_stages_in_qso = last_read_stages & ~non_qso_stages;
     VkPipelineStageFlags2 ordered_stages = read_stages_in_qso & ordering.exec_scope;
     // Special input attachment handling as always (not encoded in exec_scop)
-    const bool input_attachment_ordering = (ordering.access_scope & SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT).any();
+    const bool input_attachment_ordering = ordering.access_scope.Intersects(SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT);
     if (input_attachment_ordering && input_attachment_read) {
         // If we have an input attachment in last_reads and input attachments are ordered we all that stage
         ordered_stages |= VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR;
@@ -3961,17 +4062,17 @@ void ResourceAccessState::TouchupFirstForLayoutTransition(ResourceUsageTag tag,
     }
 }
 
-ResourceAccessState::ReadState::ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_,
+ResourceAccessState::ReadState::ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_,
                                           VkPipelineStageFlags2KHR barriers_, ResourceUsageTag tag_)
     : stage(stage_),
-      access(access_),
       barriers(barriers_),
       sync_stages(VK_PIPELINE_STAGE_2_NONE),
       tag(tag_),
       queue(QueueSyncState::kQueueIdInvalid),
+      access(access_),
       pending_dep_chain(VK_PIPELINE_STAGE_2_NONE) {}
 
-void ResourceAccessState::ReadState::Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_,
+void ResourceAccessState::ReadState::Set(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_,
                                          VkPipelineStageFlags2KHR barriers_, ResourceUsageTag tag_) {
     stage = stage_;
     access = access_;
@@ -4691,6 +4792,33 @@ void SyncValidator::PreCallRecordCmdPipelineBarrier2(VkCommandBuffer commandBuff
                                                            *pDependencyInfo);
 }
 
+void SyncValidator::ReportAccessStateMemory() {
+    static const bool enabled = GetBoolSetting("VK_LAYER_SYNCVAL_MEMORY_REPORT", "khronos_validation.syncval_memory_report");
+    if (!enabled) return;
+
+    // Batches waiting on a semaphore hold their access state as well as the last batch of each queue
+    AccessContext::MemoryUsage usage;
+    for (const auto &batch : GetQueueBatchSnapshot()) {
+        batch->GetCurrentAccessContext()->AccumulateMemoryUsage(usage);
+    }
+    // Map nodes are pooled, so the total counts the pool blocks, free and not yet used nodes included, rather than the
+    // ranges, plus the reads and first accesses spilled to the heap.
+    const size_t total = usage.pool_size + usage.heap_size;
+    const size_t used_size = usage.range_count * sizeof(ResourceAccessRangeMap::value_type);
+    LogInfo(device, "UNASSIGNED-SyncVal-memory",
+            "%zu access maps track %zu ranges using %zu KiB: %zu bytes per range (ResourceAccessState is %zu bytes, ReadState %zu "
+            "bytes), %zu KiB of node pools of which %zu KiB hold ranges, and %zu KiB of reads and first accesses beyond the "
+            "inline storage.",
+            usage.maps.size(), usage.range_count, total / 1024, usage.range_count ? total / usage.range_count : 0,
+            sizeof(ResourceAccessState), sizeof(ResourceAccessState::ReadState), usage.pool_size / 1024, used_size / 1024,
+            usage.heap_size / 1024);
+}
+
+void SyncValidator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    ReportAccessStateMemory();
+    StateTracker::PreCallRecordDestroyDevice(device, pAllocator);
+}
+
 void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     // The state tracker sets up the device state
     StateTracker::CreateDevice(pCreateInfo);
@@ -8023,7 +8151,7 @@ void QueueBatchContext::Trim() {
     // Clean up unneeded access context contents and log information
     access_context_.Trim();
 
-    ResourceUsageTagSet used_tags;
+    ResourceUsageTagSet used_tags = batch_log_.MakeTagSet();
     access_context_.AddReferencedTags(used_tags);
 
     // Note: AccessContexts in the SyncEventsState are trimmed when created.
@@ -8074,9 +8202,11 @@ void QueueBatchContext::ApplyAcquireWait(const AcquiredImage &acquired) {
 HazardResult QueueBatchContext::DetectFirstUseHazard(const ResourceUsageRange &tag_range) {
     // Queue batch handling requires dealing with renderpass state and picking the correct access context
     if (rp_replay_) {
-        return rp_replay_.replay_context->DetectFirstUseHazard(GetQueueId(), tag_range, *current_access_context_);
+        return rp_replay_.replay_context->DetectFirstUseHazard(GetQueueId(), tag_range, *current_access_context_,
+                                                               sync_state_->GetWorkerPool());
     }
-    return current_replay_->GetCurrentAccessContext()->DetectFirstUseHazard(GetQueueId(), tag_range, access_context_);
+    return current_replay_->GetCurrentAccessContext()->DetectFirstUseHazard(GetQueueId(), tag_range, access_context_,
+                                                                            sync_state_->GetWorkerPool());
 }
 
 void QueueBatchContext::BeginRenderPassReplay(const SyncOpBeginRenderPass &begin_op, const ResourceUsageTag tag) {
@@ -8361,7 +8491,7 @@ void QueueBatchContext::SetupAccessContext(const std::shared_ptr<const QueueBatc
 
 void QueueBatchContext::SetupAccessContext(const PresentedImage &presented) {
     if (presented.batch) {
-        access_context_.ResolveFromContext(NoopBarrierAction(), presented.batch->access_context_);
+        access_context_.ImportAccessStateMaps(presented.batch->access_context_);
         batch_log_.Import(presented.batch->batch_log_);
         ImportSyncTags(*presented.batch);
     }
@@ -8375,7 +8505,7 @@ void QueueBatchContext::CommonSetupAccessContext(const std::shared_ptr<const Que
         events_context_.DeepCopy(prev->events_context_);
         if (!layer_data::Contains(batches_resolved, prev)) {
             // If there are no semaphores to the previous batch, make sure a "submit order" non-barriered import is done
-            access_context_.ResolveFromContext(NoopBarrierAction(), prev->access_context_);
+            access_context_.ImportAccessStateMaps(prev->access_context_);
             batches_resolved.emplace(prev);
         }
     }
@@ -8610,58 +8740,40 @@ void BatchAccessLog::Insert(const BatchRecord &batch, const ResourceUsageRange &
     log_map_.insert(std::make_pair(range, CBSubmitLog(batch, nullptr, std::move(log))));
 }
 
+ResourceUsageTagSet BatchAccessLog::MakeTagSet() const {
+    std::vector<ResourceUsageRange> ranges;
+    ranges.reserve(log_map_.size());
+    for (const auto &entry : log_map_) {
+        ranges.emplace_back(entry.first);
+    }
+    return ResourceUsageTagSet(std::move(ranges));
+}
+
 // Trim: Remove any unreferenced AccessLog ranges from a BatchAccessLog
 //
 // In order to contain memory growth in the AccessLog information regarding prior submitted command buffers,
 // the Trim call removes any AccessLog references that do not correspond to any tags in use. The set of referenced tag, used_tags,
-// is generated by scanning the AccessContext and EventContext of the containing QueueBatchContext.
+// is made by MakeTagSet and filled by scanning the AccessContext and EventContext of the containing QueueBatchContext. It
+// flags the log ranges in use, in log order, so the log must not have changed since it was made.
 //
 // Upon return the BatchAccessLog should only contain references to the AccessLog information needed by the
-// containing parent QueueBatchContext.
-//
-// The algorithm used is another example of the "parallel iteration" pattern common within SyncVal.  In this case we are
-// traversing the ordered range_map containing the AccessLog references and the ordered set of tags in use.
-//
-// To efficiently perform the parallel iteration, optimizations within this function include:
-//  * when ranges are detected that have no tags referenced, all ranges between the last tag and the current tag are erased
-//  * when used tags prior to the current range are found, all tags up to the current range are skipped
-//  * when a tag is found within the current range, that range is skipped (and thus kept in the map), and further used tags
-//    within the range are skipped.
-//
-// Note that for each subcase, any "next steps" logic is designed to be handled within the subsequent iteration -- meaning that
-// each subcase simply handles the specifics of the current update/skip/erase action needed, and leaves the iterators in a sensible
-// state for the top of loop... intentionally eliding special case handling.
+// containing parent QueueBatchContext. Each run of unreferenced ranges is erased at once.
 void BatchAccessLog::Trim(const ResourceUsageTagSet &used_tags) {
-    auto current_tag = used_tags.cbegin();
-    const auto end_tag = used_tags.cend();
+    assert(used_tags.RangeCount() == log_map_.size());
+    size_t index = 0;
     auto current_map_range = log_map_.begin();
-    const auto end_map = log_map_.end();
-
-    while (current_map_range != end_map) {
-        if (current_tag == end_tag) {
-            // We're out of tags, the rest of the map isn't referenced, so erase it
-            current_map_range = log_map_.erase(current_map_range, end_map);
-        } else {
-            auto &range = current_map_range->first;
-            const ResourceUsageTag tag = *current_tag;
-            if (tag < range.begin) {
-                // Skip to the next tag potentially in range
-                // if this is end_tag, we'll handle that next iteration
-                current_tag = used_tags.lower_bound(range.begin);
-            } else if (tag >= range.end) {
-                // This tag is beyond the current range, delete all ranges between current_map_range,
-                // and the next that includes the tag.  Next is not erased.
-                auto next_used = log_map_.lower_bound(ResourceUsageRange(tag, tag + 1));
-                current_map_range = log_map_.erase(current_map_range, next_used);
-            } else {
-                // Skip the rest of the tags in this range
-                // If this is end, the next iteration will handle
-                current_tag = used_tags.lower_bound(range.end);
-
-                // This is a range we will keep, advance to the next. Next iteration handles end condition
-                ++current_map_range;
-            }
+    while (current_map_range != log_map_.end()) {
+        if (used_tags.IsRangeUsed(index)) {
+            ++current_map_range;
+            ++index;
+            continue;
+        }
+        auto unused_end = current_map_range;
+        while (unused_end != log_map_.end() && !used_tags.IsRangeUsed(index)) {
+            ++unused_end;
+            ++index;
         }
+        current_map_range = log_map_.erase(current_map_range, unused_end);
     }
 }
 
@@ -21,9 +21,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <memory>
-#include <set>
+#include <vector>
 #include <vulkan/vulkan.h>
 
 #include "synchronization_validation_types.h"
@@ -84,14 +85,16 @@ struct SyncStageAccess {
         return static_cast<SyncStageAccessFlags>(FlagBit(stage_access));
     }
 
-    static bool IsRead(const SyncStageAccessFlags &stage_access_bit) { return (stage_access_bit & syncStageAccessReadMask).any(); }
+    static bool IsRead(const SyncStageAccessFlags &stage_access_bit) {
+        return stage_access_bit.Intersects(syncStageAccessReadMask);
+    }
     static bool IsRead(SyncStageAccessIndex stage_access_index) { return IsRead(FlagBit(stage_access_index)); }
 
     static bool IsWrite(const SyncStageAccessFlags &stage_access_bit) {
-        return (stage_access_bit & syncStageAccessWriteMask).any();
+        return stage_access_bit.Intersects(syncStageAccessWriteMask);
     }
     static bool HasWrite(const SyncStageAccessFlags &stage_access_mask) {
-        return (stage_access_mask & syncStageAccessWriteMask).any();
+        return stage_access_mask.Intersects(syncStageAccessWriteMask);
     }
     static bool IsWrite(SyncStageAccessIndex stage_access_index) { return IsWrite(FlagBit(stage_access_index)); }
     static VkPipelineStageFlags2KHR PipelineStageBit(SyncStageAccessIndex stage_access_index) {
@@ -252,9 +255,41 @@ struct ResourceUsageRecord : public ResourceCmdUsageRecord {
 
 // The resource tag index is relative to the command buffer or queue in which it's found
 using ResourceUsageTag = ResourceUsageRecord::TagIndex;
-using ResourceUsageTagSet = std::set<ResourceUsageTag>;
 using ResourceUsageRange = sparse_container::range<ResourceUsageTag>;
 
+// Tags referenced by the access state of a batch, gathered to trim its access log. The log is only trimmed a whole range
+// at a time, so the set holds one flag per range of the log it was created for (see BatchAccessLog::MakeTagSet) rather
+// than the tags themselves. Tags outside of those ranges are ignored, as there is no log entry to keep for them.
+class ResourceUsageTagSet {
+  public:
+    // ranges must be sorted and disjoint
+    explicit ResourceUsageTagSet(std::vector<ResourceUsageRange> &&ranges)
+        : ranges_(std::move(ranges)), used_(ranges_.size(), 0) {}
+
+    void insert(ResourceUsageTag tag) {
+        // Accesses of the same range tend to reference the same few commands, so try the last range found first
+        if (last_ < ranges_.size() && ranges_[last_].includes(tag)) {
+            used_[last_] = 1;
+            return;
+        }
+        auto it = std::upper_bound(ranges_.cbegin(), ranges_.cend(), tag,
+                                   [](ResourceUsageTag value, const ResourceUsageRange &range) { return value < range.begin; });
+        if (it == ranges_.cbegin()) return;
+        --it;
+        if (!it->includes(tag)) return;
+        last_ = static_cast<size_t>(it - ranges_.cbegin());
+        used_[last_] = 1;
+    }
+
+    size_t RangeCount() const { return ranges_.size(); }
+    bool IsRangeUsed(size_t index) const { return used_[index] != 0; }
+
+  private:
+    std::vector<ResourceUsageRange> ranges_;
+    std::vector<uint8_t> used_;
+    size_t last_ = 0;
+};
+
 struct HazardResult {
     std::unique_ptr<const ResourceAccessState> access_state;
     std::unique_ptr<const ResourceFirstAccess> recorded_access;
@@ -263,7 +298,7 @@ struct HazardResult {
     SyncStageAccessFlags prior_access = 0U;  // TODO -- change to a NONE enum in ...Bits
     ResourceUsageTag tag = ResourceUsageTag();
     void Set(const ResourceAccessState *access_state_, SyncStageAccessIndex usage_index_, SyncHazard hazard_,
-             const SyncStageAccessFlags &prior_, ResourceUsageTag tag_);
+             SyncStageAccessIndex prior_, ResourceUsageTag tag_);
     void AddRecordedAccess(const ResourceFirstAccess &first_access);
     bool IsHazard() const { return NONE != hazard; }
 };
@@ -438,16 +473,15 @@ class ResourceAccessState : public SyncStageAccess {
     // and applicable one for hazard detection
     struct ReadState {
         VkPipelineStageFlags2KHR stage;  // The stage of this read
-        SyncStageAccessFlags access;    // TODO: Change to FlagBits when we have a None bit enum
-                                        // TODO: Revisit whether this needs to support multiple reads per stage
         VkPipelineStageFlags2KHR barriers;  // all applicable barriered stages
         VkPipelineStageFlags2KHR sync_stages;  // reads known to have happened after this
         ResourceUsageTag tag;
         QueueId queue;
+        SyncStageAccessIndex access;  // TODO: Revisit whether this needs to support multiple reads per stage
         VkPipelineStageFlags2KHR pending_dep_chain;  // Should be zero except during barrier application
                                                      // Excluded from comparison
         ReadState() = default;
-        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_, VkPipelineStageFlags2KHR barriers_,
+        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_, VkPipelineStageFlags2KHR barriers_,
                   ResourceUsageTag tag_);
         bool operator==(const ReadState &rhs) const {
             bool same = (stage == rhs.stage) && (access == rhs.access) && (barriers == rhs.barriers) &&
@@ -471,7 +505,7 @@ class ResourceAccessState : public SyncStageAccess {
         }
 
         bool operator!=(const ReadState &rhs) const { return !(*this == rhs); }
-        void Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_, VkPipelineStageFlags2KHR barriers_,
+        void Set(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_, VkPipelineStageFlags2KHR barriers_,
                  ResourceUsageTag tag_);
         bool ReadInScopeOrChain(VkPipelineStageFlags2 exec_scope) const { return (exec_scope & (stage | barriers)) != 0; }
         bool ReadInQueueScopeOrChain(QueueId queue, VkPipelineStageFlags2 exec_scope) const;
@@ -551,8 +585,8 @@ class ResourceAccessState : public SyncStageAccess {
     bool HasPendingState() const {
         return (0 != pending_layout_transition) || pending_write_barriers.any() || (0 != pending_write_dep_chain);
     }
-    bool HasWriteOp() const { return last_write != 0; }
-    const SyncStageAccessFlags &LastWriteOp() const { return last_write; }
+    bool HasWriteOp() const { return last_write != SYNC_ACCESS_INDEX_NONE; }
+    SyncStageAccessIndex LastWriteIndex() const { return last_write; }
     ResourceUsageTag LastWriteTag() const { return write_tag; }
     bool operator==(const ResourceAccessState &rhs) const {
         const bool write_same = (read_execution_barriers == rhs.read_execution_barriers) &&
@@ -620,6 +654,8 @@ class ResourceAccessState : public SyncStageAccess {
 
     void Normalize();
     void GatherReferencedTags(ResourceUsageTagSet &used) const;
+    // Bytes allocated for the reads and first accesses that don't fit in the inline storage
+    size_t HeapSize() const;
 
   private:
     static constexpr VkPipelineStageFlags2KHR kInvalidAttachmentStage = ~VkPipelineStageFlags2KHR(0);
@@ -635,7 +671,7 @@ class ResourceAccessState : public SyncStageAccess {
     bool IsWriteBarrierHazard(QueueId queue_id, VkPipelineStageFlags2KHR src_exec_scope,
                               const SyncStageAccessFlags &src_access_scope) const {
         // Special rules for sequential ILT's
-        if (last_write == SYNC_IMAGE_LAYOUT_TRANSITION_BIT) {
+        if (last_write == SYNC_IMAGE_LAYOUT_TRANSITION) {
             if (queue_id == write_queue) {
                 // In queue, they are implicitly ordered
                 return false;
@@ -667,7 +703,8 @@ class ResourceAccessState : public SyncStageAccess {
         return kOrderingRules[static_cast<size_t>(ordering_enum)];
     }
 
-    // TODO: Add a NONE (zero) enum to SyncStageAccessFlags for input_attachment_read and last_write
+    // Members are ordered to keep the state compact, as one is stored per tracked range of every resource. Accesses are
+    // stored as indices rather than masks, with SYNC_ACCESS_INDEX_NONE denoting no access.
 
     // With reads, each must be "safe" relative to it's prior write, so we need only
     // save the most recent write operation (as anything *transitively* unsafe would arleady
@@ -676,11 +713,7 @@ class ResourceAccessState : public SyncStageAccess {
     VkPipelineStageFlags2KHR write_dependency_chain;  // intiially zero, but accumulating the dstStages of barriers if they chain.
     ResourceUsageTag write_tag;
     QueueId write_queue;
-    SyncStageAccessFlags last_write;  // only the most recent write
-
-    // TODO Input Attachment cleanup for multiple reads in a given stage
-    // Tracks whether the fragment shader read is input attachment read
-    bool input_attachment_read;
+    SyncStageAccessIndex last_write;  // only the most recent write
 
     VkPipelineStageFlags2KHR last_read_stages;
     VkPipelineStageFlags2KHR read_execution_barriers;
@@ -689,20 +722,27 @@ class ResourceAccessState : public SyncStageAccess {
 
     // Pending execution state to support independent parallel barriers
     VkPipelineStageFlags2KHR pending_write_dep_chain;
-    bool pending_layout_transition;
     SyncStageAccessFlags pending_write_barriers;
     OrderingBarrier pending_layout_ordering_;
     FirstAccesses first_accesses_;
     VkPipelineStageFlags2KHR first_read_stages_;
     OrderingBarrier first_write_layout_ordering_;
 
+    // TODO Input Attachment cleanup for multiple reads in a given stage
+    // Tracks whether the fragment shader read is input attachment read
+    bool input_attachment_read;
+    bool pending_layout_transition;
+
     static OrderingBarriers kOrderingRules;
 };
 using ResourceAccessStateFunction = std::function<void(ResourceAccessState *)>;
 using ResourceAccessStateConstFunction = std::function<void(const ResourceAccessState &)>;
 
 using ResourceAddress = VkDeviceSize;
-using ResourceAccessRangeMap = sparse_container::range_map<ResourceAddress, ResourceAccessState>;
+// The access maps are walked on every hazard check and resolve, so their nodes come from a per map pool rather than the heap
+using ResourceAccessRangeMap =
+    sparse_container::range_map<ResourceAddress, ResourceAccessState, sparse_container::range<ResourceAddress>,
+                                layer_data::pooled_map<sparse_container::range<ResourceAddress>, ResourceAccessState>>;
 using ResourceAccessRange = typename ResourceAccessRangeMap::key_type;
 using ResourceAccessRangeIndex = typename ResourceAccessRange::index_type;
 using ResourceRangeMergeIterator = sparse_container::parallel_iterator<ResourceAccessRangeMap, const ResourceAccessRangeMap>;
@@ -1023,7 +1063,6 @@ class AccessContext {
         AddressRange() = default;  // the explicit constructor below isn't needed in 20, but would delete the default.
         AddressRange(AccessAddressType type_, ResourceAccessRange range_) : type(type_), range(range_) {}
     };
-    using MapArray = std::array<ResourceAccessRangeMap, static_cast<size_t>(AccessAddressType::kTypeCount)>;
 
     using TrackBack = SubpassBarrierTrackback<AccessContext>;
 
@@ -1072,8 +1111,9 @@ class AccessContext {
                                  const AttachmentViewGenVector &attachment_views, ResourceUsageTag tag);
     void RecordRenderpassAsyncContextTags();
 
-    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                      const AccessContext &access_context) const;
+    // With a pool, large maps are split into runs of ranges checked on several threads. The hazard returned is the same.
+    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range, const AccessContext &access_context,
+                                      WorkerPool *pool = nullptr) const;
 
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
@@ -1084,7 +1124,7 @@ class AccessContext {
         dst_external_ = TrackBack();
         start_tag_ = ResourceUsageTag();
         for (auto &map : access_state_maps_) {
-            map.clear();
+            map.reset();
         }
     }
 
@@ -1134,6 +1174,9 @@ class AccessContext {
     void ResolveChildContexts(const std::vector<AccessContext> &contexts);
 
     void ImportAsyncContexts(const AccessContext &from);
+    // Barrier-less resolve of from. Address types without any access in this context share the maps of from instead of
+    // copying them.
+    void ImportAccessStateMaps(const AccessContext &from);
     template <typename Action, typename RangeGen>
     void ApplyUpdateAction(AccessAddressType address_type, const Action &action, RangeGen *range_gen_arg);
     template <typename Action>
@@ -1151,9 +1194,23 @@ class AccessContext {
     void Trim();
     void AddReferencedTags(ResourceUsageTagSet &referenced) const;
 
-    ResourceAccessRangeMap &GetAccessStateMap(AccessAddressType type) { return access_state_maps_[static_cast<size_t>(type)]; }
+    struct MemoryUsage {
+        layer_data::unordered_set<const ResourceAccessRangeMap *> maps;  // maps shared between contexts are counted once
+        size_t range_count = 0;
+        size_t heap_size = 0;
+        size_t pool_size = 0;  // node pool blocks, including free and not yet used nodes
+    };
+    void AccumulateMemoryUsage(MemoryUsage &usage) const;
+
+    // The maps are copy on write per address type, so that contexts copied or imported from one another only hold the
+    // address types they change. Any non-const access makes the whole map of that type private to this context, however
+    // few ranges are then written: there is no sharing below the address type, as global barriers and semaphore waits
+    // apply to the full range of every map anyway. That node copy is still linear in the ranges of the map, but several
+    // times cheaper than the range by range resolve it replaces, and skipped for the address types left untouched.
+    ResourceAccessRangeMap &GetAccessStateMap(AccessAddressType type);
     const ResourceAccessRangeMap &GetAccessStateMap(AccessAddressType type) const {
-        return access_state_maps_[static_cast<size_t>(type)];
+        const auto &shared = access_state_maps_[static_cast<size_t>(type)];
+        return shared ? shared->map : EmptyAccessStateMap();
     }
     const TrackBack *GetTrackBackFromSubpass(uint32_t subpass) const {
         if (subpass == VK_SUBPASS_EXTERNAL) {
@@ -1199,6 +1256,15 @@ class AccessContext {
     };
 
   private:
+    struct SharedAccessStateMap {
+        ResourceAccessRangeMap map;
+        // Set by Trim, cleared by any non-const access. Lets Trim skip maps that are unchanged, and still shared.
+        bool normalized = false;
+    };
+    // A null entry is an empty map
+    using MapArray = std::array<std::shared_ptr<SharedAccessStateMap>, static_cast<size_t>(AccessAddressType::kTypeCount)>;
+    static const ResourceAccessRangeMap &EmptyAccessStateMap();
+
     template <typename Detector>
     HazardResult DetectHazard(AccessAddressType type, Detector &detector, const ResourceAccessRange &range,
                               DetectOptions options) const;
@@ -1645,6 +1711,8 @@ class BatchAccessLog {
     void Insert(const BatchRecord &batch, const ResourceUsageRange &range,
                 std::shared_ptr<const CommandExecutionContext::AccessLog> log);
 
+    // Returns an empty tag set for the current ranges of the log, to be filled and passed to Trim
+    ResourceUsageTagSet MakeTagSet() const;
     void Trim(const ResourceUsageTagSet &used);
     // AccessRecord lookup is based on global tags
     AccessRecord operator[](ResourceUsageTag tag) const;
@@ -1961,6 +2029,9 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     bool SupressedBoundDescriptorWAW(const HazardResult &hazard) const;
 
     void CreateDevice(const VkDeviceCreateInfo *pCreateInfo) override;
+    void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) override;
+    // Logs the memory used by the access state of the queue batches still alive, if the syncval_memory_report setting is enabled.
+    void ReportAccessStateMemory();
 
     bool ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                  const VkSubpassBeginInfo *pSubpassBeginInfo, CMD_TYPE cmd_type) const;
@@ -25,6 +25,8 @@
 #include "vk_layer_config.h"
 
 #include <string.h>
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -39,6 +41,8 @@
 #include <direct.h>
 #define GetCurrentDir _getcwd
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #define GetCurrentDir getcwd
 #endif
@@ -63,7 +67,12 @@ class ConfigFile {
     void ParseFile(const char *filename);
 };
 
-static ConfigFile layer_config;
+// Function-local static, so that options can be queried during static initialization of other translation units
+// (e.g. by global vl_concurrent_unordered_map instances).
+static ConfigFile &GetLayerConfig() {
+    static ConfigFile layer_config;
+    return layer_config;
+}
 
 VK_LAYER_EXPORT std::string GetEnvironment(const char *variable) {
 #if !defined(__ANDROID__) && !defined(_WIN32)
@@ -103,7 +112,86 @@ VK_LAYER_EXPORT std::string GetEnvironment(const char *variable) {
 #endif
 }
 
-VK_LAYER_EXPORT const char *getLayerOption(const char *option) { return layer_config.GetOption(option); }
+VK_LAYER_EXPORT bool GetBoolSetting(const char *variable, const char *option) {
+    std::string setting = GetEnvironment(variable);
+    if (setting.empty()) {
+        setting = getLayerOption(option);
+    }
+    std::transform(setting.begin(), setting.end(), setting.begin(), ::tolower);
+    return (setting == "true") || (std::atoi(setting.c_str()) != 0);
+}
+
+VK_LAYER_EXPORT std::string GetLayerCacheFilePath(const char *name) {
+    auto tmp_path = GetEnvironment("XDG_CACHE_HOME");
+    if (!tmp_path.size()) {
+        auto cachepath = GetEnvironment("HOME") + "/.cache";
+        struct stat info;
+        if (stat(cachepath.c_str(), &info) == 0) {
+            if ((info.st_mode & S_IFMT) == S_IFDIR) {
+                tmp_path = cachepath;
+            }
+        }
+    }
+    if (!tmp_path.size()) tmp_path = GetEnvironment("TMPDIR");
+    if (!tmp_path.size()) tmp_path = GetEnvironment("TMP");
+    if (!tmp_path.size()) tmp_path = GetEnvironment("TEMP");
+    if (!tmp_path.size()) tmp_path = "/tmp";
+    std::string path = tmp_path + "/" + name;
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+    path += "-" + std::to_string(getuid());
+#endif
+    path += ".bin";
+    return path;
+}
+
+#if defined(_WIN32)
+LayerMappedFile::LayerMappedFile(const std::string &path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return;
+    LARGE_INTEGER file_size;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping) {
+            // The view keeps the mapping alive after its handle is closed
+            data_ = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (data_) {
+                size_ = static_cast<size_t>(file_size.QuadPart);
+            }
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+}
+
+LayerMappedFile::~LayerMappedFile() {
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+}
+#else
+LayerMappedFile::LayerMappedFile(const std::string &path) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        void *data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            data_ = data;
+            size_ = static_cast<size_t>(info.st_size);
+        }
+    }
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+}
+
+LayerMappedFile::~LayerMappedFile() {
+    if (data_) {
+        munmap(data_, size_);
+    }
+}
+#endif
+
+VK_LAYER_EXPORT const char *getLayerOption(const char *option) { return GetLayerConfig().GetOption(option); }
 VK_LAYER_EXPORT const char *GetLayerEnvVar(const char *option) {
     // NOTE: new code should use GetEnvironment directly. This is a workaround for the problem
     // described in https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/3048
@@ -112,7 +200,7 @@ VK_LAYER_EXPORT const char *GetLayerEnvVar(const char *option) {
     return result.c_str();
 }
 
-VK_LAYER_EXPORT const SettingsFileInfo *GetLayerSettingsFileInfo() { return &layer_config.settings_info; }
+VK_LAYER_EXPORT const SettingsFileInfo *GetLayerSettingsFileInfo() { return &GetLayerConfig().settings_info; }
 
 // If option is NULL or stdout, return stdout, otherwise try to open option
 // as a filename. If successful, return file handle, otherwise stdout
@@ -139,7 +227,7 @@ VK_LAYER_EXPORT FILE *getLayerLogOutput(const char *option, const char *layer_na
 VK_LAYER_EXPORT VkFlags GetLayerOptionFlags(const string &option, layer_data::unordered_map<string, VkFlags> const &enum_data,
                                             uint32_t option_default) {
     VkDebugReportFlagsEXT flags = option_default;
-    string option_list = layer_config.GetOption(option.c_str());
+    string option_list = GetLayerConfig().GetOption(option.c_str());
 
     while (option_list.length() != 0) {
         // Find length of option string
@@ -172,7 +260,7 @@ VK_LAYER_EXPORT VkFlags GetLayerOptionFlags(const string &option, layer_data::un
     return flags;
 }
 
-VK_LAYER_EXPORT void setLayerOption(const char *option, const char *value) { layer_config.SetOption(option, value); }
+VK_LAYER_EXPORT void setLayerOption(const char *option, const char *value) { GetLayerConfig().SetOption(option, value); }
 
 // Constructor for ConfigFile. Initialize layers to log error messages to stdout by default. If a vk_layer_settings file is present,
 // its settings will override the defaults.
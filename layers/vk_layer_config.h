@@ -34,6 +34,27 @@
 #endif
 
 VK_LAYER_EXPORT std::string GetEnvironment(const char *variable);
+// Boolean setting read from the environment variable, or if unset from the layer option; "true" or a non-zero number enable it
+VK_LAYER_EXPORT bool GetBoolSetting(const char *variable, const char *option);
+// Path of the per-user file <name>.bin in the cache directory ($XDG_CACHE_HOME, ~/.cache or the temporary directory)
+VK_LAYER_EXPORT std::string GetLayerCacheFilePath(const char *name);
+
+// Read-only memory mapping of a whole file, so that cache files can be parsed in place instead of being copied into a buffer.
+// Data() is nullptr if the file does not exist, is empty or cannot be mapped.
+class LayerMappedFile {
+  public:
+    explicit LayerMappedFile(const std::string &path);
+    ~LayerMappedFile();
+    LayerMappedFile(const LayerMappedFile &) = delete;
+    LayerMappedFile &operator=(const LayerMappedFile &) = delete;
+
+    const void *Data() const { return data_; }
+    size_t Size() const { return size_; }
+
+  private:
+    void *data_ = nullptr;
+    size_t size_ = 0;
+};
 
 #ifdef __cplusplus
 extern "C" {
@@ -25,7 +25,10 @@
 
 #include <cmath>
 
+#include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <map>
@@ -36,6 +39,7 @@
 #include <type_traits>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #ifdef USE_ROBIN_HOOD_HASHING
 #include "robin_hood.h"
@@ -793,6 +797,7 @@ class span {
     size_t size() const { return count_; }
 
     pointer data() { return data_; }
+    const T *data() const { return data_; }
 
   private:
     pointer data_ = {};
@@ -930,5 +935,357 @@ T GetQuotientCeil(T numerator, T denominator) {
     return static_cast<T>(std::ceil(static_cast<double>(numerator) / static_cast<double>(denominator)));
 }
 
+// Bump allocator for state that lives exactly as long as one "recording" (e.g. of a command buffer) and is discarded all at
+// once. Deallocation is a no-op except for the most recent allocation, so that a growing vector at the top of the arena can
+// be extended in place. Reset() returns all memory in one step; if the previous recording spilled into several blocks they
+// are coalesced into a single block large enough for the next recording, up to kMaxBlockSize. A block left mostly unused by
+// kShrinkResets recordings in a row is replaced by a smaller one, so one large recording does not pin its memory for the
+// lifetime of the owner. Not thread safe: the owner must serialize access.
+class MonotonicArena {
+  public:
+    static constexpr size_t kDefaultBlockSize = 4096;
+    static constexpr size_t kMaxBlockSize = 1024 * 1024;
+    static constexpr uint32_t kShrinkResets = 8;
+
+    explicit MonotonicArena(size_t block_size = kDefaultBlockSize) : initial_block_size_(block_size), block_size_(block_size) {}
+    MonotonicArena(const MonotonicArena &) = delete;
+    MonotonicArena &operator=(const MonotonicArena &) = delete;
+    ~MonotonicArena() { FreeBlocks(); }
+
+    void *Allocate(size_t size, size_t alignment) {
+        uintptr_t aligned = (cursor_ + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        if (!head_ || aligned + size > limit_) {
+            NewBlock(size + alignment);
+            aligned = (cursor_ + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        }
+        last_ = aligned;
+        cursor_ = aligned + size;
+        bytes_allocated_ += size;
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    void Deallocate(void *p, size_t size) {
+        if (reinterpret_cast<uintptr_t>(p) == last_ && last_ + size == cursor_) {
+            cursor_ = last_;
+        }
+    }
+
+    void Reset() {
+        if (head_ && head_->next) {
+            FreeBlocks();
+            block_size_ = std::min(std::max(block_size_, bytes_allocated_), std::max(initial_block_size_, kMaxBlockSize));
+            underused_resets_ = 0;
+            underused_peak_ = 0;
+        } else if (head_) {
+            cursor_ = head_->Begin();
+            if (head_->size > initial_block_size_ && bytes_allocated_ <= head_->size / 4) {
+                underused_peak_ = std::max(underused_peak_, bytes_allocated_);
+                if (++underused_resets_ >= kShrinkResets) {
+                    FreeBlocks();
+                    block_size_ = std::max(initial_block_size_, underused_peak_ * 2);
+                    underused_resets_ = 0;
+                    underused_peak_ = 0;
+                }
+            } else {
+                underused_resets_ = 0;
+                underused_peak_ = 0;
+            }
+        }
+        last_ = 0;
+        bytes_allocated_ = 0;
+    }
+
+    size_t BytesAllocated() const { return bytes_allocated_; }
+
+  private:
+    struct Block {
+        Block *next;
+        size_t size;
+        uintptr_t Begin() { return reinterpret_cast<uintptr_t>(this + 1); }
+    };
+
+    void NewBlock(size_t min_size) {
+        const size_t size = std::max(block_size_, min_size);
+        auto *block = static_cast<Block *>(::operator new(sizeof(Block) + size));
+        block->next = head_;
+        block->size = size;
+        head_ = block;
+        cursor_ = block->Begin();
+        limit_ = cursor_ + size;
+    }
+
+    void FreeBlocks() {
+        while (head_) {
+            Block *next = head_->next;
+            ::operator delete(head_);
+            head_ = next;
+        }
+        cursor_ = limit_ = last_ = 0;
+    }
+
+    Block *head_ = nullptr;
+    uintptr_t cursor_ = 0;
+    uintptr_t limit_ = 0;
+    uintptr_t last_ = 0;
+    const size_t initial_block_size_;
+    size_t block_size_;
+    size_t bytes_allocated_ = 0;
+    // Consecutive resets that used at most a quarter of the block, and the most bytes any of them allocated
+    uint32_t underused_resets_ = 0;
+    size_t underused_peak_ = 0;
+};
+
+// Standard allocator drawing from a MonotonicArena. A default constructed allocator, and any copy of a container made through
+// copy construction, uses the heap instead so that copies may safely outlive the arena's next Reset().
+template <typename T>
+class ArenaAllocator {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    ArenaAllocator() noexcept = default;
+    explicit ArenaAllocator(MonotonicArena *arena) noexcept : arena_(arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept : arena_(other.arena()) {}
+
+    T *allocate(size_t n) {
+        if (!arena_) return static_cast<T *>(::operator new(n * sizeof(T)));
+        return static_cast<T *>(arena_->Allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T *p, size_t n) noexcept {
+        if (!arena_) {
+            ::operator delete(p);
+        } else {
+            arena_->Deallocate(p, n * sizeof(T));
+        }
+    }
+
+    ArenaAllocator select_on_container_copy_construction() const { return ArenaAllocator(); }
+    MonotonicArena *arena() const { return arena_; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const {
+        return arena_ == other.arena();
+    }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &other) const {
+        return arena_ != other.arena();
+    }
+
+  private:
+    MonotonicArena *arena_ = nullptr;
+};
+
+template <typename T>
+using arena_vector = std::vector<T, ArenaAllocator<T>>;
+
+// Drop all elements and storage of an arena backed container, as required before the arena is reset
+template <typename Container>
+void ReleaseArenaStorage(Container &c) {
+    c = Container(c.get_allocator());
+}
+
+// Free list pool for node based containers, which allocate and free one node of a single size at a time. Nodes are carved out
+// of blocks of growing size, so that entries inserted together share cache lines and pages instead of being scattered over the
+// heap, and freed nodes are reused most recently freed first. The pool and its first, small, block are a single allocation,
+// so a container holding a handful of nodes costs no more allocations than with the heap. Once every node has been freed
+// the blocks after the first one are returned to the heap. Not thread safe: the owner must serialize access.
+class NodePool {
+  public:
+    // Creates a pool serving nodes of node_size bytes, owned by the caller until Release
+    static NodePool *Create(size_t node_size) {
+        const size_t slot_size = RoundUp(std::max(node_size, sizeof(FreeSlot)));
+        void *storage = ::operator new(RoundUp(sizeof(NodePool)) + kFirstBlockNodes * slot_size);
+        return new (storage) NodePool(node_size, slot_size);
+    }
+    NodePool(const NodePool &) = delete;
+    NodePool &operator=(const NodePool &) = delete;
+
+    void AddRef() { refs_.fetch_add(1, std::memory_order_relaxed); }
+    void Release() {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            this->~NodePool();
+            ::operator delete(this);
+        }
+    }
+
+    // Returns nullptr if the pool serves nodes of another size, in which case the caller must use the heap
+    void *Allocate(size_t size) {
+        if (size != node_size_) return nullptr;
+        ++live_nodes_;
+        if (free_) {
+            FreeSlot *slot = free_;
+            free_ = slot->next;
+            return slot;
+        }
+        if (cursor_ == limit_) {
+            NewBlock();
+        }
+        void *node = cursor_;
+        cursor_ += slot_size_;
+        return node;
+    }
+
+    // Returns false if the node was not allocated from the pool
+    bool Deallocate(void *node, size_t size) {
+        if (size != node_size_) return false;
+        if (--live_nodes_ == 0) {
+            Reset();
+            return true;
+        }
+        auto *slot = static_cast<FreeSlot *>(node);
+        slot->next = free_;
+        free_ = slot;
+        return true;
+    }
+
+    // Bytes held by the pool, including free and not yet used slots
+    size_t Capacity() const { return capacity_; }
+
+  private:
+    static constexpr size_t kFirstBlockNodes = 4;
+    static constexpr size_t kMaxBlockNodes = 1024;
+
+    struct Block {
+        Block *next;
+    };
+    struct FreeSlot {
+        FreeSlot *next;
+    };
+
+    static constexpr size_t RoundUp(size_t size) {
+        return (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    }
+
+    NodePool(size_t node_size, size_t slot_size) : node_size_(node_size), slot_size_(slot_size) { Reset(); }
+    ~NodePool() { FreeBlocks(); }
+
+    uint8_t *FirstBlock() { return reinterpret_cast<uint8_t *>(this) + RoundUp(sizeof(NodePool)); }
+
+    void NewBlock() {
+        const size_t header_size = RoundUp(sizeof(Block));
+        const size_t block_size = header_size + block_nodes_ * slot_size_;
+        auto *block = static_cast<Block *>(::operator new(block_size));
+        block->next = blocks_;
+        blocks_ = block;
+        capacity_ += block_size;
+        cursor_ = reinterpret_cast<uint8_t *>(block) + header_size;
+        limit_ = cursor_ + block_nodes_ * slot_size_;
+        block_nodes_ = std::min(block_nodes_ * 2, kMaxBlockNodes);
+    }
+
+    void FreeBlocks() {
+        while (blocks_) {
+            Block *next = blocks_->next;
+            ::operator delete(blocks_);
+            blocks_ = next;
+        }
+    }
+
+    // Back to the state of a new pool, keeping only the first block
+    void Reset() {
+        FreeBlocks();
+        free_ = nullptr;
+        cursor_ = FirstBlock();
+        limit_ = cursor_ + kFirstBlockNodes * slot_size_;
+        block_nodes_ = kFirstBlockNodes * 2;
+        capacity_ = RoundUp(sizeof(NodePool)) + kFirstBlockNodes * slot_size_;
+    }
+
+    std::atomic<uint32_t> refs_{1};
+    const size_t node_size_;
+    const size_t slot_size_;
+    size_t live_nodes_ = 0;
+    size_t block_nodes_ = 0;
+    size_t capacity_ = 0;
+    Block *blocks_ = nullptr;
+    FreeSlot *free_ = nullptr;
+    uint8_t *cursor_ = nullptr;
+    uint8_t *limit_ = nullptr;
+};
+
+// Standard allocator drawing single nodes from a NodePool shared by all copies of the allocator. The pool is only created by
+// the first allocation, so empty and moved-from containers don't hold one. Copy constructing a container gives the copy a
+// pool of its own, and moving a container moves its pool, leaving the moved-from container to create a new one if reused.
+template <typename T>
+class NodePoolAllocator {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    NodePoolAllocator() noexcept = default;
+    NodePoolAllocator(const NodePoolAllocator &other) noexcept : pool_(other.pool_) {
+        if (pool_) pool_->AddRef();
+    }
+    NodePoolAllocator(NodePoolAllocator &&other) noexcept : pool_(other.pool_) { other.pool_ = nullptr; }
+    template <typename U>
+    NodePoolAllocator(const NodePoolAllocator<U> &other) noexcept : pool_(other.pool()) {
+        if (pool_) pool_->AddRef();
+    }
+    NodePoolAllocator &operator=(const NodePoolAllocator &other) noexcept {
+        if (pool_ != other.pool_) {
+            if (other.pool_) other.pool_->AddRef();
+            if (pool_) pool_->Release();
+            pool_ = other.pool_;
+        }
+        return *this;
+    }
+    NodePoolAllocator &operator=(NodePoolAllocator &&other) noexcept {
+        if (this != &other) {
+            if (pool_) pool_->Release();
+            pool_ = other.pool_;
+            other.pool_ = nullptr;
+        }
+        return *this;
+    }
+    ~NodePoolAllocator() {
+        if (pool_) pool_->Release();
+    }
+
+    T *allocate(size_t n) {
+        if (n == 1 && kPoolable) {
+            if (!pool_) pool_ = NodePool::Create(sizeof(T));
+            if (void *node = pool_->Allocate(sizeof(T))) return static_cast<T *>(node);
+        }
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T *p, size_t n) noexcept {
+        if (n == 1 && kPoolable && pool_ && pool_->Deallocate(p, sizeof(T))) return;
+        ::operator delete(p);
+    }
+
+    NodePoolAllocator select_on_container_copy_construction() const { return NodePoolAllocator(); }
+    NodePool *pool() const { return pool_; }
+
+    template <typename U>
+    bool operator==(const NodePoolAllocator<U> &other) const {
+        return pool_ == other.pool();
+    }
+    template <typename U>
+    bool operator!=(const NodePoolAllocator<U> &other) const {
+        return pool_ != other.pool();
+    }
+
+  private:
+#if defined(_MSC_VER) && defined(_ITERATOR_DEBUG_LEVEL) && (_ITERATOR_DEBUG_LEVEL != 0)
+    // Checked iterators allocate their container proxy through temporary copies of the allocator, which would own the pool
+    static constexpr bool kPoolable = false;
+#else
+    static constexpr bool kPoolable = alignof(T) <= alignof(std::max_align_t);
+#endif
+    NodePool *pool_ = nullptr;
+};
+
+// std::map with its nodes allocated from a NodePool. Iterators stay valid across insertion and erasure as with std::map,
+// which the range_map helpers (cached lower bounds, parallel iterators) rely on.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using pooled_map = std::map<Key, T, Compare, NodePoolAllocator<std::pair<const Key, T>>>;
+
 }  // namespace layer_data
 #endif  // LAYER_DATA_H
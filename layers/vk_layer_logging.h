@@ -659,20 +659,73 @@ static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
 }
 #endif
 
+// Collects the messages logged by a thread instead of reporting them, so that validation spread across worker threads can
+// be reported from the calling thread in a deterministic order. Filtering by severity, type and message id still happens
+// when a message is logged; the duplicate message limit depends on message order and is applied by Report().
+class LogMessageCapture {
+  public:
+    // Redirects the messages logged by the current thread into capture for the lifetime of the scope
+    class Scope {
+      public:
+        explicit Scope(LogMessageCapture &capture) : previous_(Current()) { Current() = &capture; }
+        ~Scope() { Current() = previous_; }
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+      private:
+        LogMessageCapture *previous_;
+    };
+
+    static LogMessageCapture *Active() { return Current(); }
+    // Records that a message was dropped by the severity or message ID filters while the capture was active
+    static void NoteFiltered() {
+        if (auto *capture = Current()) {
+            capture->filtered_ = true;
+        }
+    }
+
+    bool empty() const { return messages_.empty(); }
+    // True if messages were filtered out, so empty() does not mean that nothing was found
+    bool Filtered() const { return filtered_; }
+    void Add(VkFlags msg_flags, const LogObjectList &objects, const std::string &vuid_text, const char *err_msg) {
+        messages_.emplace_back(Message{msg_flags, objects, vuid_text, err_msg ? err_msg : "Allocation failure"});
+    }
+    // Reports the captured messages in the order they were logged and returns true if any callback asked to skip the call
+    inline bool Report(const debug_report_data *debug_data);
+
+  private:
+    struct Message {
+        VkFlags msg_flags;
+        LogObjectList objects;
+        std::string vuid_text;
+        std::string text;
+    };
+    static LogMessageCapture *&Current() {
+        static thread_local LogMessageCapture *current = nullptr;
+        return current;
+    }
+
+    std::vector<Message> messages_;
+    bool filtered_ = false;
+};
+
 // helper for VUID based filtering. This needs to be separate so it can be called before incurring
 // the cost of sprintf()-ing the err_msg needed by LogMsgLocked().
 static inline bool LogMsgEnabled(const debug_report_data *debug_data, const std::string &vuid_text,
                                  VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type) {
     if (!(debug_data->active_severities & severity) || !(debug_data->active_types & type)) {
+        LogMessageCapture::NoteFiltered();
         return false;
     }
     // If message is in filter list, bail out very early
     const uint32_t message_id = XXH32(vuid_text.data(), vuid_text.size(), 8);
     if (std::find(debug_data->filter_message_ids.begin(), debug_data->filter_message_ids.end(), message_id)
         != debug_data->filter_message_ids.end()) {
+        LogMessageCapture::NoteFiltered();
         return false;
     }
-    if ((debug_data->duplicate_message_limit > 0) && UpdateLogMsgCounts(debug_data, static_cast<int32_t>(message_id))) {
+    if ((debug_data->duplicate_message_limit > 0) && !LogMessageCapture::Active() &&
+        UpdateLogMsgCounts(debug_data, static_cast<int32_t>(message_id))) {
         // Count for this particular message is over the limit, ignore it
         return false;
     }
@@ -681,6 +734,11 @@ static inline bool LogMsgEnabled(const debug_report_data *debug_data, const std:
 
 static inline bool LogMsgLocked(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
                                 const std::string &vuid_text, char *err_msg) {
+    if (auto *capture = LogMessageCapture::Active()) {
+        capture->Add(msg_flags, objects, vuid_text, err_msg);
+        free(err_msg);
+        return false;
+    }
     std::string str_plus_spec_text(err_msg ? err_msg : "Allocation failure");
 
     // Append the spec error text to the error message, unless it's an UNASSIGNED or UNDEFINED vuid
@@ -741,6 +799,25 @@ static inline bool LogMsgLocked(const debug_report_data *debug_data, VkFlags msg
     return result;
 }
 
+bool LogMessageCapture::Report(const debug_report_data *debug_data) {
+    bool skip = false;
+    for (const auto &message : messages_) {
+        std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
+        const uint32_t message_id = XXH32(message.vuid_text.data(), message.vuid_text.size(), 8);
+        if ((debug_data->duplicate_message_limit > 0) && UpdateLogMsgCounts(debug_data, static_cast<int32_t>(message_id))) {
+            continue;
+        }
+        // LogMsgLocked takes ownership of a malloc'd message
+        char *text = static_cast<char *>(malloc(message.text.size() + 1));
+        if (text) {
+            memcpy(text, message.text.c_str(), message.text.size() + 1);
+        }
+        skip |= LogMsgLocked(debug_data, message.msg_flags, message.objects, message.vuid_text, text);
+    }
+    messages_.clear();
+    return skip;
+}
+
 static inline VKAPI_ATTR VkBool32 VKAPI_CALL report_log_callback(VkFlags msg_flags, VkDebugReportObjectTypeEXT obj_type,
                                                                  uint64_t src_object, size_t location, int32_t msg_code,
                                                                  const char *layer_prefix, const char *message, void *user_data) {
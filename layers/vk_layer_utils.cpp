@@ -22,7 +22,9 @@
 #include "vk_layer_utils.h"
 
 #include <string.h>
+#include <algorithm>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "vulkan/vulkan.h"
@@ -219,3 +221,38 @@ VK_LAYER_EXPORT VkLayerDeviceCreateInfo *get_chain_info(const VkDeviceCreateInfo
     assert(chain_info != NULL);
     return chain_info;
 }
+
+static vl_concurrent_map_config ReadConcurrentMapConfig() {
+    vl_concurrent_map_config config;
+
+    std::string buckets = GetEnvironment("VK_LAYER_CONCURRENT_MAP_BUCKETS");
+    if (buckets.empty()) {
+        buckets = getLayerOption("khronos_validation.concurrent_map_buckets");
+    }
+    std::transform(buckets.begin(), buckets.end(), buckets.begin(), ::tolower);
+    if (buckets == "auto") {
+        config.bucket_mode = vl_concurrent_map_config::BucketMode::kAuto;
+        // Aim for roughly one bucket per hardware thread.
+        const uint32_t threads = std::max(1u, std::thread::hardware_concurrency());
+        while ((1u << config.buckets_log2) < threads && config.buckets_log2 < vl_concurrent_map_config::kMaxBucketsLog2) {
+            ++config.buckets_log2;
+        }
+    } else if (!buckets.empty()) {
+        const long count = std::strtol(buckets.c_str(), nullptr, 10);
+        if (count > 0) {
+            config.bucket_mode = vl_concurrent_map_config::BucketMode::kFixed;
+            while ((1l << config.buckets_log2) < count && config.buckets_log2 < vl_concurrent_map_config::kMaxBucketsLog2) {
+                ++config.buckets_log2;
+            }
+        }
+    }
+
+    config.collect_stats = GetBoolSetting("VK_LAYER_CONCURRENT_MAP_STATS", "khronos_validation.concurrent_map_stats");
+
+    return config;
+}
+
+const vl_concurrent_map_config &vl_concurrent_map_config::Get() {
+    static const vl_concurrent_map_config config = ReadConcurrentMapConfig();
+    return config;
+}
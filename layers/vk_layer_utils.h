@@ -354,6 +354,10 @@ static inline int u_ffs(int val) {
 #endif
 
 #ifdef __cplusplus
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <mutex>
 #include <shared_mutex>
 
 // Aliases to avoid excessive typing. We can't easily auto these away because
@@ -373,6 +377,36 @@ class LockedSharedPtr : public std::shared_ptr<T> {
     Guard guard_;
 };
 
+// Runtime tuning shared by all vl_concurrent_unordered_map instances. Read once, from the layer settings file or the
+// corresponding environment variable:
+//   khronos_validation.concurrent_map_buckets (VK_LAYER_CONCURRENT_MAP_BUCKETS): number of lock buckets per map, rounded up
+//       to a power of two, or "auto" to scale with std::thread::hardware_concurrency(). When unset each map uses its
+//       compile-time BUCKETSLOG2.
+//   khronos_validation.concurrent_map_stats (VK_LAYER_CONCURRENT_MAP_STATS): collect per-bucket lock contention counters,
+//       which are reported at vkDestroyDevice.
+struct vl_concurrent_map_config {
+    static constexpr int kMaxBucketsLog2 = 10;
+
+    enum class BucketMode { kCompileTime, kFixed, kAuto };
+    BucketMode bucket_mode = BucketMode::kCompileTime;
+    int buckets_log2 = 0;
+    bool collect_stats = false;
+
+    // Effective log2 bucket count for a map whose compile-time default is default_log2.
+    int BucketsLog2(int default_log2) const {
+        switch (bucket_mode) {
+            case BucketMode::kFixed:
+                return buckets_log2;
+            case BucketMode::kAuto:
+                return std::max(default_log2, buckets_log2);
+            default:
+                return default_log2;
+        }
+    }
+
+    static const vl_concurrent_map_config &Get();
+};
+
 // Limited concurrent_unordered_map that supports internally-synchronized
 // insert/erase/access. Splits locking across N buckets and uses shared_mutex
 // for read/write locking. Iterators are not supported. The following
@@ -397,20 +431,30 @@ class LockedSharedPtr : public std::shared_ptr<T> {
 //
 // snapshot: Return an array of elements (key, value pairs) that satisfy an optional
 // predicate. This can be used as a substitute for iterators in exceptional cases.
+//
+// BUCKETSLOG2 is the default number of buckets, which can be overridden at runtime through
+// vl_concurrent_map_config.
 template <typename Key, typename T, int BUCKETSLOG2 = 2, typename Hash = layer_data::hash<Key>>
 class vl_concurrent_unordered_map {
   public:
+    vl_concurrent_unordered_map()
+        : buckets_log2(vl_concurrent_map_config::Get().BucketsLog2(BUCKETSLOG2)),
+          num_buckets(1 << buckets_log2),
+          collect_stats(vl_concurrent_map_config::Get().collect_stats),
+          maps(new layer_data::unordered_map<Key, T, Hash>[num_buckets]),
+          locks(new BucketLock[num_buckets]) {}
+
     template <typename... Args>
     void insert_or_assign(const Key &key, Args &&...args) {
         uint32_t h = ConcurrentMapHashObject(key);
-        WriteLockGuard lock(locks[h].lock);
+        auto lock = LockBucket<WriteLockGuard>(h);
         maps[h][key] = {std::forward<Args>(args)...};
     }
 
     template <typename... Args>
     bool insert(const Key &key, Args &&...args) {
         uint32_t h = ConcurrentMapHashObject(key);
-        WriteLockGuard lock(locks[h].lock);
+        auto lock = LockBucket<WriteLockGuard>(h);
         auto ret = maps[h].emplace(key, std::forward<Args>(args)...);
         return ret.second;
     }
@@ -418,13 +462,13 @@ class vl_concurrent_unordered_map {
     // returns size_type
     size_t erase(const Key &key) {
         uint32_t h = ConcurrentMapHashObject(key);
-        WriteLockGuard lock(locks[h].lock);
+        auto lock = LockBucket<WriteLockGuard>(h);
         return maps[h].erase(key);
     }
 
     bool contains(const Key &key) const {
         uint32_t h = ConcurrentMapHashObject(key);
-        ReadLockGuard lock(locks[h].lock);
+        auto lock = LockBucket<ReadLockGuard>(h);
         return maps[h].count(key) != 0;
     }
 
@@ -458,7 +502,7 @@ class vl_concurrent_unordered_map {
 
     FindResult find(const Key &key) const {
         uint32_t h = ConcurrentMapHashObject(key);
-        ReadLockGuard lock(locks[h].lock);
+        auto lock = LockBucket<ReadLockGuard>(h);
 
         auto itr = maps[h].find(key);
         bool found = itr != maps[h].end();
@@ -472,7 +516,7 @@ class vl_concurrent_unordered_map {
 
     FindResult pop(const Key &key) {
         uint32_t h = ConcurrentMapHashObject(key);
-        WriteLockGuard lock(locks[h].lock);
+        auto lock = LockBucket<WriteLockGuard>(h);
 
         auto itr = maps[h].find(key);
         bool found = itr != maps[h].end();
@@ -488,8 +532,8 @@ class vl_concurrent_unordered_map {
 
     std::vector<std::pair<const Key, T>> snapshot(std::function<bool(T)> f = nullptr) const {
         std::vector<std::pair<const Key, T>> ret;
-        for (int h = 0; h < BUCKETS; ++h) {
-            ReadLockGuard lock(locks[h].lock);
+        for (uint32_t h = 0; h < num_buckets; ++h) {
+            auto lock = LockBucket<ReadLockGuard>(h);
             for (const auto &j : maps[h]) {
                 if (!f || f(j.second)) {
                     ret.emplace_back(j.first, j.second);
@@ -500,16 +544,16 @@ class vl_concurrent_unordered_map {
     }
 
     void clear() {
-        for (int h = 0; h < BUCKETS; ++h) {
-            WriteLockGuard lock(locks[h].lock);
+        for (uint32_t h = 0; h < num_buckets; ++h) {
+            auto lock = LockBucket<WriteLockGuard>(h);
             maps[h].clear();
         }
     }
 
     size_t size() const {
         size_t result = 0;
-        for (int h = 0; h < BUCKETS; ++h) {
-            ReadLockGuard lock(locks[h].lock);
+        for (uint32_t h = 0; h < num_buckets; ++h) {
+            auto lock = LockBucket<ReadLockGuard>(h);
             result += maps[h].size();
         }
         return result;
@@ -517,22 +561,670 @@ class vl_concurrent_unordered_map {
 
     bool empty() const {
         bool result = 0;
-        for (int h = 0; h < BUCKETS; ++h) {
-            ReadLockGuard lock(locks[h].lock);
+        for (uint32_t h = 0; h < num_buckets; ++h) {
+            auto lock = LockBucket<ReadLockGuard>(h);
             result |= maps[h].empty();
         }
         return result;
     }
 
+    // Appends the per-bucket lock contention counters to out. Nothing is written unless
+    // vl_concurrent_map_config::collect_stats is set and the map has been accessed.
+    void ReportContention(const char *name, std::ostream &out) const {
+        if (!collect_stats) return;
+        uint64_t total_acquisitions = 0;
+        uint64_t total_contended = 0;
+        uint64_t total_wait_ns = 0;
+        for (uint32_t h = 0; h < num_buckets; ++h) {
+            total_acquisitions += locks[h].acquisitions.load(std::memory_order_relaxed);
+            total_contended += locks[h].contended.load(std::memory_order_relaxed);
+            total_wait_ns += locks[h].wait_ns.load(std::memory_order_relaxed);
+        }
+        if (total_acquisitions == 0) return;
+        out << name << ": buckets " << num_buckets << ", lock acquisitions " << total_acquisitions << ", contended "
+            << total_contended << ", wait " << (total_wait_ns / 1000) << "us\n";
+        for (uint32_t h = 0; h < num_buckets; ++h) {
+            const uint64_t contended = locks[h].contended.load(std::memory_order_relaxed);
+            if (contended == 0) continue;
+            out << "    bucket " << h << ": lock acquisitions " << locks[h].acquisitions.load(std::memory_order_relaxed)
+                << ", contended " << contended << ", wait " << (locks[h].wait_ns.load(std::memory_order_relaxed) / 1000)
+                << "us\n";
+        }
+    }
+
   private:
-    static const int BUCKETS = (1 << BUCKETSLOG2);
+    const int buckets_log2;
+    const uint32_t num_buckets;
+    const bool collect_stats;
 
-    layer_data::unordered_map<Key, T, Hash> maps[BUCKETS];
-    struct {
+    struct alignas(64) BucketLock {
+        // alignas puts each lock on its own cache line to avoid false cache line sharing.
         mutable std::shared_mutex lock;
-        // Put each lock on its own cache line to avoid false cache line sharing.
-        char padding[(-int(sizeof(std::shared_mutex))) & 63];
-    } locks[BUCKETS];
+        // Contention counters, only updated when collect_stats is set.
+        mutable std::atomic<uint64_t> acquisitions{0};
+        mutable std::atomic<uint64_t> contended{0};
+        mutable std::atomic<uint64_t> wait_ns{0};
+    };
+
+    std::unique_ptr<layer_data::unordered_map<Key, T, Hash>[]> maps;
+    std::unique_ptr<BucketLock[]> locks;
+
+    template <typename Guard>
+    Guard LockBucket(uint32_t h) const {
+        auto &bucket = locks[h];
+        if (!collect_stats) {
+            return Guard(bucket.lock);
+        }
+        Guard guard(bucket.lock, std::try_to_lock);
+        if (!guard.owns_lock()) {
+            const auto start = std::chrono::steady_clock::now();
+            guard.lock();
+            const auto wait = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            bucket.wait_ns.fetch_add(static_cast<uint64_t>(wait.count()), std::memory_order_relaxed);
+            bucket.contended.fetch_add(1, std::memory_order_relaxed);
+        }
+        bucket.acquisitions.fetch_add(1, std::memory_order_relaxed);
+        return guard;
+    }
+
+    uint32_t ConcurrentMapHashObject(const Key &object) const {
+        uint64_t u64 = (uint64_t)(uintptr_t)object;
+        uint32_t hash = (uint32_t)(u64 >> 32) + (uint32_t)u64;
+        hash ^= (hash >> buckets_log2) ^ (hash >> (2 * buckets_log2));
+        hash &= (num_buckets - 1);
+        return hash;
+    }
+};
+
+// Concurrent table mapping densely allocated 64-bit ids to 64-bit values, used for handle wrapping.
+//
+// Ids are allocated by the table (add) rather than supplied by the caller. The low 32 bits of an id index a slot in
+// a segmented array, the high 32 bits hold the slot's generation. Lookups are lock-free: two atomic loads of the
+// generation bracket an atomic load of the value, so a lookup racing with the destruction and reuse of the slot
+// returns end() instead of the new occupant. Freed slots are recycled through a free list and their generation
+// is bumped, so stale ids never resolve.
+//
+// find/pop/erase/end follow vl_concurrent_unordered_map, so callers can switch between the two.
+class vl_concurrent_id_table {
+  public:
+    vl_concurrent_id_table() = default;
+    vl_concurrent_id_table(const vl_concurrent_id_table &) = delete;
+    vl_concurrent_id_table &operator=(const vl_concurrent_id_table &) = delete;
+
+    ~vl_concurrent_id_table() {
+        for (auto &page : pages_) {
+            delete[] page.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Stores value in a free slot and returns its id, which is never 0.
+    uint64_t add(uint64_t value) {
+        uint32_t index;
+        {
+            std::lock_guard<std::mutex> lock(free_lock_);
+            if (!free_slots_.empty()) {
+                index = free_slots_.back();
+                free_slots_.pop_back();
+            } else {
+                assert(next_index_ < std::numeric_limits<uint32_t>::max() - kFirstPageSize);
+                index = next_index_++;
+            }
+        }
+        Slot &slot = GetSlot(index, true);
+        slot.value.store(value, std::memory_order_release);
+        const uint64_t generation = slot.generation.load(std::memory_order_relaxed);
+        return (generation << kGenerationShift) | index;
+    }
+
+    // type returned by find() and end().
+    class FindResult {
+      public:
+        FindResult(bool a, uint64_t b) : result(a, b) {}
+
+        // == and != only support comparing against end()
+        bool operator==(const FindResult &other) const { return result.first == false && other.result.first == false; }
+        bool operator!=(const FindResult &other) const { return !(*this == other); }
+
+        // Make -> act kind of like an iterator.
+        std::pair<bool, uint64_t> *operator->() { return &result; }
+        const std::pair<bool, uint64_t> *operator->() const { return &result; }
+
+      private:
+        // (found, value)
+        std::pair<bool, uint64_t> result;
+    };
+
+    FindResult end() const { return FindResult(false, 0); }
+    FindResult cend() const { return end(); }
+
+    FindResult find(uint64_t id) const {
+        const Slot *slot = FindSlot(id);
+        if (!slot) return end();
+        const uint32_t generation = Generation(id);
+        if (slot->generation.load(std::memory_order_acquire) != generation) return end();
+        const uint64_t value = slot->value.load(std::memory_order_acquire);
+        if (slot->generation.load(std::memory_order_relaxed) != generation) return end();
+        return FindResult(true, value);
+    }
+
+    bool contains(uint64_t id) const { return find(id) != end(); }
+
+    FindResult pop(uint64_t id) {
+        Slot *slot = const_cast<Slot *>(FindSlot(id));
+        if (!slot) return end();
+        // Read the value before retiring the generation; after that the slot may be reused at any time.
+        const uint64_t value = slot->value.load(std::memory_order_acquire);
+        uint32_t generation = Generation(id);
+        uint32_t next_generation = generation + 1;
+        if (next_generation == 0) {
+            // Generation 0 is reserved so that 0 is never a valid id.
+            next_generation = 1;
+        }
+        if (!slot->generation.compare_exchange_strong(generation, next_generation, std::memory_order_acq_rel)) {
+            return end();
+        }
+        {
+            std::lock_guard<std::mutex> lock(free_lock_);
+            free_slots_.push_back(Index(id));
+        }
+        return FindResult(true, value);
+    }
+
+    // returns size_type
+    size_t erase(uint64_t id) { return pop(id) != end() ? 1 : 0; }
+
+  private:
+    static constexpr uint32_t kGenerationShift = 32;
+    // Page p holds (kFirstPageSize << p) slots, so kMaxPages pages cover the full 32-bit index range.
+    static constexpr uint32_t kFirstPageLog2 = 12;
+    static constexpr uint32_t kFirstPageSize = 1u << kFirstPageLog2;
+    static constexpr uint32_t kMaxPages = 32 - kFirstPageLog2;
+
+    struct Slot {
+        std::atomic<uint32_t> generation{1};
+        std::atomic<uint64_t> value{0};
+    };
+
+    static uint32_t Index(uint64_t id) { return static_cast<uint32_t>(id); }
+    static uint32_t Generation(uint64_t id) { return static_cast<uint32_t>(id >> kGenerationShift); }
+
+    const Slot *FindSlot(uint64_t id) const {
+        const uint32_t index = Index(id);
+        if (Generation(id) == 0 || index >= next_index_hint_.load(std::memory_order_acquire)) return nullptr;
+        return &const_cast<vl_concurrent_id_table *>(this)->GetSlot(index, false);
+    }
+
+    Slot &GetSlot(uint32_t index, bool allocate) {
+        const uint32_t biased = index + kFirstPageSize;
+        const uint32_t page_index = static_cast<uint32_t>(MostSignificantBit(biased)) - kFirstPageLog2;
+        const uint32_t offset = biased - (kFirstPageSize << page_index);
+        Slot *page = pages_[page_index].load(std::memory_order_acquire);
+        if (allocate) {
+            if (!page) {
+                std::lock_guard<std::mutex> lock(page_lock_);
+                page = pages_[page_index].load(std::memory_order_relaxed);
+                if (!page) {
+                    page = new Slot[kFirstPageSize << page_index];
+                    pages_[page_index].store(page, std::memory_order_release);
+                }
+            }
+            // Publish the index only once its page exists, so FindSlot never sees an unallocated page.
+            uint32_t hint = next_index_hint_.load(std::memory_order_relaxed);
+            while (hint <= index &&
+                   !next_index_hint_.compare_exchange_weak(hint, index + 1, std::memory_order_release, std::memory_order_relaxed)) {
+            }
+        }
+        return page[offset];
+    }
+
+    std::atomic<Slot *> pages_[kMaxPages] = {};
+    // Upper bound (exclusive) of indices with allocated pages, read by lock-free lookups.
+    std::atomic<uint32_t> next_index_hint_{0};
+
+    std::mutex page_lock_;
+    std::mutex free_lock_;
+    uint32_t next_index_ = 0;
+    std::vector<uint32_t> free_slots_;
+};
+
+// Epoch based reclamation for the lock-free read side of vl_concurrent_read_mostly_map.
+//
+// A reader publishes the global epoch it observed in a per-thread, cache line sized slot for the duration of
+// a read (EpochGuard). A writer that unlinks memory advances the global epoch and tags the memory with the
+// epoch it replaced. The memory can be freed once every active reader has published a newer epoch, since
+// such readers can no longer observe the unlinked pointer. Reader slots are recycled when threads exit and
+// are never freed, so the number of slots is bounded by the peak number of concurrent threads.
+class vl_epoch_domain {
+    static constexpr uint64_t kQuiescent = 0;
+
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> epoch{kQuiescent};
+        std::atomic<bool> in_use{true};
+        // Only touched by the owning thread; allows nested read-side sections.
+        uint32_t depth = 0;
+        Slot *next = nullptr;
+    };
+
+  public:
+    static vl_epoch_domain &Get() {
+        // Intentionally leaked, so that thread_local slot release at thread exit never races static destruction.
+        static vl_epoch_domain *domain = new vl_epoch_domain;
+        return *domain;
+    }
+
+    class EpochGuard {
+      public:
+        EpochGuard() : slot_(Get().ThreadSlot()) {
+            if (slot_->depth++ == 0) {
+                slot_->epoch.store(Get().global_epoch_.load(std::memory_order_acquire), std::memory_order_relaxed);
+                // Order the epoch announcement before any load of the protected pointers.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+        ~EpochGuard() {
+            if (--slot_->depth == 0) {
+                slot_->epoch.store(kQuiescent, std::memory_order_release);
+            }
+        }
+        EpochGuard(const EpochGuard &) = delete;
+        EpochGuard &operator=(const EpochGuard &) = delete;
+
+      private:
+        Slot *slot_;
+    };
+
+    // Called by writers after unlinking memory. Returns the epoch to tag the retired memory with.
+    uint64_t Advance() { return global_epoch_.fetch_add(1, std::memory_order_seq_cst); }
+
+    // Memory retired with an epoch strictly less than the returned value is no longer reachable by any reader.
+    uint64_t OldestActiveEpoch() const {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        uint64_t oldest = global_epoch_.load(std::memory_order_acquire);
+        for (const Slot *slot = slots_.load(std::memory_order_acquire); slot; slot = slot->next) {
+            const uint64_t epoch = slot->epoch.load(std::memory_order_acquire);
+            if (epoch != kQuiescent && epoch < oldest) {
+                oldest = epoch;
+            }
+        }
+        return oldest;
+    }
+
+  private:
+    struct ThreadSlotOwner {
+        Slot *slot = nullptr;
+        ~ThreadSlotOwner() {
+            if (slot) {
+                slot->in_use.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    Slot *ThreadSlot() {
+        thread_local ThreadSlotOwner owner;
+        if (!owner.slot) {
+            owner.slot = AcquireSlot();
+        }
+        return owner.slot;
+    }
+
+    Slot *AcquireSlot() {
+        for (Slot *slot = slots_.load(std::memory_order_acquire); slot; slot = slot->next) {
+            bool expected = false;
+            if (!slot->in_use.load(std::memory_order_relaxed) &&
+                slot->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return slot;
+            }
+        }
+        Slot *slot = new Slot;
+        slot->next = slots_.load(std::memory_order_relaxed);
+        while (!slots_.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        return slot;
+    }
+
+    std::atomic<uint64_t> global_epoch_{1};
+    std::atomic<Slot *> slots_{nullptr};
+};
+
+// Read-mostly alternative to vl_concurrent_unordered_map with the same interface.
+//
+// Lookups (find, contains, snapshot) take no lock: each bucket is an open addressed table of atomic pointers
+// to immutable nodes, read under a vl_epoch_domain::EpochGuard. find and snapshot return copies of the values,
+// so for shared_ptr values they still write the reference count of the object found; only the map itself is
+// read without shared writes.
+// Writers are serialized per bucket by a mutex; an update replaces the node (or the whole table on growth)
+// and retires the old one. Every write frees the retired nodes and tables of its bucket that no reader can still
+// observe, after the mutex is released, so an erased value is normally released by the erase itself. Only a reader
+// inside a read section at that moment defers it, to the next write to the bucket.
+//
+// Writes are more expensive than in vl_concurrent_unordered_map (a node allocation per insert and deferred
+// frees), so this is intended for maps that are looked up on nearly every API call but modified rarely,
+// e.g. command buffers, pipelines and layouts.
+template <typename Key, typename T, int BUCKETSLOG2 = 2, typename Hash = layer_data::hash<Key>>
+class vl_concurrent_read_mostly_map {
+  public:
+    vl_concurrent_read_mostly_map() = default;
+    vl_concurrent_read_mostly_map(const vl_concurrent_read_mostly_map &) = delete;
+    vl_concurrent_read_mostly_map &operator=(const vl_concurrent_read_mostly_map &) = delete;
+
+    ~vl_concurrent_read_mostly_map() {
+        for (auto &bucket : buckets) {
+            Table *table = bucket.table.load(std::memory_order_relaxed);
+            if (table) {
+                table->DeleteNodes();
+                delete table;
+            }
+            Garbage garbage;
+            bucket.Reclaim(std::numeric_limits<uint64_t>::max(), garbage);
+        }
+    }
+
+    template <typename... Args>
+    void insert_or_assign(const Key &key, Args &&...args) {
+        auto &bucket = buckets[ConcurrentMapHashObject(key)];
+        Garbage garbage;
+        std::lock_guard<std::mutex> lock(bucket.write_lock);
+        bucket.Store(key, new Node{key, T{std::forward<Args>(args)...}}, true);
+        bucket.MaybeReclaim(garbage);
+    }
+
+    template <typename... Args>
+    bool insert(const Key &key, Args &&...args) {
+        auto &bucket = buckets[ConcurrentMapHashObject(key)];
+        Garbage garbage;
+        std::lock_guard<std::mutex> lock(bucket.write_lock);
+        if (bucket.FindSlot(key)) {
+            return false;
+        }
+        bucket.Store(key, new Node{key, T(std::forward<Args>(args)...)}, false);
+        bucket.MaybeReclaim(garbage);
+        return true;
+    }
+
+    // returns size_type
+    size_t erase(const Key &key) {
+        auto &bucket = buckets[ConcurrentMapHashObject(key)];
+        Garbage garbage;
+        std::lock_guard<std::mutex> lock(bucket.write_lock);
+        if (!bucket.Remove(key)) {
+            return 0;
+        }
+        bucket.MaybeReclaim(garbage);
+        return 1;
+    }
+
+    bool contains(const Key &key) const {
+        vl_epoch_domain::EpochGuard guard;
+        return buckets[ConcurrentMapHashObject(key)].FindNode(key) != nullptr;
+    }
+
+    // type returned by find() and end().
+    class FindResult {
+      public:
+        FindResult(bool a, T b) : result(a, std::move(b)) {}
+
+        // == and != only support comparing against end()
+        bool operator==(const FindResult &other) const { return result.first == false && other.result.first == false; }
+        bool operator!=(const FindResult &other) const { return !(*this == other); }
+
+        // Make -> act kind of like an iterator.
+        std::pair<bool, T> *operator->() { return &result; }
+        const std::pair<bool, T> *operator->() const { return &result; }
+
+      private:
+        // (found, copy of element)
+        std::pair<bool, T> result;
+    };
+
+    FindResult end() const { return FindResult(false, T()); }
+    FindResult cend() const { return end(); }
+
+    FindResult find(const Key &key) const {
+        vl_epoch_domain::EpochGuard guard;
+        const Node *node = buckets[ConcurrentMapHashObject(key)].FindNode(key);
+        if (node) {
+            return FindResult(true, node->value);
+        }
+        return end();
+    }
+
+    FindResult pop(const Key &key) {
+        auto &bucket = buckets[ConcurrentMapHashObject(key)];
+        Garbage garbage;
+        std::lock_guard<std::mutex> lock(bucket.write_lock);
+        const Node *node = bucket.Remove(key);
+        if (node) {
+            // Copy the value out before the retired node becomes eligible for reclamation.
+            FindResult ret(true, node->value);
+            bucket.MaybeReclaim(garbage);
+            return ret;
+        }
+        return end();
+    }
+
+    std::vector<std::pair<const Key, T>> snapshot(std::function<bool(T)> f = nullptr) const {
+        std::vector<std::pair<const Key, T>> ret;
+        vl_epoch_domain::EpochGuard guard;
+        for (const auto &bucket : buckets) {
+            const Table *table = bucket.table.load(std::memory_order_acquire);
+            if (!table) continue;
+            for (size_t i = 0; i <= table->mask; ++i) {
+                const Node *node = table->slots[i].load(std::memory_order_acquire);
+                if (IsLive(node) && (!f || f(node->value))) {
+                    ret.emplace_back(node->key, node->value);
+                }
+            }
+        }
+        return ret;
+    }
+
+    void clear() {
+        for (auto &bucket : buckets) {
+            Garbage garbage;
+            std::lock_guard<std::mutex> lock(bucket.write_lock);
+            Table *table = bucket.table.exchange(nullptr, std::memory_order_acq_rel);
+            if (table) {
+                const uint64_t epoch = vl_epoch_domain::Get().Advance();
+                for (size_t i = 0; i <= table->mask; ++i) {
+                    Node *node = table->slots[i].load(std::memory_order_relaxed);
+                    if (IsLive(node)) {
+                        bucket.retired_nodes.emplace_back(epoch, node);
+                    }
+                }
+                bucket.retired_tables.emplace_back(epoch, table);
+            }
+            bucket.count.store(0, std::memory_order_relaxed);
+            bucket.used = 0;
+            bucket.MaybeReclaim(garbage);
+        }
+    }
+
+    size_t size() const {
+        size_t result = 0;
+        for (const auto &bucket : buckets) {
+            result += bucket.count.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    // Interface parity with vl_concurrent_unordered_map. Lookups take no lock, so there is no contention to report.
+    void ReportContention(const char *, std::ostream &) const {}
+
+  private:
+    static const int BUCKETS = (1 << BUCKETSLOG2);
+    static constexpr size_t kMinTableSize = 16;
+
+    struct Node {
+        const Key key;
+        const T value;
+    };
+
+    // Erased slots keep a tombstone so that probe sequences through them stay intact. Only ever compared.
+    static Node *Tombstone() {
+        static char tombstone;
+        return reinterpret_cast<Node *>(&tombstone);
+    }
+    static bool IsLive(const Node *node) { return node != nullptr && node != Tombstone(); }
+
+    struct Table {
+        explicit Table(size_t size) : mask(size - 1), slots(new std::atomic<Node *>[size]) {
+            for (size_t i = 0; i < size; ++i) {
+                slots[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+        void DeleteNodes() {
+            for (size_t i = 0; i <= mask; ++i) {
+                Node *node = slots[i].load(std::memory_order_relaxed);
+                if (IsLive(node)) delete node;
+            }
+        }
+        const size_t mask;
+        std::unique_ptr<std::atomic<Node *>[]> slots;
+    };
+
+    // Reclaimed nodes and tables. Declared before the lock guard of a write, so that they are freed after the lock is
+    // released: destroying the values can release the last reference to state objects with expensive destructors.
+    struct Garbage {
+        std::vector<Node *> nodes;
+        std::vector<Table *> tables;
+        Garbage() = default;
+        Garbage(const Garbage &) = delete;
+        Garbage &operator=(const Garbage &) = delete;
+        ~Garbage() {
+            for (Node *node : nodes) delete node;
+            for (Table *table : tables) delete table;
+        }
+    };
+
+    static size_t SlotHash(const Key &key) {
+        // Finalize the hash, layer_data::hash may be the identity for handles whose low bits are mostly zero.
+        uint64_t h = static_cast<uint64_t>(Hash{}(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<size_t>(h);
+    }
+
+    struct alignas(64) Bucket {
+        std::atomic<Table *> table{nullptr};
+        std::atomic<size_t> count{0};
+        // Writer-only state, protected by write_lock.
+        std::mutex write_lock;
+        size_t used = 0;  // live nodes + tombstones
+        std::vector<std::pair<uint64_t, Node *>> retired_nodes;
+        std::vector<std::pair<uint64_t, Table *>> retired_tables;
+
+        // Requires an EpochGuard. The returned node stays valid for the lifetime of the guard.
+        const Node *FindNode(const Key &key) const {
+            const Table *t = table.load(std::memory_order_acquire);
+            if (!t) return nullptr;
+            for (size_t i = SlotHash(key) & t->mask;; i = (i + 1) & t->mask) {
+                const Node *node = t->slots[i].load(std::memory_order_acquire);
+                if (node == nullptr) return nullptr;
+                if (node != Tombstone() && node->key == key) return node;
+            }
+        }
+
+        // Requires write_lock.
+        std::atomic<Node *> *FindSlot(const Key &key) {
+            Table *t = table.load(std::memory_order_relaxed);
+            if (!t) return nullptr;
+            for (size_t i = SlotHash(key) & t->mask;; i = (i + 1) & t->mask) {
+                const Node *node = t->slots[i].load(std::memory_order_relaxed);
+                if (node == nullptr) return nullptr;
+                if (node != Tombstone() && node->key == key) return &t->slots[i];
+            }
+        }
+
+        // Requires write_lock. Inserts node, or replaces the existing node for key if replace is set.
+        void Store(const Key &key, Node *node, bool replace) {
+            if (replace) {
+                auto *slot = FindSlot(key);
+                if (slot) {
+                    Node *old_node = slot->exchange(node, std::memory_order_acq_rel);
+                    retired_nodes.emplace_back(vl_epoch_domain::Get().Advance(), old_node);
+                    return;
+                }
+            }
+            Table *t = table.load(std::memory_order_relaxed);
+            if (!t || (used + 1) * 2 > t->mask + 1) {
+                t = Grow(t);
+            }
+            size_t i = SlotHash(key) & t->mask;
+            for (Node *current = t->slots[i].load(std::memory_order_relaxed); IsLive(current);
+                 current = t->slots[i].load(std::memory_order_relaxed)) {
+                i = (i + 1) & t->mask;
+            }
+            if (t->slots[i].load(std::memory_order_relaxed) == nullptr) {
+                ++used;
+            }
+            t->slots[i].store(node, std::memory_order_release);
+            count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Requires write_lock. Returns the retired node, which stays valid until the next MaybeReclaim().
+        const Node *Remove(const Key &key) {
+            auto *slot = FindSlot(key);
+            if (!slot) return nullptr;
+            Node *node = slot->exchange(Tombstone(), std::memory_order_acq_rel);
+            count.fetch_sub(1, std::memory_order_relaxed);
+            retired_nodes.emplace_back(vl_epoch_domain::Get().Advance(), node);
+            return node;
+        }
+
+        // Requires write_lock. Rehashes into a table sized for the live nodes, dropping tombstones.
+        Table *Grow(Table *old_table) {
+            const size_t live = count.load(std::memory_order_relaxed);
+            size_t size = kMinTableSize;
+            while (size < (live + 1) * 4) {
+                size *= 2;
+            }
+            auto *new_table = new Table(size);
+            if (old_table) {
+                for (size_t i = 0; i <= old_table->mask; ++i) {
+                    Node *node = old_table->slots[i].load(std::memory_order_relaxed);
+                    if (!IsLive(node)) continue;
+                    size_t j = SlotHash(node->key) & new_table->mask;
+                    while (new_table->slots[j].load(std::memory_order_relaxed) != nullptr) {
+                        j = (j + 1) & new_table->mask;
+                    }
+                    new_table->slots[j].store(node, std::memory_order_relaxed);
+                }
+            }
+            used = live;
+            table.store(new_table, std::memory_order_release);
+            if (old_table) {
+                retired_tables.emplace_back(vl_epoch_domain::Get().Advance(), old_table);
+            }
+            return new_table;
+        }
+
+        // Requires write_lock. Moves what no reader can observe anymore to garbage, to be freed once the lock is released.
+        // Retired nodes hold values, which can keep state objects alive, so this doesn't wait for retired memory to pile up:
+        // scanning the reader slots costs one load per thread.
+        void MaybeReclaim(Garbage &garbage) {
+            if (!retired_nodes.empty() || !retired_tables.empty()) {
+                Reclaim(vl_epoch_domain::Get().OldestActiveEpoch(), garbage);
+            }
+        }
+
+        void Reclaim(uint64_t oldest_active, Garbage &garbage) {
+            auto move_retired = [oldest_active](auto &retired, auto &out) {
+                auto keep = std::partition(retired.begin(), retired.end(),
+                                           [oldest_active](const auto &entry) { return entry.first >= oldest_active; });
+                for (auto it = keep; it != retired.end(); ++it) {
+                    out.push_back(it->second);
+                }
+                retired.erase(keep, retired.end());
+            };
+            move_retired(retired_nodes, garbage.nodes);
+            move_retired(retired_tables, garbage.tables);
+        }
+    };
+
+    Bucket buckets[BUCKETS];
 
     uint32_t ConcurrentMapHashObject(const Key &object) const {
         uint64_t u64 = (uint64_t)(uintptr_t)object;
@@ -0,0 +1,145 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "worker_pool.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+#include "vk_layer_config.h"
+
+// Maximum number of threads, so that a typo in the settings cannot spawn thousands of threads
+static constexpr uint32_t kMaxWorkerThreads = 64;
+
+static uint32_t ReadWorkerThreadCount() {
+    std::string threads = GetEnvironment("VK_LAYER_SUBMIT_VALIDATION_THREADS");
+    if (threads.empty()) {
+        threads = getLayerOption("khronos_validation.submit_validation_threads");
+    }
+    std::transform(threads.begin(), threads.end(), threads.begin(), ::tolower);
+    long count = 0;
+    if (threads == "auto") {
+        count = std::thread::hardware_concurrency();
+    } else if (!threads.empty()) {
+        count = std::strtol(threads.c_str(), nullptr, 10);
+    }
+    return static_cast<uint32_t>(std::min(std::max(count, 1l), static_cast<long>(kMaxWorkerThreads)));
+}
+
+uint32_t WorkerPool::ConfiguredThreadCount() {
+    static const uint32_t thread_count = ReadWorkerThreadCount();
+    return thread_count;
+}
+
+std::shared_ptr<WorkerPool> WorkerPool::Shared() {
+    // Intentionally leaked, so that devices destroyed during static destruction can still release the pool.
+    static auto *lock = new std::mutex;
+    static auto *shared = new std::weak_ptr<WorkerPool>;
+
+    const uint32_t thread_count = ConfiguredThreadCount();
+    if (thread_count <= 1) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> guard(*lock);
+    auto pool = shared->lock();
+    if (!pool) {
+        pool = std::make_shared<WorkerPool>(thread_count);
+        *shared = pool;
+    }
+    return pool;
+}
+
+WorkerPool::WorkerPool(uint32_t thread_count) {
+    // The calling thread of ParallelFor is one of the threads
+    for (uint32_t i = 1; i < thread_count; ++i) {
+        workers_.emplace_back(&WorkerPool::WorkerFunc, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        exit_ = true;
+    }
+    work_cond_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+// Set while a thread runs ParallelFor work, so that nested calls run serially instead of relocking job_lock_
+static thread_local bool in_parallel_for = false;
+
+void WorkerPool::Run(Job &job) {
+    in_parallel_for = true;
+    for (size_t i = job.next.fetch_add(1, std::memory_order_relaxed); i < job.count;
+         i = job.next.fetch_add(1, std::memory_order_relaxed)) {
+        (*job.func)(i);
+    }
+    in_parallel_for = false;
+}
+
+void WorkerPool::ParallelFor(size_t count, const std::function<void(size_t)> &func) {
+    std::unique_lock<std::mutex> job_guard(job_lock_, std::defer_lock);
+    if (count < 2 || workers_.empty() || in_parallel_for || !job_guard.try_lock()) {
+        for (size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    Job job;
+    job.func = &func;
+    job.count = count;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        job_ = &job;
+        ++job_id_;
+    }
+    work_cond_.notify_all();
+
+    Run(job);
+
+    // Once job_ is cleared no worker can pick up the job, and every index handed out has been claimed by either this
+    // thread or one of the active workers.
+    std::unique_lock<std::mutex> guard(lock_);
+    job_ = nullptr;
+    done_cond_.wait(guard, [this]() { return active_workers_ == 0; });
+}
+
+void WorkerPool::WorkerFunc() {
+    uint64_t last_job_id = 0;
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        work_cond_.wait(guard, [this, last_job_id]() { return exit_ || (job_ && job_id_ != last_job_id); });
+        if (exit_) {
+            return;
+        }
+        last_job_id = job_id_;
+        Job *job = job_;
+        ++active_workers_;
+        guard.unlock();
+
+        Run(*job);
+
+        guard.lock();
+        if (--active_workers_ == 0) {
+            done_cond_.notify_all();
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Layer owned pool of worker threads used to fan out validation that is read-only against the state tracker.
+//
+// The thread count comes from the submit_validation_threads setting (VK_LAYER_SUBMIT_VALIDATION_THREADS): 0 or 1
+// keeps all validation on the application threads, "auto" uses one thread per hardware thread. A single pool is
+// shared by all devices and validation objects, and its threads exit once the last reference is released.
+class WorkerPool {
+  public:
+    // Returns the shared pool, or nullptr when parallel validation is disabled.
+    static std::shared_ptr<WorkerPool> Shared();
+    // Number of threads requested by the layer settings, including the calling thread.
+    static uint32_t ConfiguredThreadCount();
+
+    explicit WorkerPool(uint32_t thread_count);
+    ~WorkerPool();
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    // Threads taking part in a ParallelFor, including the calling thread.
+    uint32_t ThreadCount() const { return static_cast<uint32_t>(workers_.size()) + 1; }
+
+    // Calls func(i) for each i in [0, count) and returns once all calls have completed. Indices are handed out
+    // dynamically, so func must not depend on which thread runs which index. The calling thread takes part in the
+    // work. If the pool is already running a job for another thread, the calling thread runs the whole range itself
+    // rather than waiting.
+    void ParallelFor(size_t count, const std::function<void(size_t)> &func);
+
+  private:
+    struct Job {
+        const std::function<void(size_t)> *func = nullptr;
+        size_t count = 0;
+        std::atomic<size_t> next{0};
+    };
+
+    void WorkerFunc();
+    static void Run(Job &job);
+
+    std::vector<std::thread> workers_;
+    // Serializes ParallelFor callers
+    std::mutex job_lock_;
+
+    // All members below are accessed with lock_ held
+    std::mutex lock_;
+    std::condition_variable work_cond_;
+    std::condition_variable done_cond_;
+    Job *job_ = nullptr;
+    uint64_t job_id_ = 0;
+    uint32_t active_workers_ = 0;
+    bool exit_ = false;
+};
@@ -59,6 +59,9 @@ from common_codegen import *
 #     parameter on a separate line
 #   alignFuncParam - if nonzero and parameters are being put on a
 #     separate line, align parameter names at the specified column
+#   static_dispatch - list of validation object short names (see
+#     static_dispatch_objects). If set, device-level intercepts call only
+#     these objects, directly and without virtual dispatch.
 class LayerChassisGeneratorOptions(GeneratorOptions):
     def __init__(self,
                  conventions = None,
@@ -86,7 +89,8 @@ class LayerChassisGeneratorOptions(GeneratorOptions):
                  indentFuncPointer = False,
                  alignFuncParam = 48,
                  helper_file_type = '',
-                 expandEnumerants = False):
+                 expandEnumerants = False,
+                 static_dispatch = None):
         GeneratorOptions.__init__(self,
                 conventions = conventions,
                 filename = filename,
@@ -113,6 +117,7 @@ class LayerChassisGeneratorOptions(GeneratorOptions):
         self.alignFuncParam    = alignFuncParam
         self.helper_file_type  = helper_file_type
         self.warnExtensions    = warnExtensions
+        self.static_dispatch   = static_dispatch
 
 # LayerChassisOutputGenerator - subclass of OutputGenerator.
 # Generates a LayerFactory layer that intercepts all API entrypoints
@@ -238,22 +243,9 @@ class LayerChassisOutputGenerator(OutputGenerator):
 #include "vk_typemap_helper.h"
 
 
-extern std::atomic<uint64_t> global_unique_id;
-
-// To avoid re-hashing unique ids on each use, we precompute the hash and store the
-// hash's LSBs in the high 24 bits.
-struct HashedUint64 {
-    static const int HASHED_UINT64_SHIFT = 40;
-    size_t operator()(const uint64_t &t) const { return t >> HASHED_UINT64_SHIFT; }
-
-    static uint64_t hash(uint64_t id) {
-        uint64_t h = (uint64_t)layer_data::hash<uint64_t>()(id);
-        id |= h << HASHED_UINT64_SHIFT;
-        return id;
-    }
-};
-
-extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+// Map of unique (wrapped) ids to actual object handles. The ids are allocated by the table itself, see
+// vl_concurrent_id_table.
+extern vl_concurrent_id_table unique_id_mapping;
 
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(
@@ -378,6 +370,8 @@ class ValidationObject {
 
         std::vector<ValidationObject*> object_dispatch;
         LayerObjectTypeId container_type;
+        // Device validation objects indexed by container type, used by a statically dispatched chassis
+        std::array<ValidationObject*, LayerObjectTypeMaxEnum> static_dispatch_objects{};
 
         vl_concurrent_unordered_map<VkDeferredOperationKHR, std::vector<std::function<void()>>, 0> deferred_operation_post_completion;
         vl_concurrent_unordered_map<VkDeferredOperationKHR, std::vector<std::function<void(const std::vector<VkPipeline>&)>>, 0> deferred_operation_post_check;
@@ -400,6 +394,17 @@ class ValidationObject {
             return WriteLockGuard(validation_object_mutex);
         }
 
+        // Locks taken by the chassis around each hook. An object whose ReadLock()/WriteLock() only return deferred guards
+        // (fine grained locking, or no shared state) has chassis_locking cleared at CreateDevice, which skips the virtual
+        // calls entirely.
+        bool chassis_locking{true};
+        ReadLockGuard ChassisReadLock() {
+            return chassis_locking ? ReadLock() : ReadLockGuard();
+        }
+        WriteLockGuard ChassisWriteLock() {
+            return chassis_locking ? WriteLock() : WriteLockGuard();
+        }
+
         void RegisterValidationObject(bool vo_enabled, uint32_t instance_api_version,
             debug_report_data* instance_report_data, std::vector<ValidationObject*> &dispatch_list) {
             if (vo_enabled) {
@@ -620,17 +625,13 @@ class ValidationObject {
         // Wrap a newly created handle with a new unique ID, and return the new ID.
         template <typename HandleType>
         HandleType WrapNew(HandleType newlyCreatedHandle) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.add(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             return (HandleType)unique_id;
         }
 
         // Specialized handling for VkDisplayKHR. Adds an entry to enable reverse-lookup.
         VkDisplayKHR WrapDisplay(VkDisplayKHR newlyCreatedHandle, ValidationObject *map_data) {
-            auto unique_id = global_unique_id++;
-            unique_id = HashedUint64::hash(unique_id);
-            unique_id_mapping.insert_or_assign(unique_id, reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+            auto unique_id = unique_id_mapping.add(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             map_data->display_id_reverse_mapping.insert_or_assign(newlyCreatedHandle, unique_id);
             return (VkDisplayKHR)unique_id;
         }
@@ -684,11 +685,9 @@ class ValidationObject {
 
 small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
 
-// Global unique object identifier.
-std::atomic<uint64_t> global_unique_id(1ULL);
 // Map uniqueID to actual object handle. Accesses to the map itself are
 // internally synchronized.
-vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+vl_concurrent_id_table unique_id_mapping;
 
 bool wrap_handles = true;
 
@@ -971,12 +970,12 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     // Init dispatch array and call registration functions
     bool skip = false;
     for (auto intercept : local_object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateInstance(pCreateInfo, pAllocator, pInstance);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : local_object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance);
     }
 
@@ -1009,7 +1008,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     sync_validation_obj->FinalizeInstanceValidationObject(framework, *pInstance);
 
     for (auto intercept : framework->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, result);
     }
 
@@ -1036,18 +1035,18 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     ActivateInstanceDebugCallbacks(layer_data->report_data);
 
     """ + precallvalidate_loop + """
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyInstance(instance, pAllocator);
     }
     """ + precallrecord_loop + """
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyInstance(instance, pAllocator);
     }
 
     layer_data->instance_dispatch_table.DestroyInstance(instance, pAllocator);
 
     """ + postcallrecord_loop + """
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyInstance(instance, pAllocator);
     }
 
@@ -1093,12 +1092,12 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 
     bool skip = false;
     for (auto intercept : instance_interceptor->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : instance_interceptor->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, &modified_create_info);
     }
 
@@ -1126,6 +1125,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     // Note that this DEFINES THE ORDER IN WHICH THE LAYER VALIDATION OBJECTS ARE CALLED
     auto disables = instance_interceptor->disabled;
     auto enables = instance_interceptor->enabled;
+#ifdef VVL_STATIC_DISPATCH
+    FilterStaticDispatchObjects(device_interceptor, disables, enables);
+#endif
 
     auto thread_safety_obj = new ThreadSafety(reinterpret_cast<ThreadSafety *>(instance_interceptor->GetValidationObject(instance_interceptor->object_dispatch, LayerObjectTypeThreading)));
     thread_safety_obj->InitDeviceValidationObject(!disables[thread_safety], instance_interceptor, device_interceptor);
@@ -1165,11 +1167,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     }
 
     for (auto intercept : instance_interceptor->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
     }
 
     device_interceptor->InitObjectDispatchVectors();
+    for (auto item : device_interceptor->object_dispatch) {
+        device_interceptor->static_dispatch_objects[item->container_type] = item;
+    }
 
     DeviceExtensionWhitelist(device_interceptor, pCreateInfo, *pDevice);
     DeviceExtensionWarnlist(device_interceptor, pCreateInfo, *pDevice);
@@ -1185,18 +1190,18 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     dispatch_key key = get_dispatch_key(device);
     auto layer_data = GetLayerDataPtr(key, layer_data_map);
     """ + precallvalidate_loop + """
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         (const_cast<const ValidationObject*>(intercept))->PreCallValidateDestroyDevice(device, pAllocator);
     }
     """ + precallrecord_loop + """
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordDestroyDevice(device, pAllocator);
     }
 
     layer_data->device_dispatch_table.DestroyDevice(device, pAllocator);
 
     """ + postcallrecord_loop + """
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
 
@@ -1223,12 +1228,12 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(cgpl_state[intercept->container_type]));
     }
 
@@ -1238,7 +1243,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     VkResult result = DispatchCreateGraphicsPipelines(device, pipelineCache, createInfoCount, usepCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(cgpl_state[intercept->container_type]));
     }
     return result;
@@ -1259,12 +1264,12 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
 
     for (auto intercept : layer_data->object_dispatch) {
         ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &(ccpl_state[intercept->container_type]));
     }
 
@@ -1274,7 +1279,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     VkResult result = DispatchCreateComputePipelines(device, pipelineCache, createInfoCount, usepCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &(ccpl_state[intercept->container_type]));
     }
     return result;
@@ -1294,13 +1299,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
 
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
     }
@@ -1308,7 +1313,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     VkResult result = DispatchCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
     }
@@ -1330,13 +1335,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
 
     for (auto intercept : layer_data->object_dispatch) {
         crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &(crtpl_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                             pPipelines, &(crtpl_state[intercept->container_type]));
     }
@@ -1344,7 +1349,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
     VkResult result = DispatchCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                              pPipelines, result, &(crtpl_state[intercept->container_type]));
     }
@@ -1364,17 +1369,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
     cpl_state.modified_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, &cpl_state);
     }
     VkResult result = DispatchCreatePipelineLayout(device, &cpl_state.modified_create_info, pAllocator, pPipelineLayout);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     }
     return result;
@@ -1393,17 +1398,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
     csm_state.instrumented_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
     }
     VkResult result = DispatchCreateShaderModule(device, &csm_state.instrumented_create_info, pAllocator, pShaderModule);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, &csm_state);
     }
     return result;
@@ -1420,18 +1425,18 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
 
     for (auto intercept : layer_data->object_dispatch) {
         ads_state[intercept->container_type].Init(pAllocateInfo->descriptorSetCount);
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateAllocateDescriptorSets(device,
             pAllocateInfo, pDescriptorSets, &(ads_state[intercept->container_type]));
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
     VkResult result = DispatchAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets,
             result, &(ads_state[intercept->container_type]));
     }
@@ -1451,17 +1456,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
     cb_state.modified_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, &cb_state);
     }
     VkResult result = DispatchCreateBuffer(device, &cb_state.modified_create_info, pAllocator, pBuffer);
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, result);
     }
     return result;
@@ -1497,13 +1502,13 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
     }
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->ReadLock();
+        auto lock = intercept->ChassisReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PreCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties);
     }
 
@@ -1515,7 +1520,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(
     (*pToolCount)++;
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->WriteLock();
+        auto lock = intercept->ChassisWriteLock();
         intercept->PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, result);
     }
     return result;
@@ -1738,6 +1743,48 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
     return VK_SUCCESS;
 }"""
 
+    init_chassis_locking = """
+    // Whether an object takes validation_object_mutex is fixed once fine_grained_locking is known, so probe it once here
+    // rather than making two virtual calls around every hook.
+    for (auto item : object_dispatch) {
+        item->chassis_locking = item->ReadLock().owns_lock();
+    }
+
+    // Optionally report how many hook calls and lock acquisitions per API call the chassis no longer makes, compared to
+    // calling every validation object for every hook.
+    const uint32_t api_calls = InterceptIdCount / 3;
+    if (api_calls > 0 && GetBoolSetting("VK_LAYER_CHASSIS_LOCKING_REPORT", "khronos_validation.chassis_locking_report")) {
+        uint32_t hook_calls = 0;
+        uint32_t locks_taken = 0;
+        for (const auto &intercept_vector : intercept_vectors) {
+            hook_calls += static_cast<uint32_t>(intercept_vector.size());
+            for (auto item : intercept_vector) {
+                if (item->chassis_locking) locks_taken++;
+            }
+        }
+        const uint32_t unfiltered_calls = static_cast<uint32_t>(object_dispatch.size()) * InterceptIdCount;
+        LogInfo(device, "UNASSIGNED-chassis-lock-elision",
+                "%zu validation objects, %u device API calls: per API call %.2f of %zu lock acquisitions eliminated "
+                "(%.2f hooks not overridden, %.2f hooks without chassis locking).",
+                object_dispatch.size(), api_calls, static_cast<double>(unfiltered_calls - locks_taken) / api_calls,
+                object_dispatch.size() * 3, static_cast<double>(unfiltered_calls - hook_calls) / api_calls,
+                static_cast<double>(hook_calls - locks_taken) / api_calls);
+    }
+"""
+
+    # Validation objects a statically dispatched chassis can be generated for, in chassis call order:
+    #   short name: (class, container type, CreateDevice flag array, flag)
+    static_dispatch_objects = {
+        'thread_safety':  ('ThreadSafety',        'LayerObjectTypeThreading',           'disables', 'thread_safety'),
+        'stateless':      ('StatelessValidation', 'LayerObjectTypeParameterValidation', 'disables', 'stateless_checks'),
+        'object_tracker': ('ObjectLifetimes',     'LayerObjectTypeObjectTracker',       'disables', 'object_tracking'),
+        'core':           ('CoreChecks',          'LayerObjectTypeCoreValidation',      'disables', 'core_checks'),
+        'best_practices': ('BestPractices',       'LayerObjectTypeBestPractices',       'enables',  'best_practices'),
+        'gpu_assisted':   ('GpuAssisted',         'LayerObjectTypeGpuAssisted',         'enables',  'gpu_validation'),
+        'debug_printf':   ('DebugPrintf',         'LayerObjectTypeDebugPrintf',         'enables',  'debug_printf'),
+        'sync':           ('SyncValidator',       'LayerObjectTypeSyncValidation',      'enables',  'sync_validation'),
+    }
+
     init_object_dispatch_vector = """
 #define BUILD_DISPATCH_VECTOR(name) \\
     init_object_dispatch_vector(InterceptId ## name, \\
@@ -1845,6 +1892,14 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         else:
             self.chassis_source = True
             write(self.inline_custom_source_preamble_1, file=self.outFile)
+            self.static_objects = []
+            if self.genOpts.static_dispatch:
+                unknown = [name for name in self.genOpts.static_dispatch if name not in self.static_dispatch_objects]
+                if unknown:
+                    self.logMsg('error', 'Unknown static dispatch validation objects: %s' % ', '.join(unknown))
+                    sys.exit(1)
+                self.static_objects = [info for name, info in self.static_dispatch_objects.items() if name in self.genOpts.static_dispatch]
+                write(self.StaticDispatchPreamble(), file=self.outFile)
             write(self.inline_custom_source_preamble_2, file=self.outFile)
             write("static const std::set<std::string> kDeviceWarnExtensionNames {", file=self.outFile)
             for ext in genOpts.warnExtensions:
@@ -1894,6 +1949,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             helper_content += '\n\n'
             helper_content += '    intercept_vectors.resize(InterceptIdCount);\n\n'
             helper_content += self.dispatch_vector_fcns;
+            helper_content += self.init_chassis_locking
             helper_content += '};\n'
             write(helper_content, file=self.outFile)
 
@@ -1961,6 +2017,62 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
     def genEnum(self, enuminfo, name, alias):
         pass
     #
+    # Support code for a chassis generated with a fixed set of validation objects
+    def StaticDispatchPreamble(self):
+        filters = ''
+        for name, (class_name, object_type, flags, flag) in self.static_dispatch_objects.items():
+            if (class_name, object_type, flags, flag) in self.static_objects:
+                continue
+            enabled = '!disables[%s]' % flag if flags == 'disables' else 'enables[%s]' % flag
+            disable = 'disables[%s] = true;' % flag if flags == 'disables' else 'enables[%s] = false;' % flag
+            filters += '    if (%s) {\n' % enabled
+            filters += '        device_interceptor->LogWarning(device_interceptor->device, "UNASSIGNED-chassis-static-dispatch",\n'
+            filters += '                                       "%s is not part of this statically dispatched chassis and is disabled.");\n' % class_name
+            filters += '        %s\n' % disable
+            filters += '    }\n'
+        return """
+// This chassis was generated with -staticDispatch for a fixed set of validation objects. Device-level intercepts call the
+// hooks of those objects directly and without virtual dispatch, and hooks which a type leaves at the ValidationObject
+// default are removed at compile time instead of being filtered into intercept_vectors at CreateDevice.
+#define VVL_STATIC_DISPATCH 1
+
+#ifdef INSTRUMENT_OPTICK
+#error "A statically dispatched chassis calls CoreChecks directly and cannot be combined with INSTRUMENT_OPTICK"
+#endif
+
+// Same test as BUILD_DISPATCH_VECTOR: a hook is overridden if its member pointer no longer names ValidationObject
+#define STATIC_DISPATCH_OVERRIDES(type, hook) (!std::is_same<decltype(&type::hook), decltype(&ValidationObject::hook)>::value)
+
+template <typename T>
+static inline T *GetStaticDispatchObject(const ValidationObject *layer_data, LayerObjectTypeId object_type) {
+    return static_cast<T *>(layer_data->static_dispatch_objects[object_type]);
+}
+
+// Validation objects outside of the static set would never be called from the generated intercepts, so keep them from
+// being created at all.
+static void FilterStaticDispatchObjects(ValidationObject *device_interceptor, CHECK_DISABLED &disables, CHECK_ENABLED &enables) {
+%s}""" % filters
+    #
+    # Specialized intercept body for a statically dispatched chassis
+    def StaticDispatchBody(self, fcn_name, paramstext, returnparam, early_return):
+        hooks = { 'PreCallValidate': [], 'PreCallRecord': [], 'PostCallRecord': [] }
+        for class_name, object_type, flags, flag in self.static_objects:
+            for prefix, lines in hooks.items():
+                hook = prefix + fcn_name
+                lines.append('    if constexpr (STATIC_DISPATCH_OVERRIDES(%s, %s)) {' % (class_name, hook))
+                lines.append('        if (auto object = GetStaticDispatchObject<%s>(layer_data, %s)) {' % (class_name, object_type))
+                if prefix == 'PreCallValidate':
+                    lines.append('            auto lock = object->%s::ReadLock();' % class_name)
+                    lines.append('            skip |= static_cast<const %s *>(object)->%s::%s(%s);' % (class_name, class_name, hook, paramstext))
+                    lines.append('            if (skip) %s' % early_return)
+                else:
+                    lines.append('            auto lock = object->%s::WriteLock();' % class_name)
+                    args = paramstext + (returnparam if prefix == 'PostCallRecord' else '')
+                    lines.append('            object->%s::%s(%s);' % (class_name, hook, args))
+                lines.append('        }')
+                lines.append('    }')
+        return hooks
+    #
     # Customize Cdecl for layer factory base class
     def BaseClassCdecl(self, elem, name):
         raw = self.makeCDecls(elem)[1]
@@ -2072,6 +2184,26 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             if (resulttype.text != 'void'):
                 assignresult = resulttype.text + ' result = '
 
+            returnparam = ''
+            if (resulttype.text == 'VkResult' or resulttype.text == 'VkDeviceAddress'):
+                returnparam = ', result'
+
+            if self.static_objects and dispatchable_type != 'VkInstance' and dispatchable_type != 'VkPhysicalDevice':
+                hooks = self.StaticDispatchBody(api_function_name[2:], paramstext, returnparam, return_map[resulttype.text])
+                self.appendSection('command', '    [[maybe_unused]] bool skip = false;')
+                self.appendSection('command', '\n'.join(hooks['PreCallValidate']))
+                self.appendSection('command', '\n'.join(hooks['PreCallRecord']))
+                if name in self.pre_dispatch_debug_utils_functions:
+                    self.appendSection('command', '    %s' % self.pre_dispatch_debug_utils_functions[name])
+                self.appendSection('command', '    ' + assignresult + API + paramstext + ');')
+                if name in self.post_dispatch_debug_utils_functions:
+                    self.appendSection('command', '    %s' % self.post_dispatch_debug_utils_functions[name])
+                self.appendSection('command', '\n'.join(hooks['PostCallRecord']))
+                if (resulttype.text != 'void'):
+                    self.appendSection('command', '    return result;')
+                self.appendSection('command', '}')
+                return
+
             # Set up skip and locking
             self.appendSection('command', '    bool skip = false;')
 
@@ -2080,7 +2212,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
                 self.appendSection('command', '    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidate%s]) {' % api_function_name[2:])
             else:
                 self.appendSection('command', '    for (auto intercept : layer_data->object_dispatch) {')
-            self.appendSection('command', '        auto lock = intercept->ReadLock();')
+            self.appendSection('command', '        auto lock = intercept->ChassisReadLock();')
             self.appendSection('command', '        skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
             self.appendSection('command', '        if (skip) %s' % return_map[resulttype.text])
             self.appendSection('command', '    }')
@@ -2090,7 +2222,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
                 self.appendSection('command', '    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecord%s]) {' % api_function_name[2:])
             else:
                 self.appendSection('command', '    for (auto intercept : layer_data->object_dispatch) {')
-            self.appendSection('command', '        auto lock = intercept->WriteLock();')
+            self.appendSection('command', '        auto lock = intercept->ChassisWriteLock();')
             self.appendSection('command', '        intercept->PreCallRecord%s(%s);' % (api_function_name[2:], paramstext))
             self.appendSection('command', '    }')
 
@@ -2110,10 +2242,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
                 self.appendSection('command', '    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecord%s]) {' % api_function_name[2:])
             else:
                 self.appendSection('command', '    for (auto intercept : layer_data->object_dispatch) {')
-            returnparam = ''
-            if (resulttype.text == 'VkResult' or resulttype.text == 'VkDeviceAddress'):
-                returnparam = ', result'
-            self.appendSection('command', '        auto lock = intercept->WriteLock();')
+            self.appendSection('command', '        auto lock = intercept->ChassisWriteLock();')
             self.appendSection('command', '        intercept->PostCallRecord%s(%s%s);' % (api_function_name[2:], paramstext, returnparam))
             self.appendSection('command', '    }')
             # Return result variable, if any.
@@ -65,6 +65,9 @@ def makeGenOpts(args):
     # Features to include (list of features)
     features = args.feature
 
+    # Validation objects the chassis is statically dispatched to (list of short names), or None
+    staticDispatch = args.staticDispatch
+
     # Spirv elements to emit (list of extensions and capabilities)
     emitSpirv = args.emitSpirv
 
@@ -411,7 +414,8 @@ def makeGenOpts(args):
             removeExtensions  = removeExtensionsPat,
             emitExtensions    = emitExtensionsPat,
             warnExtensions    = warnExtensions,
-            helper_file_type  = 'layer_chassis_source')
+            helper_file_type  = 'layer_chassis_source',
+            static_dispatch   = staticDispatch)
         ]
 
     # Layer chassis related generation structs
@@ -720,6 +724,8 @@ if __name__ == '__main__':
     # This argument tells us where to load the script from the Vulkan-Headers registry
     parser.add_argument('-scripts', action='store',
                         help='Find additional scripts in this directory')
+    parser.add_argument('-staticDispatch', action='append', default=[],
+                        help='Generate a chassis that calls only the specified validation objects directly, e.g. "core sync"')
 
     args = parser.parse_args()
 
@@ -758,6 +764,7 @@ if __name__ == '__main__':
     # This splits arguments which are space-separated lists
     args.feature = [name for arg in args.feature for name in arg.split()]
     args.extension = [name for arg in args.extension for name in arg.split()]
+    args.staticDispatch = [name for arg in args.staticDispatch for name in arg.replace(',', ' ').split()]
 
     # create error/warning & diagnostic files
     if (args.errfile):
@@ -682,9 +682,11 @@ def StageAccessEnums(stage_accesses, config):
         output.append('')
 
     # The stage/access combinations as bit mask
+    if len(stage_accesses) > config['sync_mask_bits']:
+        raise Exception('{} stage/access combinations do not fit in {}'.format(len(stage_accesses), sync_mask_name))
     output.append('// Unique bit for each  stage/access combination')
     if not config['is_source']:
-        output.extend([ '{}static const {} {} = ({}(1) << {});'.format('', sync_mask_name, e['stage_access_bit'], sync_mask_name, e['stage_access'])  for e in stage_accesses if e['stage_access_bit'] is not None])
+        output.extend([ '{}static constexpr {} {} = ({}(1) << {});'.format('', sync_mask_name, e['stage_access_bit'], sync_mask_name, e['stage_access'])  for e in stage_accesses if e['stage_access_bit'] is not None])
     output.append('')
 
     map_name = var_prefix + 'StageAccessIndexByStageAccessBit'
@@ -832,7 +834,7 @@ def StageAccessCrossReference(enum_in_bit_order, stage_access_combinations, conf
 def GenerateStaticMask(name, desc, bits, config):
     sep = ' |\n' + config['indent']
     if not config['is_source']:
-        variable_format = 'static const {sync_mask_name} {var_prefix}StageAccess{}Mask = ( //  {}'
+        variable_format = 'static constexpr {sync_mask_name} {var_prefix}StageAccess{}Mask = ( //  {}'
         output = [variable_format.format(name, desc, **config)]
         output.append(config['indent'] + sep.join([b for b in bits if b is not None]))
         output.extend([');', ''])
@@ -930,6 +932,131 @@ def ShaderStageAndSyncStageAccessMap(config):
         output.append('};\n')
     return output
 
+# Set type for the stage/access bits. Two words rather than a std::bitset<128> so that every mask in the generated header is a
+# compile time constant, and the set operations used by hazard detection and barrier application are plain word operations.
+sync_mask_type_template = """// Set of stage/access bits, indexed by {ordinal_name}
+class {sync_mask_name} {{
+  public:
+    static constexpr size_t kBitCount = {sync_mask_bits};
+
+    constexpr {sync_mask_name}() : words_{{0, 0}} {{}}
+    // Like std::bitset, sets the low bits from value
+    constexpr {sync_mask_name}(uint64_t value) : words_{{value, 0}} {{}}
+
+    constexpr size_t size() const {{ return kBitCount; }}
+    constexpr bool test(size_t pos) const {{ return ((words_[pos / 64] >> (pos % 64)) & 1) != 0; }}
+    constexpr bool any() const {{ return (words_[0] | words_[1]) != 0; }}
+    constexpr bool none() const {{ return !any(); }}
+    // Same as (*this & other).any(), without building the intersection
+    constexpr bool Intersects(const {sync_mask_name} &other) const {{
+        return ((words_[0] & other.words_[0]) | (words_[1] & other.words_[1])) != 0;
+    }}
+    size_t count() const {{ return PopCount(words_[0]) + PopCount(words_[1]); }}
+    // Index of the lowest bit set, or size() if none are
+    size_t FirstIndex() const {{
+        if (words_[0]) return LowestBit(words_[0]);
+        if (words_[1]) return 64 + LowestBit(words_[1]);
+        return kBitCount;
+    }}
+    constexpr uint64_t Word(size_t index) const {{ return words_[index]; }}
+
+    {sync_mask_name} &set(size_t pos) {{
+        words_[pos / 64] |= uint64_t(1) << (pos % 64);
+        return *this;
+    }}
+    {sync_mask_name} &reset(size_t pos) {{
+        words_[pos / 64] &= ~(uint64_t(1) << (pos % 64));
+        return *this;
+    }}
+    {sync_mask_name} &reset() {{
+        words_[0] = 0;
+        words_[1] = 0;
+        return *this;
+    }}
+
+    constexpr {sync_mask_name} operator~() const {{ return {sync_mask_name}(~words_[0], ~words_[1]); }}
+    constexpr {sync_mask_name} operator&(const {sync_mask_name} &rhs) const {{
+        return {sync_mask_name}(words_[0] & rhs.words_[0], words_[1] & rhs.words_[1]);
+    }}
+    constexpr {sync_mask_name} operator|(const {sync_mask_name} &rhs) const {{
+        return {sync_mask_name}(words_[0] | rhs.words_[0], words_[1] | rhs.words_[1]);
+    }}
+    constexpr {sync_mask_name} operator^(const {sync_mask_name} &rhs) const {{
+        return {sync_mask_name}(words_[0] ^ rhs.words_[0], words_[1] ^ rhs.words_[1]);
+    }}
+    constexpr {sync_mask_name} operator<<(size_t shift) const {{
+        if (shift == 0) return *this;
+        if (shift >= 128) return {sync_mask_name}();
+        if (shift >= 64) return {sync_mask_name}(0, words_[0] << (shift - 64));
+        return {sync_mask_name}(words_[0] << shift, (words_[1] << shift) | (words_[0] >> (64 - shift)));
+    }}
+    {sync_mask_name} &operator&=(const {sync_mask_name} &rhs) {{
+        words_[0] &= rhs.words_[0];
+        words_[1] &= rhs.words_[1];
+        return *this;
+    }}
+    {sync_mask_name} &operator|=(const {sync_mask_name} &rhs) {{
+        words_[0] |= rhs.words_[0];
+        words_[1] |= rhs.words_[1];
+        return *this;
+    }}
+    {sync_mask_name} &operator^=(const {sync_mask_name} &rhs) {{
+        words_[0] ^= rhs.words_[0];
+        words_[1] ^= rhs.words_[1];
+        return *this;
+    }}
+    constexpr bool operator==(const {sync_mask_name} &rhs) const {{
+        return words_[0] == rhs.words_[0] && words_[1] == rhs.words_[1];
+    }}
+    constexpr bool operator!=(const {sync_mask_name} &rhs) const {{ return !(*this == rhs); }}
+
+  private:
+    constexpr {sync_mask_name}(uint64_t low, uint64_t high) : words_{{low, high}} {{}}
+
+    static size_t PopCount(uint64_t word) {{
+#if defined(__GNUC__)
+        return static_cast<size_t>(__builtin_popcountll(word));
+#else
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+    }}
+    // word must be non-zero
+    static size_t LowestBit(uint64_t word) {{
+#if defined(__GNUC__)
+        return static_cast<size_t>(__builtin_ctzll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return index;
+#else
+        size_t index = 0;
+        while (!(word & 1)) {{
+            word >>= 1;
+            ++index;
+        }}
+        return index;
+#endif
+    }}
+
+    uint64_t words_[2];
+}};
+
+namespace std {{
+template <>
+struct hash<{sync_mask_name}> {{
+    size_t operator()(const {sync_mask_name} &flags) const {{
+        return hash<uint64_t>()(flags.Word(0) ^ (flags.Word(1) * 0x9e3779b97f4a7c15ULL));
+    }}
+}};
+}}  // namespace std
+"""
+
+def SyncMaskType(config):
+    return sync_mask_type_template.format(**config).split('\n')
+
 def GenSyncTypeHelper(gen, is_source) :
     lines = []
 
@@ -938,7 +1065,7 @@ def GenSyncTypeHelper(gen, is_source) :
         'type_prefix': 'Sync',
         'enum_prefix': 'SYNC_',
         'indent': '    ',
-        'sync_mask_base_type': 'std::bitset<128>',
+        'sync_mask_bits': 128,
         'vk_stage_flags': 'VkPipelineStageFlags2',
         'vk_stage_bits': 'VkPipelineStageFlags2',
         'vk_access_flags': 'VkAccessFlags2',
@@ -953,9 +1080,10 @@ def GenSyncTypeHelper(gen, is_source) :
     if config['is_source']:
         lines.extend(('#include "synchronization_validation_types.h"', ''))
     else:
-        lines.extend(('#pragma once', '', '#include <array>', '#include <bitset>', '#include <map>', '#include <stdint.h>', '#include <vulkan/vulkan.h>',
+        lines.extend(('#pragma once', '', '#include <array>', '#include <cstddef>', '#include <functional>', '#include <map>', '#include <stdint.h>', '#include <vulkan/vulkan.h>',
                  '#include "vk_layer_data.h"'))
-        lines.extend(('using {} = {};'.format(config['sync_mask_name'], config['sync_mask_base_type']), ''))
+        lines.extend(('#if defined(_MSC_VER)', '#include <intrin.h>', '#endif', ''))
+        lines.extend(SyncMaskType(config))
     lines.extend(['// clang-format off', ''])
 
     if not config['is_source']:
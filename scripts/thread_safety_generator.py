@@ -281,17 +281,28 @@ public:
         }
     }
 
+    // Lookup for callers that report an unknown object themselves
+    std::shared_ptr<ObjectUseData> FindObjectWithoutReporting(T object) {
+        auto iter = object_table.find(object);
+        return iter != object_table.end() ? iter->second : nullptr;
+    }
+
     void StartWrite(T object, const char *api_name) {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        bool skip = false;
-        std::thread::id tid = std::this_thread::get_id();
-
         auto use_data = FindObject(object);
         if (!use_data) {
             return;
         }
+        StartWrite(object, use_data.get(), api_name);
+    }
+
+    // Variant for callers that already hold the use data of object, see ThreadSafety::GetCommandBufferUse()
+    void StartWrite(T object, ObjectUseData *use_data, const char *api_name) {
+        bool skip = false;
+        std::thread::id tid = std::this_thread::get_id();
+
         const ObjectUseData::WriteReadCount prevCount = use_data->AddWriter();
 
         if (prevCount.GetReadCount() == 0 && prevCount.GetWriteCount() == 0) {
@@ -357,6 +368,8 @@ public:
         use_data->RemoveWriter();
     }
 
+    void FinishWrite(ObjectUseData *use_data) { use_data->RemoveWriter(); }
+
     void StartRead(T object, const char *api_name) {
         if (object == VK_NULL_HANDLE) {
             return;
@@ -536,28 +549,95 @@ WRAPPER_PARENT_INSTANCE(uint64_t)
         c_VkCommandBuffer.CreateObject(object);
     }
     void DestroyObject(VkCommandBuffer object) {
+        InvalidateCommandBufferUseCache();
         c_VkCommandBuffer.DestroyObject(object);
     }
 
-    // VkCommandBuffer needs check for implicit use of command pool
-    void StartWriteObject(VkCommandBuffer object, const char *api_name, bool lockPool = true) {
-        if (lockPool) {
+    // Per-thread cache of the use data for the most recently written command buffer and its pool. The common
+    // "one thread records one command buffer" pattern then skips the command_pool_map and counter lookups for
+    // every vkCmd* call. Entries are tagged with a global generation that is bumped whenever a command buffer
+    // or command pool is destroyed, so a reused handle never hits a stale entry, and with the id of the owning
+    // ThreadSafety object, so a device created at the address of a destroyed one never hits it either.
+    struct CommandBufferUse {
+        uint64_t owner_id = 0;
+        uint64_t generation = 0;
+        VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+        VkCommandPool command_pool = VK_NULL_HANDLE;
+        std::shared_ptr<ObjectUseData> command_buffer_use;
+        std::shared_ptr<ObjectUseData> command_pool_use;
+    };
+    static std::atomic<uint64_t> command_buffer_use_generation;
+    static std::atomic<uint64_t> next_command_buffer_use_owner_id;
+    const uint64_t command_buffer_use_owner_id = next_command_buffer_use_owner_id.fetch_add(1, std::memory_order_relaxed);
+
+    static void InvalidateCommandBufferUseCache() { command_buffer_use_generation.fetch_add(1, std::memory_order_acq_rel); }
+
+    // Returns nullptr, without reporting, if the command buffer is unknown; the caller then lets the counter report it
+    const CommandBufferUse *GetCommandBufferUse(VkCommandBuffer object) {
+        thread_local CommandBufferUse cache;
+        const uint64_t generation = command_buffer_use_generation.load(std::memory_order_acquire);
+        if (cache.owner_id != command_buffer_use_owner_id || cache.command_buffer != object || cache.generation != generation) {
+            auto command_buffer_use = c_VkCommandBuffer.FindObjectWithoutReporting(object);
+            if (!command_buffer_use) {
+                return nullptr;
+            }
+            cache.command_pool = VK_NULL_HANDLE;
+            cache.command_pool_use = nullptr;
             auto iter = command_pool_map.find(object);
             if (iter != command_pool_map.end()) {
-                VkCommandPool pool = iter->second;
-                StartWriteObject(pool, api_name);
+                cache.command_pool = iter->second;
+                cache.command_pool_use = CommandPoolCounter().FindObject(cache.command_pool);
             }
+            cache.command_buffer_use = std::move(command_buffer_use);
+            cache.command_buffer = object;
+            cache.owner_id = command_buffer_use_owner_id;
+            cache.generation = generation;
         }
-        c_VkCommandBuffer.StartWrite(object, api_name);
+        return &cache;
+    }
+
+#ifdef DISTINCT_NONDISPATCHABLE_HANDLES
+    counter<VkCommandPool> &CommandPoolCounter() { return c_VkCommandPool; }
+#else
+    counter<uint64_t> &CommandPoolCounter() { return c_uint64_t; }
+#endif
+
+    // VkCommandBuffer needs check for implicit use of command pool
+    void StartWriteObject(VkCommandBuffer object, const char *api_name, bool lockPool = true) {
+        if (!lockPool) {
+            c_VkCommandBuffer.StartWrite(object, api_name);
+            return;
+        }
+        if (object == VK_NULL_HANDLE) {
+            return;
+        }
+        const CommandBufferUse *use = GetCommandBufferUse(object);
+        if (!use) {
+            // Let the counter report the unknown object
+            c_VkCommandBuffer.StartWrite(object, api_name);
+            return;
+        }
+        if (use->command_pool_use) {
+            CommandPoolCounter().StartWrite(use->command_pool, use->command_pool_use.get(), api_name);
+        }
+        c_VkCommandBuffer.StartWrite(object, use->command_buffer_use.get(), api_name);
     }
     void FinishWriteObject(VkCommandBuffer object, const char *api_name, bool lockPool = true) {
-        c_VkCommandBuffer.FinishWrite(object, api_name);
-        if (lockPool) {
-            auto iter = command_pool_map.find(object);
-            if (iter != command_pool_map.end()) {
-                VkCommandPool pool = iter->second;
-                FinishWriteObject(pool, api_name);
-            }
+        if (!lockPool) {
+            c_VkCommandBuffer.FinishWrite(object, api_name);
+            return;
+        }
+        if (object == VK_NULL_HANDLE) {
+            return;
+        }
+        const CommandBufferUse *use = GetCommandBufferUse(object);
+        if (!use) {
+            c_VkCommandBuffer.FinishWrite(object, api_name);
+            return;
+        }
+        c_VkCommandBuffer.FinishWrite(use->command_buffer_use.get());
+        if (use->command_pool_use) {
+            CommandPoolCounter().FinishWrite(use->command_pool_use.get());
         }
     }
     void StartReadObject(VkCommandBuffer object, const char *api_name) {
@@ -635,6 +715,9 @@ void PostCallRecordGetDrmDisplayEXT(
 
 
     inline_custom_source_preamble = """
+std::atomic<uint64_t> ThreadSafety::command_buffer_use_generation{1};
+std::atomic<uint64_t> ThreadSafety::next_command_buffer_use_owner_id{1};
+
 ReadLockGuard ThreadSafety::ReadLock() {
     return ReadLockGuard(validation_object_mutex, std::defer_lock);
 }
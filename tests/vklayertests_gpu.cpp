@@ -518,7 +518,7 @@ TEST_F(VkGpuAssistedLayerTest, GpuValidationArrayOOBGraphicsShaders) {
         buffer0.memory().unmap();
         m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Stage = Compute");
         vk::QueueSubmit(c_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
-        vk::QueueWaitIdle(m_device->m_queue);
+        vk::QueueWaitIdle(c_queue->handle());
         m_errorMonitor->VerifyFound();
         // Out of Bounds
         data = (uint32_t *)buffer0.memory().map();
@@ -526,7 +526,7 @@ TEST_F(VkGpuAssistedLayerTest, GpuValidationArrayOOBGraphicsShaders) {
         buffer0.memory().unmap();
         m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Stage = Compute");
         vk::QueueSubmit(c_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
-        vk::QueueWaitIdle(m_device->m_queue);
+        vk::QueueWaitIdle(c_queue->handle());
         m_errorMonitor->VerifyFound();
         vk::DestroyPipeline(m_device->handle(), c_pipeline, NULL);
     }
@@ -1001,6 +1001,106 @@ TEST_F(VkGpuAssistedLayerTest, DrawTimeShaderUniformBufferTooSmallNestedStruct)
                          "Descriptor size is 8 and highest byte accessed was 19");
 }
 
+TEST_F(VkGpuAssistedLayerTest, DrawTimeShaderStorageBufferTooSmallManyDraws) {
+    TEST_DESCRIPTION(
+        "Record many instrumented draws in one command buffer, a few of which access a storage buffer outside the bound "
+        "region, and check that every error is reported against the descriptor bound for its draw.");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+
+    VkValidationFeaturesEXT validation_features = GetValidationFeatures();
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &validation_features));
+    if (!CanEnableGpuAV()) {
+        GTEST_SKIP() << "Requirements for GPU-AV are not met";
+    }
+    if (IsPlatform(kGalaxyS10)) {
+        GTEST_SKIP() << "This test should not run on Galaxy S10";
+    }
+
+    VkPhysicalDeviceFeatures features = {};  // Make sure robust buffer access is not enabled
+    ASSERT_NO_FATAL_FAILURE(InitState(&features));
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    // The layer reserves a dynamic storage buffer for its own descriptor set
+    VkPhysicalDeviceProperties props = {};
+    vk::GetPhysicalDeviceProperties(gpu(), &props);
+    if (props.limits.maxDescriptorSetStorageBuffersDynamic == 0) {
+        GTEST_SKIP() << "No dynamic storage buffers left for the application";
+    }
+
+    // One set per bound range; only the last one covers the whole block
+    constexpr uint32_t kSetCount = 5;
+    const VkDeviceSize ranges[kSetCount] = {4, 8, 12, 16, 20};
+    std::vector<std::unique_ptr<OneOffDescriptorSet>> sets;
+    for (uint32_t i = 0; i < kSetCount; ++i) {
+        sets.emplace_back(new OneOffDescriptorSet(
+            m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}}));
+    }
+    const VkPipelineLayoutObj pipeline_layout(m_device, {&sets[0]->layout_});
+
+    VkBufferObj buffer;
+    buffer.init(*m_device, 64, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    for (uint32_t i = 0; i < kSetCount; ++i) {
+        VkDescriptorBufferInfo buffer_info = {buffer.handle(), 0, ranges[i]};
+        VkWriteDescriptorSet descriptor_write = LvlInitStruct<VkWriteDescriptorSet>();
+        descriptor_write.dstSet = sets[i]->set_;
+        descriptor_write.dstBinding = 0;
+        descriptor_write.descriptorCount = 1;
+        descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        descriptor_write.pBufferInfo = &buffer_info;
+        vk::UpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, nullptr);
+    }
+
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) out vec4 x;\n"
+        "layout(set=0, binding=0) buffer readonly foo { int x[5]; } bar;\n"
+        "void main(){\n"
+        "   int y = 0;\n"
+        "   for (int i = 0; i < 5; i++)\n"
+        "       y += bar.x[i];\n"
+        "   x = vec4(y, 0, 0, 1);\n"
+        "}\n";
+
+    VkShaderObj vs(this, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs(this, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT);
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddDefaultColorAttachment();
+    ASSERT_VK_SUCCESS(pipe.CreateVKPipeline(pipeline_layout.handle(), renderPass()));
+
+    // Enough draws that the per-draw output buffers span several slab chunks, with the bad ones spread across them
+    constexpr uint32_t kDrawCount = 300;
+    const std::map<uint32_t, uint32_t> bad_draws = {{0, 0}, {1, 1}, {150, 2}, {kDrawCount - 1, 3}};
+    for (const auto &bad_draw : bad_draws) {
+        std::stringstream msg;
+        msg << "Descriptor size is " << ranges[bad_draw.second] << " and highest byte accessed was 19";
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, msg.str());
+    }
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+    VkViewport viewport = {0, 0, 16, 16, 0, 1};
+    vk::CmdSetViewport(m_commandBuffer->handle(), 0, 1, &viewport);
+    VkRect2D scissor = {{0, 0}, {16, 16}};
+    vk::CmdSetScissor(m_commandBuffer->handle(), 0, 1, &scissor);
+    for (uint32_t draw = 0; draw < kDrawCount; ++draw) {
+        const auto bad_draw = bad_draws.find(draw);
+        const uint32_t set_index = bad_draw == bad_draws.end() ? kSetCount - 1 : bad_draw->second;
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                                  &sets[set_index]->set_, 0, nullptr);
+        vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+    }
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer(true);
+    m_errorMonitor->VerifyFound();
+    DestroyRenderTarget();
+}
+
 TEST_F(VkGpuAssistedLayerTest, GpuBufferDeviceAddressOOB) {
     SetTargetApiVersion(VK_API_VERSION_1_2);
     AddRequiredExtensions(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
@@ -1248,6 +1348,163 @@ TEST_F(VkGpuAssistedLayerTest, GpuBufferDeviceAddressOOB) {
     vk::FreeMemory(m_device->handle(), buffer_mem, NULL);
 }
 
+TEST_F(VkGpuAssistedLayerTest, GpuBufferDeviceAddressTableVersioning) {
+    TEST_DESCRIPTION("Create and destroy device address buffers between submits, with command buffers recorded around them");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+    VkValidationFeaturesEXT validation_features = GetValidationFeatures();
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &validation_features));
+    if (!AreRequiredExtensionsEnabled()) {
+        GTEST_SKIP() << RequiredExtensionsNotSupported() << " not supported";
+    }
+    if (!CanEnableGpuAV()) {
+        GTEST_SKIP() << "Requirements for GPU-AV are not met";
+    }
+    if (DeviceValidationVersion() < VK_API_VERSION_1_2) {
+        GTEST_SKIP() << "At least Vulkan version 1.2 is required";
+    }
+    if (IsDriver(VK_DRIVER_ID_MESA_RADV)) {
+        GTEST_SKIP() << "This test should not be run on the RADV driver.";
+    }
+    if (IsDriver(VK_DRIVER_ID_AMD_PROPRIETARY)) {
+        GTEST_SKIP() << "This test should not be run on the AMD proprietary driver.";
+    }
+
+    auto bda_features = LvlInitStruct<VkPhysicalDeviceBufferDeviceAddressFeaturesKHR>();
+    VkPhysicalDeviceFeatures2KHR features2 = GetPhysicalDeviceFeatures2(bda_features);
+    if (!bda_features.bufferDeviceAddress) {
+        GTEST_SKIP() << "Buffer Device Address feature not supported";
+    }
+    features2.features.robustBufferAccess = VK_FALSE;
+
+    VkCommandPoolCreateFlags pool_flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, &features2, pool_flags));
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    // Uniform buffer holding the pointer and write count
+    uint32_t qfi = 0;
+    VkBufferCreateInfo bci = LvlInitStruct<VkBufferCreateInfo>();
+    bci.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    bci.size = 12;  // 64 bit pointer + int
+    bci.queueFamilyIndexCount = 1;
+    bci.pQueueFamilyIndices = &qfi;
+    VkBufferObj uniform_buffer;
+    uniform_buffer.init(*m_device, bci, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    auto vkGetBufferDeviceAddressKHR =
+        (PFN_vkGetBufferDeviceAddressKHR)vk::GetDeviceProcAddr(m_device->device(), "vkGetBufferDeviceAddressKHR");
+    ASSERT_TRUE(vkGetBufferDeviceAddressKHR != nullptr);
+
+    // Buffers written through their address, each 16*4 = 64 bytes with its own memory so that the addresses never overlap
+    bci.usage = VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR;
+    bci.size = 64;
+    VkBuffer address_buffers[2] = {};
+    VkDeviceMemory address_memories[2] = {};
+    VkDeviceAddress addresses[2] = {};
+    auto create_address_buffer = [&](uint32_t index) {
+        vk::CreateBuffer(device(), &bci, nullptr, &address_buffers[index]);
+        VkMemoryRequirements mem_reqs = {};
+        vk::GetBufferMemoryRequirements(device(), address_buffers[index], &mem_reqs);
+        VkMemoryAllocateFlagsInfo alloc_flags = LvlInitStruct<VkMemoryAllocateFlagsInfo>();
+        alloc_flags.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT_KHR;
+        VkMemoryAllocateInfo alloc_info = LvlInitStruct<VkMemoryAllocateInfo>(&alloc_flags);
+        alloc_info.allocationSize = mem_reqs.size;
+        m_device->phy().set_memory_type(mem_reqs.memoryTypeBits, &alloc_info, 0);
+        ASSERT_VK_SUCCESS(vk::AllocateMemory(device(), &alloc_info, nullptr, &address_memories[index]));
+        vk::BindBufferMemory(device(), address_buffers[index], address_memories[index], 0);
+        VkBufferDeviceAddressInfoKHR bda_info = LvlInitStruct<VkBufferDeviceAddressInfoKHR>();
+        bda_info.buffer = address_buffers[index];
+        addresses[index] = vkGetBufferDeviceAddressKHR(device(), &bda_info);
+        // Querying the address again must not change the table
+        ASSERT_EQ(addresses[index], vkGetBufferDeviceAddressKHR(device(), &bda_info));
+    };
+
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    const VkPipelineLayoutObj pipeline_layout(m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, uniform_buffer.handle(), 0, 12);
+    descriptor_set.UpdateDescriptorSets();
+
+    char const *shader_source = R"glsl(
+        #version 450
+        #extension GL_EXT_buffer_reference : enable
+        layout(buffer_reference, buffer_reference_align = 16) buffer bufStruct;
+        layout(set = 0, binding = 0) uniform ufoo {
+            bufStruct data;
+            int nWrites;
+        } u_info;
+        layout(buffer_reference, std140) buffer bufStruct {
+            int a[4];
+        };
+        void main() {
+            for (int i=0; i < u_info.nWrites; ++i) {
+                u_info.data.a[i] = 0xdeadca71;
+            }
+        }
+    )glsl";
+    VkShaderObj vs(this, shader_source, VK_SHADER_STAGE_VERTEX_BIT, SPV_ENV_VULKAN_1_0, SPV_SOURCE_GLSL, nullptr, "main", true);
+
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddDefaultColorAttachment();
+    ASSERT_VK_SUCCESS(pipe.CreateVKPipeline(pipeline_layout.handle(), renderPass()));
+
+    // Each command buffer is validated against the device address table current when it was recorded
+    auto record = [&](VkCommandBufferObj &cb) {
+        cb.begin();
+        cb.BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(cb.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+        vk::CmdBindDescriptorSets(cb.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                                  &descriptor_set.set_, 0, nullptr);
+        vk::CmdSetViewport(cb.handle(), 0, 1, &m_viewports[0]);
+        vk::CmdSetScissor(cb.handle(), 0, 1, &m_scissors[0]);
+        vk::CmdDraw(cb.handle(), 3, 1, 0, 0);
+        vk::CmdEndRenderPass(cb.handle());
+        cb.end();
+    };
+    auto submit = [&](VkCommandBufferObj &cb, VkDeviceAddress address, int writes, bool expect_oob) {
+        auto *data = static_cast<VkDeviceAddress *>(uniform_buffer.memory().map());
+        data[0] = address;
+        data[1] = writes;
+        uniform_buffer.memory().unmap();
+        if (expect_oob) {
+            m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "access out of bounds");
+        }
+        cb.QueueCommandBuffer();
+        if (expect_oob) {
+            m_errorMonitor->VerifyFound();
+        }
+    };
+
+    create_address_buffer(0);
+    VkCommandBufferObj old_cb(m_device, m_commandPool);
+    record(old_cb);
+    submit(old_cb, addresses[0], 4, false);
+    submit(old_cb, addresses[0], 5, true);
+
+    // A buffer created after recording is only known to command buffers recorded after it
+    create_address_buffer(1);
+    record(*m_commandBuffer);
+    submit(*m_commandBuffer, addresses[1], 4, false);
+    submit(*m_commandBuffer, addresses[1], 5, true);
+    submit(*m_commandBuffer, addresses[0], 4, false);
+
+    // The table of the older command buffer must still be intact after the newer one was built
+    submit(old_cb, addresses[0], 4, false);
+    submit(old_cb, addresses[0], 5, true);
+
+    // Once destroyed, a buffer is no longer in the table of command buffers recorded afterwards
+    vk::DestroyBuffer(device(), address_buffers[0], nullptr);
+    record(*m_commandBuffer);
+    submit(*m_commandBuffer, addresses[0], 4, true);
+    submit(*m_commandBuffer, addresses[1], 4, false);
+
+    vk::DestroyBuffer(device(), address_buffers[1], nullptr);
+    for (auto memory : address_memories) {
+        vk::FreeMemory(device(), memory, nullptr);
+    }
+}
+
 TEST_F(VkGpuAssistedLayerTest, GpuDrawIndirectCountDeviceLimit) {
     TEST_DESCRIPTION("GPU validation: Validate maxDrawIndirectCount limit");
     SetTargetApiVersion(VK_API_VERSION_1_3);
@@ -1843,7 +2100,7 @@ TEST_F(VkGpuAssistedLayerTest, GpuValidationInlineUniformBlockAndMiscGpu) {
     submit_info.commandBufferCount = 1;
     submit_info.pCommandBuffers = &m_commandBuffer->handle();
     vk::QueueSubmit(c_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
-    vk::QueueWaitIdle(m_device->m_queue);
+    vk::QueueWaitIdle(c_queue->handle());
     vk::DestroyPipeline(m_device->handle(), c_pipeline, NULL);
 
     uint32_t *data = (uint32_t *)buffer0.memory().map();
@@ -1908,7 +2165,7 @@ TEST_F(VkGpuAssistedLayerTest, GpuValidationInlineUniformBlockAndMiscGpu) {
     vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
     m_commandBuffer->end();
     vk::QueueSubmit(c_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
-    vk::QueueWaitIdle(m_device->m_queue);
+    vk::QueueWaitIdle(c_queue->handle());
     vk::DestroyPipelineLayout(m_device->handle(), pl_layout, NULL);
     vk::DestroyPipeline(m_device->handle(), c_pipeline, NULL);
     for (uint32_t i = 0; i < set_count; i++) {
@@ -1932,7 +2189,7 @@ TEST_F(VkGpuAssistedLayerTest, GpuValidationInlineUniformBlockAndMiscGpu) {
     vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
     m_commandBuffer->end();
     vk::QueueSubmit(c_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
-    vk::QueueWaitIdle(m_device->m_queue);
+    vk::QueueWaitIdle(c_queue->handle());
     vk::DestroyPipeline(m_device->handle(), c_pipeline2, nullptr);
     data = (uint32_t *)buffer0.memory().map();
     if (*data != test_data) m_errorMonitor->SetError("Using shader after pipeline recovery not functioning as expected");
@@ -2182,6 +2439,221 @@ TEST_F(VkGpuAssistedLayerTest, DispatchIndirectWorkgroupSize) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkGpuAssistedLayerTest, GpuBufferOOBDestroyDeviceWithoutWait) {
+    TEST_DESCRIPTION("GPU validation: report errors of a submission the application never waited for when destroying the device");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    VkValidationFeaturesEXT validation_features = GetValidationFeatures();
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &validation_features));
+    if (!CanEnableGpuAV()) {
+        GTEST_SKIP() << "Requirements for GPU-AV are not met";
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    // Use a device of its own, as everything created on it is left in flight when it is destroyed
+    vk_testing::QueueCreateInfoArray queue_info(m_device->queue_props);
+    VkDeviceCreateInfo device_create_info = LvlInitStruct<VkDeviceCreateInfo>();
+    device_create_info.queueCreateInfoCount = queue_info.size();
+    device_create_info.pQueueCreateInfos = queue_info.data();
+    VkDevice test_device = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::CreateDevice(gpu(), &device_create_info, nullptr, &test_device));
+    const uint32_t queue_family_index = m_device->graphics_queue_node_index_;
+    VkQueue queue = VK_NULL_HANDLE;
+    vk::GetDeviceQueue(test_device, queue_family_index, 0, &queue);
+
+    VkBufferCreateInfo buffer_create_info = LvlInitStruct<VkBufferCreateInfo>();
+    buffer_create_info.size = 16;
+    buffer_create_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    VkBuffer buffer = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::CreateBuffer(test_device, &buffer_create_info, nullptr, &buffer));
+    VkMemoryRequirements memory_requirements;
+    vk::GetBufferMemoryRequirements(test_device, buffer, &memory_requirements);
+    VkMemoryAllocateInfo memory_allocate_info = LvlInitStruct<VkMemoryAllocateInfo>();
+    memory_allocate_info.allocationSize = memory_requirements.size;
+    ASSERT_TRUE(m_device->phy().set_memory_type(memory_requirements.memoryTypeBits, &memory_allocate_info, 0));
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::AllocateMemory(test_device, &memory_allocate_info, nullptr, &memory));
+    ASSERT_VK_SUCCESS(vk::BindBufferMemory(test_device, buffer, memory, 0));
+
+    VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+    VkDescriptorSetLayoutCreateInfo set_layout_create_info = LvlInitStruct<VkDescriptorSetLayoutCreateInfo>();
+    set_layout_create_info.bindingCount = 1;
+    set_layout_create_info.pBindings = &binding;
+    VkDescriptorSetLayout set_layout = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::CreateDescriptorSetLayout(test_device, &set_layout_create_info, nullptr, &set_layout));
+    VkPipelineLayoutCreateInfo pipeline_layout_create_info = LvlInitStruct<VkPipelineLayoutCreateInfo>();
+    pipeline_layout_create_info.setLayoutCount = 1;
+    pipeline_layout_create_info.pSetLayouts = &set_layout;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::CreatePipelineLayout(test_device, &pipeline_layout_create_info, nullptr, &pipeline_layout));
+
+    VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1};
+    VkDescriptorPoolCreateInfo descriptor_pool_create_info = LvlInitStruct<VkDescriptorPoolCreateInfo>();
+    descriptor_pool_create_info.maxSets = 1;
+    descriptor_pool_create_info.poolSizeCount = 1;
+    descriptor_pool_create_info.pPoolSizes = &pool_size;
+    VkDescriptorPool descriptor_pool = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::CreateDescriptorPool(test_device, &descriptor_pool_create_info, nullptr, &descriptor_pool));
+    VkDescriptorSetAllocateInfo set_allocate_info = LvlInitStruct<VkDescriptorSetAllocateInfo>();
+    set_allocate_info.descriptorPool = descriptor_pool;
+    set_allocate_info.descriptorSetCount = 1;
+    set_allocate_info.pSetLayouts = &set_layout;
+    VkDescriptorSet descriptor_set = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::AllocateDescriptorSets(test_device, &set_allocate_info, &descriptor_set));
+    VkDescriptorBufferInfo buffer_info = {buffer, 0, VK_WHOLE_SIZE};
+    VkWriteDescriptorSet descriptor_write = LvlInitStruct<VkWriteDescriptorSet>();
+    descriptor_write.dstSet = descriptor_set;
+    descriptor_write.descriptorCount = 1;
+    descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    descriptor_write.pBufferInfo = &buffer_info;
+    vk::UpdateDescriptorSets(test_device, 1, &descriptor_write, 0, nullptr);
+
+    static const char cs_source[] =
+        "#version 450\n"
+        "layout(local_size_x = 1) in;\n"
+        "layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;\n"  // data[4]
+        "void main() {\n"
+        "    Data.data[4] = 0xdeadca71;\n"
+        "}\n";
+    std::vector<uint32_t> spv;
+    ASSERT_TRUE(GLSLtoSPV(&m_device->props.limits, VK_SHADER_STAGE_COMPUTE_BIT, cs_source, spv));
+    VkShaderModuleCreateInfo module_create_info = LvlInitStruct<VkShaderModuleCreateInfo>();
+    module_create_info.codeSize = spv.size() * sizeof(uint32_t);
+    module_create_info.pCode = spv.data();
+    VkShaderModule shader_module = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::CreateShaderModule(test_device, &module_create_info, nullptr, &shader_module));
+    VkComputePipelineCreateInfo pipeline_create_info = LvlInitStruct<VkComputePipelineCreateInfo>();
+    pipeline_create_info.stage = LvlInitStruct<VkPipelineShaderStageCreateInfo>();
+    pipeline_create_info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipeline_create_info.stage.module = shader_module;
+    pipeline_create_info.stage.pName = "main";
+    pipeline_create_info.layout = pipeline_layout;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::CreateComputePipelines(test_device, VK_NULL_HANDLE, 1, &pipeline_create_info, nullptr, &pipeline));
+
+    VkCommandPoolCreateInfo command_pool_create_info = LvlInitStruct<VkCommandPoolCreateInfo>();
+    command_pool_create_info.queueFamilyIndex = queue_family_index;
+    VkCommandPool command_pool = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::CreateCommandPool(test_device, &command_pool_create_info, nullptr, &command_pool));
+    VkCommandBufferAllocateInfo command_buffer_allocate_info = LvlInitStruct<VkCommandBufferAllocateInfo>();
+    command_buffer_allocate_info.commandPool = command_pool;
+    command_buffer_allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    command_buffer_allocate_info.commandBufferCount = 1;
+    VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::AllocateCommandBuffers(test_device, &command_buffer_allocate_info, &command_buffer));
+
+    VkCommandBufferBeginInfo begin_info = LvlInitStruct<VkCommandBufferBeginInfo>();
+    vk::BeginCommandBuffer(command_buffer, &begin_info);
+    vk::CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+    vk::CmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0, 1, &descriptor_set, 0, nullptr);
+    vk::CmdDispatch(command_buffer, 1, 1, 1);
+    vk::EndCommandBuffer(command_buffer);
+
+    VkSubmitInfo submit_info = LvlInitStruct<VkSubmitInfo>();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &command_buffer;
+    ASSERT_VK_SUCCESS(vk::QueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE));
+
+    // Nothing waits for the submission, so its output is only read back when the device is destroyed, which must happen
+    // before the command pool is
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Descriptor size is 16 and highest byte accessed was 19");
+    m_errorMonitor->SetAllowedFailureMsg("VUID-vkDestroyDevice-device-00378");
+    vk::DestroyDevice(test_device, nullptr);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkGpuAssistedLayerTest, GpuBufferOOBWaitOnOtherThread) {
+    TEST_DESCRIPTION(
+        "GPU validation: report errors of submissions that another thread waits for, through a timeline semaphore, while they "
+        "are still being submitted");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    AddRequiredExtensions(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    VkValidationFeaturesEXT validation_features = GetValidationFeatures();
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &validation_features));
+    if (!CanEnableGpuAV()) {
+        GTEST_SKIP() << "Requirements for GPU-AV are not met";
+    }
+    if (!AreRequiredExtensionsEnabled()) {
+        GTEST_SKIP() << RequiredExtensionsNotSupported() << " not supported";
+    }
+    auto timeline_features = LvlInitStruct<VkPhysicalDeviceTimelineSemaphoreFeatures>();
+    auto features2 = GetPhysicalDeviceFeatures2(timeline_features);
+    if (!timeline_features.timelineSemaphore) {
+        GTEST_SKIP() << "Timeline semaphore feature not supported.";
+    }
+    features2.features.robustBufferAccess = VK_FALSE;
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, &features2));
+
+    VkBufferObj buffer;
+    buffer.init(*m_device, 16, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}};
+    pipe.cs_.reset(new VkShaderObj(this,
+                                   "#version 450\n"
+                                   "layout(local_size_x = 1) in;\n"
+                                   "layout(set = 0, binding = 0) buffer StorageBuffer { uint data[]; } Data;\n"  // data[4]
+                                   "void main() {\n"
+                                   "    Data.data[4] = 0xdeadca71;\n"
+                                   "}\n",
+                                   VK_SHADER_STAGE_COMPUTE_BIT));
+    pipe.InitState();
+    pipe.CreateComputePipeline();
+    pipe.descriptor_set_->WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    pipe.descriptor_set_->UpdateDescriptorSets();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1,
+                              &pipe.descriptor_set_->set_, 0, nullptr);
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+
+    auto sem_type_ci = LvlInitStruct<VkSemaphoreTypeCreateInfo>();
+    sem_type_ci.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    auto sem_ci = LvlInitStruct<VkSemaphoreCreateInfo>(&sem_type_ci);
+    vk_testing::Semaphore sem(*m_device, sem_ci);
+    const VkSemaphore sem_handle = sem.handle();
+
+    // The waiting thread can retire each submission as soon as the state tracker has recorded it, possibly before GPU-AV
+    // has registered it for readback. The submitting thread waits for it in turn before reusing the command buffer.
+    constexpr uint64_t kSubmitCount = 64;
+    std::atomic<uint64_t> waited_value{0};
+    auto fpWaitSemaphores =
+        reinterpret_cast<PFN_vkWaitSemaphoresKHR>(vk::GetDeviceProcAddr(m_device->device(), "vkWaitSemaphoresKHR"));
+    std::thread waiter([&]() {
+        for (uint64_t value = 1; value <= kSubmitCount; ++value) {
+            auto wait_info = LvlInitStruct<VkSemaphoreWaitInfo>();
+            wait_info.semaphoreCount = 1;
+            wait_info.pSemaphores = &sem_handle;
+            wait_info.pValues = &value;
+            fpWaitSemaphores(m_device->device(), &wait_info, kWaitTimeout);
+            waited_value.store(value);
+        }
+    });
+
+    for (uint64_t value = 1; value <= kSubmitCount; ++value) {
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Descriptor size is 16 and highest byte accessed was 19");
+        auto timeline_info = LvlInitStruct<VkTimelineSemaphoreSubmitInfo>();
+        timeline_info.signalSemaphoreValueCount = 1;
+        timeline_info.pSignalSemaphoreValues = &value;
+        auto submit_info = LvlInitStruct<VkSubmitInfo>(&timeline_info);
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &m_commandBuffer->handle();
+        submit_info.signalSemaphoreCount = 1;
+        submit_info.pSignalSemaphores = &sem_handle;
+        ASSERT_VK_SUCCESS(vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE));
+        while (waited_value.load() < value) {
+            std::this_thread::yield();
+        }
+    }
+    waiter.join();
+
+    // Every error must have been reported by now, as nothing is left for vkQueueWaitIdle to retire
+    m_errorMonitor->VerifyFound();
+    ASSERT_VK_SUCCESS(vk::QueueWaitIdle(m_device->m_queue));
+}
+
 TEST_F(VkGpuAssistedLayerTest, GpuBufferOOBGPL) {
     SetTargetApiVersion(VK_API_VERSION_1_1);
     AddRequiredExtensions(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
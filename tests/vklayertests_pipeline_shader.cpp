@@ -4979,6 +4979,65 @@ TEST_F(VkLayerTest, CreatePipelineVsFsTypeMismatch) {
     CreatePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "Type mismatch on location 0");
 }
 
+TEST_F(VkLayerTest, CreatePipelineInterfaceVerdictCache) {
+    TEST_DESCRIPTION(
+        "Create pipelines sharing shaders several times, so that the interface checks between stages found clean are taken "
+        "from the validation cache, and make sure mismatches and warnings are still reported every time.");
+
+    SetTargetApiVersion(VK_API_VERSION_1_0);
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    char const *vsSource = R"glsl(
+        #version 450
+        layout(location=0) out float x;
+        void main(){
+           x = 0;
+           gl_Position = vec4(1);
+        }
+    )glsl";
+    char const *fsMatchSource = R"glsl(
+        #version 450
+        layout(location=0) in float x;
+        layout(location=0) out vec4 color;
+        void main(){
+           color = vec4(x);
+        }
+    )glsl";
+    char const *fsMismatchSource = R"glsl(
+        #version 450
+        layout(location=0) flat in int x; /* VS writes float */
+        layout(location=0) out vec4 color;
+        void main(){
+           color = vec4(x);
+        }
+    )glsl";
+
+    VkShaderObj vs(this, vsSource, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs_match(this, fsMatchSource, VK_SHADER_STAGE_FRAGMENT_BIT);
+    VkShaderObj fs_mismatch(this, fsMismatchSource, VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    const auto set_match = [&](CreatePipelineHelper &helper) {
+        helper.shader_stages_ = {vs.GetStageCreateInfo(), fs_match.GetStageCreateInfo()};
+    };
+    const auto set_mismatch = [&](CreatePipelineHelper &helper) {
+        helper.shader_stages_ = {vs.GetStageCreateInfo(), fs_mismatch.GetStageCreateInfo()};
+    };
+    const auto set_not_consumed = [&](CreatePipelineHelper &helper) {
+        helper.shader_stages_ = {vs.GetStageCreateInfo(), helper.fs_->GetStageCreateInfo()};
+    };
+
+    for (uint32_t i = 0; i < 2; ++i) {
+        // The second pipeline takes the clean verdict from the cache
+        CreatePipelineHelper::OneshotTest(*this, set_match, kErrorBit);
+        // Only clean verdicts are cached, and the vertex shader's clean verdict with fs_match does not cover fs_mismatch
+        CreatePipelineHelper::OneshotTest(*this, set_mismatch, kErrorBit, "Type mismatch on location 0");
+        // A check that only warned is not clean either
+        CreatePipelineHelper::OneshotTest(*this, set_not_consumed, kPerformanceWarningBit, "not consumed by fragment shader");
+    }
+}
+
 TEST_F(VkLayerTest, CreatePipelineVsFsTypeMismatchInBlock) {
     TEST_DESCRIPTION(
         "Test that an error is produced for mismatched types across the vertex->fragment shader interface, when the variable is "
@@ -6527,6 +6586,66 @@ TEST_F(VkLayerTest, CreateComputePipelineMissingDescriptor) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, CreateComputePipelineIdenticalShaderModuleDestroyed) {
+    TEST_DESCRIPTION(
+        "Create two shader modules from the same code, destroy one and check that pipelines using the other are still validated "
+        "against its parsed SPIR-V");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    char const *csSource = R"glsl(
+        #version 450
+        layout(local_size_x=1) in;
+        layout(set=0, binding=0) buffer block { vec4 x; };
+        void main(){
+           x = vec4(1);
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe_a(*this);
+    pipe_a.InitInfo();
+    pipe_a.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    pipe_a.cs_.reset(new VkShaderObj(this, csSource, VK_SHADER_STAGE_COMPUTE_BIT));
+    pipe_a.InitState();
+    ASSERT_VK_SUCCESS(pipe_a.CreateComputePipeline());
+
+    // Same code, so both modules share their parsed SPIR-V in the state tracker
+    CreateComputePipelineHelper pipe_b(*this);
+    pipe_b.InitInfo();
+    pipe_b.dsl_bindings_ = pipe_a.dsl_bindings_;
+    pipe_b.cs_.reset(new VkShaderObj(this, csSource, VK_SHADER_STAGE_COMPUTE_BIT));
+    pipe_b.InitState();
+
+    pipe_a.cs_.reset();
+
+    // The remaining module must still know its descriptor use
+    pipe_b.pipeline_layout_ = VkPipelineLayoutObj(m_device, {});
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkComputePipelineCreateInfo-layout-00703");
+    pipe_b.CreateComputePipeline();
+    m_errorMonitor->VerifyFound();
+
+    pipe_b.pipeline_layout_ = VkPipelineLayoutObj(m_device, {&pipe_b.descriptor_set_->layout_});
+    ASSERT_VK_SUCCESS(pipe_b.CreateComputePipeline());
+
+    // A module may be destroyed once its pipelines are created, and both pipelines stay usable
+    VkBufferObj buffer;
+    buffer.init(*m_device, 16, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    for (auto *pipe : {&pipe_a, &pipe_b}) {
+        pipe->descriptor_set_->WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        pipe->descriptor_set_->UpdateDescriptorSets();
+    }
+
+    m_commandBuffer->begin();
+    for (auto *pipe : {&pipe_a, &pipe_b}) {
+        vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe->pipeline_);
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe->pipeline_layout_.handle(), 0, 1,
+                                  &pipe->descriptor_set_->set_, 0, nullptr);
+        vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    }
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer();
+}
+
 TEST_F(VkLayerTest, CreateComputePipelineDescriptorTypeMismatch) {
     TEST_DESCRIPTION("Test that an error is produced for a pipeline consuming a descriptor-backed resource of a mismatched type");
 
@@ -12598,6 +12717,71 @@ TEST_F(VkLayerTest, ComputeSharedMemorySpecConstantSet) {
     CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "VUID-RuntimeSpirv-Workgroup-06530");
 }
 
+TEST_F(VkLayerTest, ComputeSharedMemorySpecConstantSameModuleDifferentValues) {
+    TEST_DESCRIPTION("Specialize the same shader module with different values, each result must be validated on its own");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    const uint32_t max_shared_memory_size = m_device->phy().properties().limits.maxComputeSharedMemorySize;
+    const uint32_t max_shared_ints = max_shared_memory_size / 4;
+
+    std::stringstream cs_source;
+    cs_source << R"glsl(
+        #version 450
+        layout(constant_id = 0) const uint Condition = 0;
+        layout(constant_id = 1) const uint SharedSize = )glsl";
+    cs_source << (max_shared_ints + 16);
+    cs_source << R"glsl(;
+
+        #define enableSharedMemoryOpt (Condition == 1)
+        shared uint arr[enableSharedMemoryOpt ? SharedSize : 1];
+        void main(){}
+    )glsl";
+
+    uint32_t data = 0;
+
+    VkSpecializationMapEntry entry;
+    entry.constantID = 0;
+    entry.offset = 0;
+    entry.size = sizeof(uint32_t);
+
+    VkSpecializationInfo specialization_info = {};
+    specialization_info.mapEntryCount = 1;
+    specialization_info.pMapEntries = &entry;
+    specialization_info.dataSize = sizeof(uint32_t);
+    specialization_info.pData = &data;
+
+    // One module for every pipeline, only the specialization data changes between them
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.cs_.reset(new VkShaderObj(this, cs_source.str().c_str(), VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0,
+                                   SPV_SOURCE_GLSL, &specialization_info));
+    pipe.InitState();
+
+    // Alternate the values so that the second round of each is a repeat of an already specialized pair
+    for (int round = 0; round < 2; ++round) {
+        data = 0;
+        pipe.CreateComputePipeline();
+
+        data = 1;
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-RuntimeSpirv-Workgroup-06530");
+        pipe.CreateComputePipeline();
+        m_errorMonitor->VerifyFound();
+    }
+
+    // Values given through a different map entry layout but equal to an earlier set must get the same verdict
+    uint32_t padded_data[2] = {0xdeadbeef, 1};
+    entry.offset = sizeof(uint32_t);
+    specialization_info.dataSize = sizeof(padded_data);
+    specialization_info.pData = padded_data;
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-RuntimeSpirv-Workgroup-06530");
+    pipe.CreateComputePipeline();
+    m_errorMonitor->VerifyFound();
+
+    padded_data[1] = 0;
+    pipe.CreateComputePipeline();
+}
+
 TEST_F(VkLayerTest, TestInvalidShaderInputAndOutputComponents) {
     TEST_DESCRIPTION("Test invalid shader layout in and out with different components.");
 
@@ -4509,6 +4509,85 @@ TEST_F(VkSyncValTest, SyncQSBufferCopyHazards) {
     test.DeviceWait();
 }
 
+TEST_F(VkSyncValTest, SyncQSFirstUseHazardAcrossAddressTypes) {
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+
+    QSTestContext test(m_device, m_device->m_queue_obj);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires a valid queue object.";
+    }
+
+    // Optimal tiling images are tracked in a different address space than buffers
+    VkImageObj image(m_device);
+    auto image_ci = VkImageObj::ImageCreateInfo2D(128, 128, 1, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+                                                  VK_IMAGE_TILING_OPTIMAL);
+    image.Init(image_ci);
+    ASSERT_TRUE(image.initialized());
+    VkImageSubresourceRange full_subresource_range{VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    VkClearColorValue ccv = {};
+
+    test.BeginC();
+    image.SetLayout(&test.cbc, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+    test.End();
+    test.Submit0(test.cbc);
+    test.DeviceWait();
+
+    test.RecordCopy(test.cba, test.buffer_a, test.buffer_b);
+    test.Submit0(test.cba);
+
+    // The buffer write is a hazard, the clear of the image that follows it is not. The hazard must still be reported.
+    test.BeginB();
+    test.CopyCToA();
+    vk::CmdClearColorImage(test.h_cbb, image.handle(), VK_IMAGE_LAYOUT_GENERAL, &ccv, 1, &full_subresource_range);
+    test.End();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE-AFTER-READ");
+    test.Submit0(test.cbb);
+    m_errorMonitor->VerifyFound();
+
+    test.DeviceWait();
+}
+
+TEST_F(VkSyncValTest, SyncQSHazardAfterManyTrimmedSubmits) {
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+
+    QSTestContext test(m_device, m_device->m_queue_obj);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires a valid queue object.";
+    }
+
+    // Unrelated traffic that supersedes its own accesses every submit, so that the access log of each of these batches
+    // becomes unreferenced and is trimmed
+    VkBufferObj buffer_d;
+    VkBufferObj buffer_e;
+    test.InitBuffer(buffer_d);
+    test.InitBuffer(buffer_e);
+    test.BeginC();
+    test.TransferBarrier(test.InitBufferBarrier(buffer_e, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_WRITE_BIT));
+    test.Copy(buffer_d, buffer_e);
+    test.End();
+
+    // The write of buffer_b stays referenced however many batches follow it
+    test.BeginA();
+    vk::CmdFillBuffer(test.h_cba, test.buffer_b.handle(), 0, VK_WHOLE_SIZE, 0);
+    test.End();
+    test.Submit0(test.cba);
+
+    for (int i = 0; i < 100; ++i) {
+        test.Submit0(test.cbc);
+    }
+
+    // The prior usage is only reported if the log of the first batch survived the trims
+    test.RecordCopy(test.cbb, test.buffer_b, test.buffer_a);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "command: vkCmdFillBuffer");
+    test.Submit0(test.cbb);
+    m_errorMonitor->VerifyFound();
+
+    test.DeviceWait();
+}
+
 TEST_F(VkSyncValTest, SyncQSSubmit2) {
     SetTargetApiVersion(VK_API_VERSION_1_3);
     ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation